@@ -2,7 +2,6 @@
 #include "UrchinCommon.h"
 
 #include "AIManager.h"
-#include "path/pathfinding/PathfindingAStar.h"
 
 namespace urchin
 {
@@ -15,7 +14,8 @@ namespace urchin
             aiSimulationStopper(false),
             timeStep(0),
             paused(true),
-            navMeshGenerator(new NavMeshGenerator())
+            navMeshGenerator(new NavMeshGenerator()),
+            pathRequestProcessor(new PathRequestProcessor())
     {
         NumericalCheck::instance()->perform();
     }
@@ -33,6 +33,7 @@ namespace urchin
         copiedPathRequests.clear();
         pathRequests.clear();
 
+        delete pathRequestProcessor;
         delete navMeshGenerator;
 
         Profiler::getInstance("ai")->log();
@@ -43,6 +44,14 @@ namespace urchin
         return navMeshGenerator;
     }
 
+    /**
+     * @return Processor of the path requests. Configuration updates are applied at the next AI update.
+     */
+    PathRequestProcessor *AIManager::getPathRequestProcessor() const
+    {
+        return pathRequestProcessor;
+    }
+
     void AIManager::addEntity(const std::shared_ptr<AIEntity> &aiEntity)
     {
         aiWorld.addEntity(aiEntity);
@@ -189,11 +198,8 @@ namespace urchin
         {
             std::shared_ptr<NavMesh> navMesh = navMeshGenerator->generate(aiWorld);
 
-            PathfindingAStar pathfindingAStar(navMesh);
-            for (auto &pathRequest : copiedPathRequests)
-            {
-                pathRequest->setPath(pathfindingAStar.findPath(pathRequest->getStartPoint(), pathRequest->getEndPoint()));
-            }
+            //navigation mesh is only updated by the AI thread: it stays unchanged while the requests are processed
+            pathRequestProcessor->processPathRequests(navMesh, copiedPathRequests);
         }
     }
 
@@ -10,6 +10,7 @@
 #include "input/AIWorld.h"
 #include "input/AIEntity.h"
 #include "path/PathRequest.h"
+#include "path/PathRequestProcessor.h"
 #include "path/navmesh/NavMeshGenerator.h"
 #include "path/navmesh/model/output/NavMesh.h"
 
@@ -23,6 +24,7 @@ namespace urchin
             ~AIManager();
 
             NavMeshGenerator *getNavMeshGenerator() const;
+            PathRequestProcessor *getPathRequestProcessor() const;
 
             void addEntity(const std::shared_ptr<AIEntity> &);
             void removeEntity(const std::shared_ptr<AIEntity> &);
@@ -51,6 +53,7 @@ namespace urchin
             bool paused;
 
             NavMeshGenerator *navMeshGenerator;
+            PathRequestProcessor *pathRequestProcessor;
             AIWorld aiWorld;
             std::vector<std::shared_ptr<PathRequest>> pathRequests;
             std::vector<std::shared_ptr<PathRequest>> copiedPathRequests;
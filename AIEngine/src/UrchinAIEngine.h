@@ -14,6 +14,7 @@
 #include "path/navmesh/model/output/NavPolygon.h"
 #include "path/navmesh/model/output/NavPolygonEdge.h"
 #include "path/navmesh/model/output/NavTriangle.h"
+#include "path/navmesh/model/output/NavTriangleGrid.h"
 #include "path/navmesh/model/output/NavLink.h"
 #include "path/navmesh/triangulation/MonotonePolygonAlgorithm.h"
 #include "path/navmesh/triangulation/MonotonePolygon.h"
@@ -25,8 +26,14 @@
 #include "path/navmesh/link/EdgeLinkDetection.h"
 #include "path/pathfinding/FunnelAlgorithm.h"
 #include "path/pathfinding/PathPortal.h"
+#include "path/pathfinding/PathNodeHeap.h"
+#include "path/pathfinding/IncrementalFunnelAlgorithm.h"
+#include "path/pathfinding/hierarchical/PolygonDistanceAlgorithm.h"
+#include "path/pathfinding/hierarchical/NavPolygonGraph.h"
+#include "path/pathfinding/hierarchical/PolygonCorridorSearch.h"
 #include "path/pathfinding/PathfindingAStar.h"
 #include "path/PathRequest.h"
+#include "path/PathRequestProcessor.h"
 #include "path/PathPoint.h"
 
 #include "character/AICharacter.h"
@@ -5,6 +5,8 @@ namespace urchin
     PathRequest::PathRequest(const Point3<float> &startPoint, const Point3<float> &endPoint) :
             startPoint(startPoint),
             endPoint(endPoint),
+            priority(0),
+            processingId(0),
             bIsPathReady(false)
     {
 
@@ -20,6 +22,37 @@ namespace urchin
         return endPoint;
     }
 
+    /**
+     * @param priority Requests having the highest priority are processed first when all requests cannot be processed in
+     * the same AI update (default: 0)
+     */
+    void PathRequest::setPriority(unsigned int priority)
+    {
+        this->priority.store(priority, std::memory_order_relaxed);
+    }
+
+    unsigned int PathRequest::getPriority() const
+    {
+        return priority.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @param processingId Identifier of the last processing of the request. Used by the AI thread to process first the
+     * requests waiting for the longest time.
+     */
+    void PathRequest::setProcessingId(unsigned int processingId)
+    {
+        this->processingId = processingId;
+    }
+
+    /**
+     * @return Identifier of the last processing of the request or 0 when the request has never been processed
+     */
+    unsigned int PathRequest::getProcessingId() const
+    {
+        return processingId;
+    }
+
     void PathRequest::setPath(const std::vector<PathPoint> &path)
     {
         {
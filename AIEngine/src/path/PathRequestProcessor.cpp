@@ -0,0 +1,217 @@
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "PathRequestProcessor.h"
+
+namespace urchin
+{
+
+    PathRequestProcessor::PathRequestProcessor() :
+            configuration(),
+            appliedConfiguration(),
+            threadPool(nullptr),
+            processingId(0),
+            nextRequestIndex(0),
+            numberProcessedRequests(0)
+    {
+        setNumThreads(ConfigService::instance()->getUnsignedIntValue("pathfinding.numThreads"));
+        setTimeBudget(ConfigService::instance()->getFloatValue("pathfinding.timeBudgetByUpdate"));
+        setHierarchicalSearch(ConfigService::instance()->getBoolValue("pathfinding.hierarchicalSearch"));
+    }
+
+    PathRequestProcessor::~PathRequestProcessor()
+    {
+        deletePathfindingAStars();
+        delete threadPool;
+    }
+
+    /**
+     * Define the number of threads used to compute the paths. The AI thread is included in this number.
+     * @param numThreads Number of threads. A value of 1 disables the parallel processing and a value of 0 uses the number of hardware threads.
+     */
+    void PathRequestProcessor::setNumThreads(unsigned int numThreads)
+    {
+        if(numThreads == 0)
+        {
+            numThreads = std::max(1u, std::thread::hardware_concurrency());
+        }
+
+        std::lock_guard<std::mutex> lock(configurationMutex);
+        configuration.numThreads = numThreads;
+    }
+
+    unsigned int PathRequestProcessor::getNumThreads() const
+    {
+        std::lock_guard<std::mutex> lock(configurationMutex);
+        return configuration.numThreads;
+    }
+
+    /**
+     * @param timeBudget Maximum time (sec.) to start the processing of new requests in one call of processPathRequests().
+     * A value of 0 processes all the requests.
+     */
+    void PathRequestProcessor::setTimeBudget(float timeBudget)
+    {
+        std::lock_guard<std::mutex> lock(configurationMutex);
+        configuration.timeBudget = timeBudget;
+    }
+
+    /**
+     * @param hierarchicalSearch True to search a corridor of polygons before to search the path on the triangles of the corridor
+     */
+    void PathRequestProcessor::setHierarchicalSearch(bool hierarchicalSearch)
+    {
+        std::lock_guard<std::mutex> lock(configurationMutex);
+        configuration.hierarchicalSearch = hierarchicalSearch;
+    }
+
+    /**
+     * Compute the paths of the requests. Navigation mesh must not be modified until the method returns.
+     * At least one request is processed by call: a request is never interrupted and the time budget can therefore be exceeded
+     * by the duration of the longest path computation.
+     * @param pathRequests [in/out] Requests to process. Requests are sorted in their processing order.
+     * @return Number of requests processed
+     */
+    unsigned int PathRequestProcessor::processPathRequests(const std::shared_ptr<NavMesh> &navMesh, std::vector<std::shared_ptr<PathRequest>> &pathRequests)
+    {
+        ScopeProfiler profiler("ai", "procPathReq");
+
+        if(pathRequests.empty())
+        {
+            return 0;
+        }
+
+        applyConfiguration();
+        if(this->navMesh != navMesh || pathfindingAStars.empty())
+        {
+            createPathfindingAStars(navMesh);
+        }
+
+        if(appliedConfiguration.hierarchicalSearch && polygonGraph.getNavMeshUpdateId() != navMesh->getUpdateId())
+        {
+            polygonGraph.update(*navMesh);
+        }
+
+        sortPathRequests(pathRequests);
+        processingId = std::max(1u, processingId + 1);
+        nextRequestIndex.store(0, std::memory_order_relaxed);
+        numberProcessedRequests.store(0, std::memory_order_relaxed);
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float>(appliedConfiguration.timeBudget));
+
+        auto processJob = [&](unsigned int threadIndex, std::size_t, std::size_t) {
+            PathfindingAStar *pathfindingAStar = pathfindingAStars[threadIndex];
+            while(true)
+            {
+                std::size_t requestIndex = nextRequestIndex.fetch_add(1, std::memory_order_relaxed);
+                if(requestIndex >= pathRequests.size() || (requestIndex > 0 && appliedConfiguration.timeBudget > 0.0f && std::chrono::steady_clock::now() >= deadline))
+                {
+                    break;
+                }
+
+                const std::shared_ptr<PathRequest> &pathRequest = pathRequests[requestIndex];
+                pathRequest->setPath(pathfindingAStar->findPath(pathRequest->getStartPoint(), pathRequest->getEndPoint()));
+                pathRequest->setProcessingId(processingId);
+                numberProcessedRequests.fetch_add(1, std::memory_order_relaxed);
+            }
+        };
+
+        auto numThreadsNeeded = static_cast<unsigned int>(std::min((std::size_t)appliedConfiguration.numThreads, pathRequests.size()));
+        if(threadPool && numThreadsNeeded > 1)
+        { //one range by thread: threads take the requests one by one until no request or no time remains
+            threadPool->parallelFor(numThreadsNeeded, processJob, numThreadsNeeded);
+        }else
+        {
+            processJob(0, 0, pathRequests.size());
+        }
+
+        return numberProcessedRequests.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Apply the configuration defined by the setters. Thread pool and pathfinding instances are only updated by the processing
+     * thread: they cannot be deleted while paths are computed.
+     */
+    void PathRequestProcessor::applyConfiguration()
+    {
+        Configuration newConfiguration;
+        {
+            std::lock_guard<std::mutex> lock(configurationMutex);
+            newConfiguration = configuration;
+        }
+
+        if(newConfiguration.numThreads != appliedConfiguration.numThreads)
+        {
+            delete threadPool;
+            threadPool = nullptr;
+
+            if(newConfiguration.numThreads > 1)
+            {
+                threadPool = new ThreadPool(newConfiguration.numThreads);
+            }
+            deletePathfindingAStars();
+        }
+
+        if(newConfiguration.hierarchicalSearch != appliedConfiguration.hierarchicalSearch)
+        {
+            for(PathfindingAStar *pathfindingAStar : pathfindingAStars)
+            {
+                pathfindingAStar->setPolygonGraph(newConfiguration.hierarchicalSearch ? &polygonGraph : nullptr);
+            }
+        }
+
+        appliedConfiguration = newConfiguration;
+    }
+
+    /**
+     * Sort requests by descending priority and then by ascending processing ID: requests never processed or processed for
+     * the longest time are processed first. Priorities are copied before the sort because they can be updated by other threads.
+     */
+    void PathRequestProcessor::sortPathRequests(std::vector<std::shared_ptr<PathRequest>> &pathRequests)
+    {
+        requestOrders.clear();
+        for(std::size_t i = 0; i < pathRequests.size(); ++i)
+        {
+            requestOrders.push_back({pathRequests[i]->getPriority(), pathRequests[i]->getProcessingId(), i});
+        }
+        std::stable_sort(requestOrders.begin(), requestOrders.end(), [](const PathRequestOrder &left, const PathRequestOrder &right) {
+            if(left.priority != right.priority)
+            {
+                return left.priority > right.priority;
+            }
+            return left.processingId < right.processingId;
+        });
+
+        sortedPathRequests.clear();
+        for(const auto &requestOrder : requestOrders)
+        {
+            sortedPathRequests.push_back(pathRequests[requestOrder.requestIndex]);
+        }
+        pathRequests.swap(sortedPathRequests);
+        sortedPathRequests.clear();
+    }
+
+    void PathRequestProcessor::createPathfindingAStars(const std::shared_ptr<NavMesh> &navMesh)
+    {
+        deletePathfindingAStars();
+
+        this->navMesh = navMesh;
+        for(unsigned int i = 0; i < appliedConfiguration.numThreads; ++i)
+        {
+            auto *pathfindingAStar = new PathfindingAStar(navMesh);
+            pathfindingAStar->setPolygonGraph(appliedConfiguration.hierarchicalSearch ? &polygonGraph : nullptr);
+            pathfindingAStars.push_back(pathfindingAStar);
+        }
+    }
+
+    void PathRequestProcessor::deletePathfindingAStars()
+    {
+        for(PathfindingAStar *pathfindingAStar : pathfindingAStars)
+        {
+            delete pathfindingAStar;
+        }
+        pathfindingAStars.clear();
+        navMesh.reset();
+    }
+
+}
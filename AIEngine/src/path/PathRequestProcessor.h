@@ -0,0 +1,75 @@
+#ifndef URCHINENGINE_PATHREQUESTPROCESSOR_H
+#define URCHINENGINE_PATHREQUESTPROCESSOR_H
+
+#include <vector>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include "UrchinCommon.h"
+
+#include "path/PathRequest.h"
+#include "path/navmesh/model/output/NavMesh.h"
+#include "path/pathfinding/PathfindingAStar.h"
+#include "path/pathfinding/hierarchical/NavPolygonGraph.h"
+
+namespace urchin
+{
+
+    /**
+     * Compute the paths of path requests in parallel. Requests are processed by priority and, for a same priority, by
+     * waiting time. A time budget allows to spread the processing of the requests over several AI updates.
+     * Configuration can be updated from any thread: it is applied at the start of the next processing.
+     */
+    class PathRequestProcessor
+    {
+        public:
+            PathRequestProcessor();
+            ~PathRequestProcessor();
+
+            void setNumThreads(unsigned int);
+            unsigned int getNumThreads() const;
+            void setTimeBudget(float);
+            void setHierarchicalSearch(bool);
+
+            unsigned int processPathRequests(const std::shared_ptr<NavMesh> &, std::vector<std::shared_ptr<PathRequest>> &);
+
+        private:
+            struct Configuration
+            {
+                unsigned int numThreads;
+                float timeBudget;
+                bool hierarchicalSearch;
+            };
+
+            struct PathRequestOrder
+            {
+                unsigned int priority;
+                unsigned int processingId;
+                std::size_t requestIndex;
+            };
+
+            void applyConfiguration();
+            void sortPathRequests(std::vector<std::shared_ptr<PathRequest>> &);
+            void createPathfindingAStars(const std::shared_ptr<NavMesh> &);
+            void deletePathfindingAStars();
+
+            mutable std::mutex configurationMutex;
+            Configuration configuration; //configuration updated by the setters
+            Configuration appliedConfiguration; //configuration used by the processing
+
+            ThreadPool *threadPool;
+            NavPolygonGraph polygonGraph;
+
+            std::shared_ptr<NavMesh> navMesh;
+            std::vector<PathfindingAStar *> pathfindingAStars; //one instance by thread
+
+            std::vector<PathRequestOrder> requestOrders;
+            std::vector<std::shared_ptr<PathRequest>> sortedPathRequests;
+            unsigned int processingId;
+            std::atomic<std::size_t> nextRequestIndex;
+            std::atomic_uint numberProcessedRequests;
+    };
+
+}
+
+#endif
@@ -27,7 +27,8 @@ namespace urchin
 			navMeshAgent(std::make_shared<NavMeshAgent>()),
 			navMesh(std::make_shared<NavMesh>()),
 			needFullRefresh(false),
-            navigationObjects(AABBTree<std::shared_ptr<NavObject>>(ConfigService::instance()->getFloatValue("navMesh.polytopeAabbTreeFatMargin")))
+            navigationObjects(AABBTree<std::shared_ptr<NavObject>>(ConfigService::instance()->getFloatValue("navMesh.polytopeAabbTreeFatMargin"))),
+            navObjectsRemoved(false)
     {
 
 	}
@@ -68,7 +69,10 @@ namespace urchin
         deleteNavLinks();
 		updateNavPolygons();
 		createNavLinks();
-        updateNavMesh();
+        if(navObjectsRemoved || !navObjectsToRefresh.empty() || !navObjectsLinksToRefresh.empty())
+        { //navigation mesh (and its update identifier) is kept unchanged when no polygon has been regenerated or relinked
+            updateNavMesh();
+        }
 
         if(DEBUG_EXPORT_NAV_MESH)
         {
@@ -84,6 +88,7 @@ namespace urchin
 
         newOrMovingNavObjectsToRefresh.clear();
         affectedNavObjectsToRefresh.clear();
+        navObjectsRemoved = false;
 
 		for(auto &aiObjectToRemove : aiWorld.getEntitiesToRemoveAndReset())
 		{
@@ -156,6 +161,7 @@ namespace urchin
             }
 
             navigationObjects.removeObject(navObject);
+            navObjectsRemoved = true;
         }
     }
 
@@ -428,6 +434,7 @@ namespace urchin
                 {
                     sourceNavPolygon->removeLinksTo(targetNavPolygon);
                 }
+                sourceNavPolygon->changeLinksUpdateId();
             }
         }
     }
@@ -66,6 +66,7 @@ namespace urchin
             std::set<std::shared_ptr<NavObject>> newOrMovingNavObjectsToRefresh, affectedNavObjectsToRefresh;
             std::set<std::shared_ptr<NavObject>> navObjectsToRefresh;
             std::set<std::pair<std::shared_ptr<NavObject>, std::shared_ptr<NavObject>>> navObjectsLinksToRefresh;
+            bool navObjectsRemoved;
             std::vector<CSGPolygon<float>> walkablePolygons;
             mutable std::vector<std::shared_ptr<NavObject>> nearObjects;
 
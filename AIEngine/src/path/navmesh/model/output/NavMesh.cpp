@@ -10,15 +10,21 @@ namespace urchin
 	unsigned int NavMesh::nextUpdateId = 0;
 
 	NavMesh::NavMesh() :
-        updateId(0)
+        updateId(0),
+        triangleGrid(std::make_shared<NavTriangleGrid>())
 	{
 
 	}
 
+	/**
+	 * Triangle grid is shared with the copied navigation mesh: copied triangles have the same IDs as the original triangles.
+	 */
 	NavMesh::NavMesh(const NavMesh &navMesh) :
-        updateId(navMesh.getUpdateId())
+        updateId(navMesh.getUpdateId()),
+        triangleGrid(navMesh.triangleGrid)
 	{
         NavModelCopy::copyNavPolygons(navMesh.getPolygons(), polygons);
+        indexTriangles();
 	}
 
 	unsigned int NavMesh::getUpdateId() const
@@ -32,6 +38,11 @@ namespace urchin
 
 	    polygons.clear();
 	    NavModelCopy::copyNavPolygons(allPolygons, polygons);
+	    indexTriangles();
+
+	    auto newTriangleGrid = std::make_shared<NavTriangleGrid>();
+	    newTriangleGrid->build(triangles);
+	    triangleGrid = newTriangleGrid;
 	}
 
 	const std::vector<std::shared_ptr<NavPolygon>> &NavMesh::getPolygons() const
@@ -39,6 +50,31 @@ namespace urchin
 		return polygons;
 	}
 
+	/**
+	 * @return Number of triangles of all polygons. Triangles are identified by a dense ID (see NavTriangle#getNavMeshId()) which
+	 * allows algorithms to store their data by triangle in flat arrays.
+	 */
+	unsigned int NavMesh::getNumberTriangles() const
+	{
+		return static_cast<unsigned int>(triangles.size());
+	}
+
+	/**
+	 * @return Triangles of all polygons indexed by their ID (see NavTriangle#getNavMeshId())
+	 */
+	const std::vector<std::shared_ptr<NavTriangle>> &NavMesh::getTriangles() const
+	{
+		return triangles;
+	}
+
+	/**
+	 * @return Spatial index of triangles on XZ plane allowing to quickly find the triangles located below/above a point
+	 */
+	const NavTriangleGrid &NavMesh::getTriangleGrid() const
+	{
+		return *triangleGrid;
+	}
+
 	void NavMesh::svgMeshExport(const std::string &filename) const
 	{
 		SVGExporter svgExporter(filename);
@@ -87,4 +123,17 @@ namespace urchin
         updateId = ++nextUpdateId;
         return updateId;
     }
+
+    void NavMesh::indexTriangles()
+    {
+        triangles.clear();
+        for(const auto &polygon : polygons)
+        {
+            for(const auto &triangle : polygon->getTriangles())
+            {
+                triangle->setNavMeshId(static_cast<unsigned int>(triangles.size()));
+                triangles.push_back(triangle);
+            }
+        }
+    }
 }
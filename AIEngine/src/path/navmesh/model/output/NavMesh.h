@@ -5,6 +5,7 @@
 #include <memory>
 
 #include "path/navmesh/model/output/NavPolygon.h"
+#include "path/navmesh/model/output/NavTriangleGrid.h"
 
 namespace urchin
 {
@@ -22,15 +23,21 @@ namespace urchin
 
             void copyAllPolygons(const std::vector<std::shared_ptr<NavPolygon>> &);
 			const std::vector<std::shared_ptr<NavPolygon>> &getPolygons() const;
+			unsigned int getNumberTriangles() const;
+			const std::vector<std::shared_ptr<NavTriangle>> &getTriangles() const;
+			const NavTriangleGrid &getTriangleGrid() const;
 
 			void svgMeshExport(const std::string &) const;
 		private:
 	        unsigned int changeUpdateId();
+	        void indexTriangles();
 
 			static unsigned int nextUpdateId;
 			unsigned int updateId;
 
 			std::vector<std::shared_ptr<NavPolygon>> polygons;
+			std::vector<std::shared_ptr<NavTriangle>> triangles;
+			std::shared_ptr<const NavTriangleGrid> triangleGrid; //immutable grid shared by the copies of the navigation mesh
 	};
 
 }
@@ -5,8 +5,13 @@
 namespace urchin
 {
 
+	//static
+	std::atomic_uint NavPolygon::nextId(1);
+
 	NavPolygon::NavPolygon(std::string name, std::vector<Point3<float>> &&points, std::shared_ptr<const NavTopography> navTopography) :
+			id(nextId.fetch_add(1, std::memory_order_relaxed)),
         	name(std::move(name)),
+			linksUpdateId(0),
 			points(std::move(points)),
 			navTopography(std::move(navTopography))
 	{
@@ -14,7 +19,9 @@ namespace urchin
 	}
 
 	NavPolygon::NavPolygon(const NavPolygon &navPolygon) :
+			id(navPolygon.getId()),
 			name(navPolygon.getName()),
+			linksUpdateId(navPolygon.getLinksUpdateId()),
 			points(navPolygon.getPoints()),
 			navTopography(navPolygon.getNavTopography())
 	{
@@ -24,11 +31,37 @@ namespace urchin
         }
 	}
 
+	/**
+	 * @return Identifier of the polygon. A new identifier is assigned to each generated polygon and the identifier is kept
+	 * by the copies of the polygon: polygons having the same identifier have the same points and triangles.
+	 */
+	unsigned int NavPolygon::getId() const
+	{
+		return id;
+	}
+
     const std::string &NavPolygon::getName() const
     {
         return name;
     }
 
+	/**
+	 * Change the links update identifier. Must be called when links toward other polygons are removed or added on an existing polygon.
+	 */
+	void NavPolygon::changeLinksUpdateId()
+	{
+		linksUpdateId++;
+	}
+
+	/**
+	 * @return Identifier changed each time the links toward other polygons are modified (see NavPolygon#changeLinksUpdateId()).
+	 * Polygons having the same identifier and the same links update identifier have the same links.
+	 */
+	unsigned int NavPolygon::getLinksUpdateId() const
+	{
+		return linksUpdateId;
+	}
+
 	const std::vector<Point3<float>> &NavPolygon::getPoints() const
 	{
 		return points;
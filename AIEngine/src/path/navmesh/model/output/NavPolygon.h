@@ -2,6 +2,7 @@
 #define URCHINENGINE_NAVPOLYGON_H
 
 #include <vector>
+#include <atomic>
 #include "UrchinCommon.h"
 
 #include "path/navmesh/model/output/NavTriangle.h"
@@ -17,8 +18,12 @@ namespace urchin
 			NavPolygon(std::string, std::vector<Point3<float>> &&, std::shared_ptr<const NavTopography>);
 			NavPolygon(const NavPolygon &);
 
+			unsigned int getId() const;
 			const std::string &getName() const;
 
+			void changeLinksUpdateId();
+			unsigned int getLinksUpdateId() const;
+
 			const std::vector<Point3<float>> &getPoints() const;
 			const Point3<float> &getPoint(unsigned int) const;
 
@@ -32,7 +37,10 @@ namespace urchin
             void removeLinksTo(const std::shared_ptr<NavPolygon> &);
 
 		private:
+			static std::atomic_uint nextId;
+			unsigned int id;
 			std::string name;
+			unsigned int linksUpdateId;
 
 			std::vector<Point3<float>> points;
 			std::vector<std::shared_ptr<NavTriangle>> triangles;
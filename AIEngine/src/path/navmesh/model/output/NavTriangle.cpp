@@ -10,7 +10,8 @@ namespace urchin
      * Indices of points in CCW order when looked from top
      */
     NavTriangle::NavTriangle(std::size_t index1, std::size_t index2, std::size_t index3) :
-            indices()
+            indices(),
+            navMeshId(0)
     {
         assert(index1!=index2 && index1!=index3 && index2!=index3);
 
@@ -24,7 +25,8 @@ namespace urchin
     }
 
     NavTriangle::NavTriangle(const NavTriangle &navTriangle) :
-            indices()
+            indices(),
+            navMeshId(0)
     {
         this->indices[0] = navTriangle.getIndex(0);
         this->indices[1] = navTriangle.getIndex(1);
@@ -55,6 +57,19 @@ namespace urchin
         return centerPoint;
     }
 
+    /**
+     * @param navMeshId Dense identifier of the triangle in the navigation mesh (from 0 to NavMesh#getNumberTriangles() excluded)
+     */
+    void NavTriangle::setNavMeshId(unsigned int navMeshId)
+    {
+        this->navMeshId = navMeshId;
+    }
+
+    unsigned int NavTriangle::getNavMeshId() const
+    {
+        return navMeshId;
+    }
+
     /**
      * @return Indices of points in CCW order when looked from top
      */
@@ -103,7 +118,7 @@ namespace urchin
                 }), links.end());
     }
 
-    std::vector<std::shared_ptr<NavLink>> NavTriangle::getLinks() const
+    const std::vector<std::shared_ptr<NavLink>> &NavTriangle::getLinks() const
     {
         return links;
     }
@@ -23,6 +23,9 @@ namespace urchin
             std::shared_ptr<NavPolygon> getNavPolygon() const;
             const Point3<float> &getCenterPoint() const;
 
+            void setNavMeshId(unsigned int);
+            unsigned int getNavMeshId() const;
+
             const std::size_t *getIndices() const;
             std::size_t getIndex(std::size_t) const;
 
@@ -31,7 +34,7 @@ namespace urchin
             void addJumpLink(std::size_t, const std::shared_ptr<NavTriangle> &, NavLinkConstraint *);
             void addLink(const std::shared_ptr<NavLink> &);
             void removeLinksTo(const std::shared_ptr<NavPolygon> &);
-            std::vector<std::shared_ptr<NavLink>> getLinks() const;
+            const std::vector<std::shared_ptr<NavLink>> &getLinks() const;
 
             bool hasEdgeLinks(std::size_t) const;
             bool isExternalEdge(std::size_t) const;
@@ -46,6 +49,7 @@ namespace urchin
             std::vector<std::shared_ptr<NavLink>> links;
 
             Point3<float> centerPoint;
+            unsigned int navMeshId;
     };
 
 }
@@ -0,0 +1,127 @@
+#include <cmath>
+#include <algorithm>
+
+#include "NavTriangleGrid.h"
+#include "path/navmesh/model/output/NavPolygon.h"
+
+#define MAX_CELLS_BY_AXIS 1024
+#define MIN_CELL_SIZE 0.01f
+
+namespace urchin
+{
+
+    NavTriangleGrid::NavTriangleGrid() :
+            cellSize(1.0f),
+            numberCellsX(0),
+            numberCellsZ(0)
+    {
+
+    }
+
+    /**
+     * Build the grid. Cell size is computed to have around one triangle by cell.
+     * @param triangles Triangles indexed by their ID (see NavTriangle#getNavMeshId())
+     */
+    void NavTriangleGrid::build(const std::vector<std::shared_ptr<NavTriangle>> &triangles)
+    {
+        cellFirstTriangles.clear();
+        cellTriangleIds.clear();
+        numberCellsX = 0;
+        numberCellsZ = 0;
+        if(triangles.empty())
+        {
+            return;
+        }
+
+        std::vector<Rectangle<float>> trianglesBounds;
+        trianglesBounds.reserve(triangles.size());
+        Point2<float> maxPoint(-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max());
+        minPoint = Point2<float>(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+        for(const auto &triangle : triangles)
+        {
+            std::shared_ptr<NavPolygon> polygon = triangle->getNavPolygon();
+            Point2<float> triangleMin(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+            Point2<float> triangleMax(-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max());
+            for(std::size_t i = 0; i < 3; ++i)
+            {
+                Point2<float> point = polygon->getPoint(triangle->getIndex(i)).toPoint2XZ();
+                triangleMin = Point2<float>(std::min(triangleMin.X, point.X), std::min(triangleMin.Y, point.Y));
+                triangleMax = Point2<float>(std::max(triangleMax.X, point.X), std::max(triangleMax.Y, point.Y));
+            }
+            trianglesBounds.emplace_back(Rectangle<float>(triangleMin, triangleMax));
+
+            minPoint = Point2<float>(std::min(minPoint.X, triangleMin.X), std::min(minPoint.Y, triangleMin.Y));
+            maxPoint = Point2<float>(std::max(maxPoint.X, triangleMax.X), std::max(maxPoint.Y, triangleMax.Y));
+        }
+
+        float sizeX = maxPoint.X - minPoint.X;
+        float sizeZ = maxPoint.Y - minPoint.Y;
+        cellSize = std::max(MIN_CELL_SIZE, std::sqrt(sizeX * sizeZ / (float)triangles.size()));
+        cellSize = std::max(cellSize, std::max(sizeX, sizeZ) / (float)MAX_CELLS_BY_AXIS);
+        numberCellsX = std::min((unsigned int)MAX_CELLS_BY_AXIS, static_cast<unsigned int>(sizeX / cellSize) + 1);
+        numberCellsZ = std::min((unsigned int)MAX_CELLS_BY_AXIS, static_cast<unsigned int>(sizeZ / cellSize) + 1);
+
+        //count triangles by cell then store triangle IDs contiguously by cell
+        cellFirstTriangles.resize(numberCellsX * numberCellsZ + 1, 0);
+        for(const auto &triangleBounds : trianglesBounds)
+        {
+            for(unsigned int z = computeCellZ(triangleBounds.getMin().Y); z <= computeCellZ(triangleBounds.getMax().Y); ++z)
+            {
+                for(unsigned int x = computeCellX(triangleBounds.getMin().X); x <= computeCellX(triangleBounds.getMax().X); ++x)
+                {
+                    cellFirstTriangles[z * numberCellsX + x + 1]++;
+                }
+            }
+        }
+        for(std::size_t i = 1; i < cellFirstTriangles.size(); ++i)
+        {
+            cellFirstTriangles[i] += cellFirstTriangles[i - 1];
+        }
+
+        cellTriangleIds.resize(cellFirstTriangles.back());
+        std::vector<unsigned int> cellInsertPositions(cellFirstTriangles.begin(), cellFirstTriangles.end() - 1);
+        for(std::size_t triangleId = 0; triangleId < trianglesBounds.size(); ++triangleId)
+        {
+            const Rectangle<float> &triangleBounds = trianglesBounds[triangleId];
+            for(unsigned int z = computeCellZ(triangleBounds.getMin().Y); z <= computeCellZ(triangleBounds.getMax().Y); ++z)
+            {
+                for(unsigned int x = computeCellX(triangleBounds.getMin().X); x <= computeCellX(triangleBounds.getMax().X); ++x)
+                {
+                    cellTriangleIds[cellInsertPositions[z * numberCellsX + x]++] = static_cast<unsigned int>(triangleId);
+                }
+            }
+        }
+    }
+
+    /**
+     * @param triangleIds [out] IDs of triangles which could contain the point on XZ plane, in ascending order
+     */
+    void NavTriangleGrid::pointQuery(const Point2<float> &point, std::vector<unsigned int> &triangleIds) const
+    {
+        if(numberCellsX == 0 || point.X < minPoint.X || point.Y < minPoint.Y)
+        {
+            return;
+        }
+
+        float maxX = minPoint.X + (float)numberCellsX * cellSize;
+        float maxZ = minPoint.Y + (float)numberCellsZ * cellSize;
+        if(point.X > maxX || point.Y > maxZ)
+        {
+            return;
+        }
+
+        unsigned int cellIndex = computeCellZ(point.Y) * numberCellsX + computeCellX(point.X); //point on max bound is in the last cell
+        triangleIds.insert(triangleIds.end(), cellTriangleIds.begin() + cellFirstTriangles[cellIndex], cellTriangleIds.begin() + cellFirstTriangles[cellIndex + 1]);
+    }
+
+    unsigned int NavTriangleGrid::computeCellX(float x) const
+    {
+        return std::min(numberCellsX - 1, static_cast<unsigned int>((x - minPoint.X) / cellSize));
+    }
+
+    unsigned int NavTriangleGrid::computeCellZ(float z) const
+    {
+        return std::min(numberCellsZ - 1, static_cast<unsigned int>((z - minPoint.Y) / cellSize));
+    }
+
+}
@@ -0,0 +1,41 @@
+#ifndef URCHINENGINE_NAVTRIANGLEGRID_H
+#define URCHINENGINE_NAVTRIANGLEGRID_H
+
+#include <vector>
+#include <memory>
+#include "UrchinCommon.h"
+
+#include "path/navmesh/model/output/NavTriangle.h"
+
+namespace urchin
+{
+
+    /**
+     * Uniform grid on XZ plane referencing the triangles overlapping each cell. Grid is immutable once built: it can be
+     * queried by several threads at the same time.
+     */
+    class NavTriangleGrid
+    {
+        public:
+            NavTriangleGrid();
+
+            void build(const std::vector<std::shared_ptr<NavTriangle>> &);
+
+            void pointQuery(const Point2<float> &, std::vector<unsigned int> &) const;
+
+        private:
+            unsigned int computeCellX(float) const;
+            unsigned int computeCellZ(float) const;
+
+            Point2<float> minPoint;
+            float cellSize;
+            unsigned int numberCellsX;
+            unsigned int numberCellsZ;
+
+            std::vector<unsigned int> cellFirstTriangles; //position of the first triangle ID of each cell in cellTriangleIds
+            std::vector<unsigned int> cellTriangleIds;
+    };
+
+}
+
+#endif
@@ -0,0 +1,178 @@
+#include <algorithm>
+
+#include "IncrementalFunnelAlgorithm.h"
+
+namespace urchin
+{
+
+    void IncrementalFunnelAlgorithm::startFunnel(PathNode &startNode, const Point3<float> &startPoint) const
+    {
+        PathNodeFunnel funnel;
+        funnel.portal = LineSegment3D<float>(startPoint, startPoint);
+        funnel.apex = startPoint;
+        funnel.leftPoint = startPoint;
+        funnel.rightPoint = startPoint;
+        funnel.lastTransitionPoint = startPoint;
+
+        startNode.setFunnel(funnel);
+    }
+
+    /**
+     * Extend the funnel of the previous node with the portal crossed to reach the node.
+     * @param node Node having a previous node
+     * @param portal Portal between previous node and node. First point (getA()) of portal must be on left of character when it cross the portal.
+     */
+    void IncrementalFunnelAlgorithm::addPortal(PathNode &node, const LineSegment3D<float> &portal)
+    {
+        assert(node.getPreviousNode() != nullptr);
+
+        PathNodeFunnel funnel = node.getPreviousNode()->getFunnel();
+        funnel.depth++;
+        funnel.portal = portal;
+        node.setFunnel(funnel);
+
+        if(funnel.leftDepth == funnel.apexDepth)
+        { //first portal after the apex
+            initializeFunnelSides(funnel, portal, funnel.depth);
+        }else if(updateFunnel(funnel, portal, funnel.depth))
+        { //apex moved: portals after the new apex must be processed again
+            replayPortalsFromApex(funnel, &node, nullptr);
+        }
+
+        node.setFunnel(funnel);
+    }
+
+    /**
+     * Add a point forced on the path between the previous node and the node (jump, topography change). The funnel is
+     * restarted from this point.
+     * @param node Node having a previous node
+     * @param transitionPoint Point forced on the path
+     * @param additionalCost Cost added when the transition point is reached (e.g.: jump cost)
+     * @param newApex First point of the path after the transition point (e.g.: jump landing point)
+     */
+    void IncrementalFunnelAlgorithm::addTransitionPoint(PathNode &node, const Point3<float> &transitionPoint, float additionalCost, const Point3<float> &newApex)
+    {
+        assert(node.getPreviousNode() != nullptr);
+
+        float transitionPointCost = computeCost(*node.getPreviousNode(), transitionPoint);
+
+        PathNodeFunnel funnel = node.getPreviousNode()->getFunnel();
+        funnel.depth++;
+        funnel.portal = LineSegment3D<float>(newApex, newApex);
+        funnel.apex = newApex;
+        funnel.apexCost = transitionPointCost + additionalCost + transitionPoint.distance(newApex);
+        funnel.apexDepth = funnel.depth;
+        funnel.leftDepth = funnel.depth;
+        funnel.rightDepth = funnel.depth;
+        funnel.lastTransitionPoint = newApex;
+
+        node.setFunnel(funnel);
+    }
+
+    /**
+     * @return Cost of the path from the start point to the end point where the end point is inside the node
+     */
+    float IncrementalFunnelAlgorithm::computeCost(const PathNode &node, const Point3<float> &endPoint)
+    {
+        PathNodeFunnel funnel = node.getFunnel();
+        if(funnel.leftDepth != funnel.apexDepth)
+        {
+            LineSegment3D<float> endPortal(endPoint, endPoint);
+            if(updateFunnel(funnel, endPortal, funnel.depth + 1))
+            {
+                replayPortalsFromApex(funnel, &node, &endPortal);
+            }
+        }
+
+        return funnel.apexCost + funnel.apex.distance(endPoint);
+    }
+
+    /**
+     * @return True when the apex has been moved
+     */
+    bool IncrementalFunnelAlgorithm::updateFunnel(PathNodeFunnel &funnel, const LineSegment3D<float> &portal, unsigned int portalDepth) const
+    {
+        return updateFunnelSide(funnel, FunnelSide::LEFT, portal.getA(), portalDepth)
+               || updateFunnelSide(funnel, FunnelSide::RIGHT, portal.getB(), portalDepth);
+    }
+
+    /**
+     * Same logic as FunnelAlgorithm#updateFunnelSide
+     * @return True when the apex has been moved on the point of the other side
+     */
+    bool IncrementalFunnelAlgorithm::updateFunnelSide(PathNodeFunnel &funnel, FunnelSide updateSide, const Point3<float> &newPoint, unsigned int newDepth) const
+    {
+        Point3<float> &sidePoint = (updateSide==FunnelSide::LEFT) ? funnel.leftPoint : funnel.rightPoint;
+        unsigned int &sideDepth = (updateSide==FunnelSide::LEFT) ? funnel.leftDepth : funnel.rightDepth;
+        const Point3<float> &otherSidePoint = (updateSide==FunnelSide::LEFT) ? funnel.rightPoint : funnel.leftPoint;
+        unsigned int otherSideDepth = (updateSide==FunnelSide::LEFT) ? funnel.rightDepth : funnel.leftDepth;
+
+        if(newPoint != sidePoint && newDepth > sideDepth)
+        { //not same point as previous
+            Vector3<float> currentSide = funnel.apex.vector(sidePoint);
+            Vector3<float> newSide = funnel.apex.vector(newPoint);
+
+            float crossProductY = currentSide.Z*newSide.X - currentSide.X*newSide.Z;
+            if((updateSide==FunnelSide::LEFT && crossProductY <= 0.0) || (updateSide==FunnelSide::RIGHT && crossProductY >= 0.0))
+            { //funnel not enlarged
+                Vector3<float> currentOtherSide = funnel.apex.vector(otherSidePoint);
+
+                crossProductY = currentOtherSide.Z*newSide.X - currentOtherSide.X*newSide.Z;
+                if((updateSide==FunnelSide::LEFT && crossProductY >= 0.0) || (updateSide==FunnelSide::RIGHT && crossProductY <= 0.0))
+                { //no cross with other side
+                    sidePoint = newPoint;
+                    sideDepth = newDepth;
+                }else
+                { //cross with other side: apex moved on other side point
+                    funnel.apexCost += funnel.apex.distance(otherSidePoint);
+                    funnel.apex = otherSidePoint;
+                    funnel.apexDepth = otherSideDepth;
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+    void IncrementalFunnelAlgorithm::initializeFunnelSides(PathNodeFunnel &funnel, const LineSegment3D<float> &portal, unsigned int portalDepth) const
+    {
+        funnel.leftPoint = portal.getA();
+        funnel.leftDepth = portalDepth;
+        funnel.rightPoint = portal.getB();
+        funnel.rightDepth = portalDepth;
+    }
+
+    /**
+     * Process again the portals located after the apex. Portals are retrieved from the previous nodes.
+     * @param lastNode Last node of the path. Its funnel must contain its portal.
+     * @param endPortal Portal processed after the portal of the last node (optional)
+     */
+    void IncrementalFunnelAlgorithm::replayPortalsFromApex(PathNodeFunnel &funnel, const PathNode *lastNode, const LineSegment3D<float> *endPortal)
+    {
+        unsigned int firstDepth = funnel.apexDepth + 1;
+
+        replayPortals.clear();
+        if(endPortal)
+        {
+            replayPortals.push_back(*endPortal);
+        }
+        for(const PathNode *pathNode = lastNode; pathNode && pathNode->getFunnel().depth >= firstDepth; pathNode = pathNode->getPreviousNode())
+        {
+            replayPortals.push_back(pathNode->getFunnel().portal);
+        }
+        std::reverse(replayPortals.begin(), replayPortals.end());
+
+        initializeFunnelSides(funnel, replayPortals[0], firstDepth);
+        for(std::size_t i = 1; i < replayPortals.size(); ++i)
+        {
+            if(updateFunnel(funnel, replayPortals[i], firstDepth + static_cast<unsigned int>(i)))
+            {
+                auto sidesIndex = static_cast<std::size_t>(funnel.apexDepth + 1 - firstDepth);
+                initializeFunnelSides(funnel, replayPortals[sidesIndex], funnel.apexDepth + 1);
+                i = sidesIndex;
+            }
+        }
+    }
+
+}
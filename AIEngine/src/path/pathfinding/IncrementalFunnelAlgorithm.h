@@ -0,0 +1,43 @@
+#ifndef URCHINENGINE_INCREMENTALFUNNELALGORITHM_H
+#define URCHINENGINE_INCREMENTALFUNNELALGORITHM_H
+
+#include <vector>
+#include "UrchinCommon.h"
+
+#include "path/pathfinding/PathNode.h"
+
+namespace urchin
+{
+
+    /**
+     * Funnel algorithm executed portal after portal: funnel state is stored on each path node (see PathNodeFunnel) and
+     * extended when a neighbor node is reached. Produce same path length as FunnelAlgorithm.
+     */
+    class IncrementalFunnelAlgorithm
+    {
+        public:
+            void startFunnel(PathNode &, const Point3<float> &) const;
+            void addPortal(PathNode &, const LineSegment3D<float> &);
+            void addTransitionPoint(PathNode &, const Point3<float> &, float, const Point3<float> &);
+
+            float computeCost(const PathNode &, const Point3<float> &);
+
+        private:
+            enum FunnelSide
+            {
+                LEFT,
+                RIGHT
+            };
+
+            bool updateFunnel(PathNodeFunnel &, const LineSegment3D<float> &, unsigned int) const;
+            bool updateFunnelSide(PathNodeFunnel &, FunnelSide, const Point3<float> &, unsigned int) const;
+            void initializeFunnelSides(PathNodeFunnel &, const LineSegment3D<float> &, unsigned int) const;
+
+            void replayPortalsFromApex(PathNodeFunnel &, const PathNode *, const LineSegment3D<float> *);
+
+            std::vector<LineSegment3D<float>> replayPortals;
+    };
+
+}
+
+#endif
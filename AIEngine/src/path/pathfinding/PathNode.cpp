@@ -1,19 +1,20 @@
 #include <cassert>
-#include <utility>
 
 #include "PathNode.h"
 
 namespace urchin
 {
-    PathNode::PathNode(std::shared_ptr<NavTriangle> navTriangle, float gScore, float hScore) :
-            navTriangle(std::move(navTriangle)),
+    PathNode::PathNode(const NavTriangle *navTriangle, float gScore, float hScore) :
+            navTriangle(navTriangle),
             gScore(gScore),
-            hScore(hScore)
+            hScore(hScore),
+            previousNode(nullptr),
+            navLink(nullptr)
     {
 
     }
 
-    const std::shared_ptr<NavTriangle> &PathNode::getNavTriangle() const
+    const NavTriangle *PathNode::getNavTriangle() const
     {
         return navTriangle;
     }
@@ -38,7 +39,7 @@ namespace urchin
         return gScore + hScore;
     }
 
-    void PathNode::setPreviousNode(const std::shared_ptr<PathNode> &previousNode, const std::shared_ptr<NavLink> &navLink)
+    void PathNode::setPreviousNode(const PathNode *previousNode, const NavLink *navLink)
     {
         assert(previousNode != nullptr);
         assert(navLink != nullptr);
@@ -47,7 +48,7 @@ namespace urchin
         this->navLink = navLink;
     }
 
-    const std::shared_ptr<PathNode> &PathNode::getPreviousNode() const
+    const PathNode *PathNode::getPreviousNode() const
     {
         return previousNode;
     }
@@ -95,4 +96,14 @@ namespace urchin
         throw std::runtime_error("Unknown link type: " + std::to_string(navLink->getLinkType()));
     }
 
+    void PathNode::setFunnel(const PathNodeFunnel &funnel)
+    {
+        this->funnel = funnel;
+    }
+
+    const PathNodeFunnel &PathNode::getFunnel() const
+    {
+        return funnel;
+    }
+
 }
@@ -1,8 +1,6 @@
 #ifndef URCHINENGINE_PATHNODE_H
 #define URCHINENGINE_PATHNODE_H
 
-#include <memory>
-
 #include "path/navmesh/model/output/NavTriangle.h"
 
 namespace urchin
@@ -18,30 +16,60 @@ namespace urchin
         bool areIdenticalEdges = true;
     };
 
+    /**
+     * Funnel of the path from the start point to a node. Cost of the path up to the funnel apex is known and funnel sides
+     * allow to extend the path with a new portal without executing again the funnel algorithm from the start point.
+     */
+    struct PathNodeFunnel
+    {
+        unsigned int depth = 0; //number of portals crossed from the start point
+        LineSegment3D<float> portal; //portal crossed to reach the node (first point on the left)
+
+        Point3<float> apex;
+        float apexCost = 0.0f;
+        unsigned int apexDepth = 0;
+
+        Point3<float> leftPoint;
+        unsigned int leftDepth = 0;
+        Point3<float> rightPoint;
+        unsigned int rightDepth = 0;
+
+        Point3<float> lastTransitionPoint; //last point added on a jump or on a topography change
+    };
+
+    /**
+     * Node of the path finding search. Nodes are stored in a flat arena owned by the search: previous node and link are
+     * non-owning pointers valid during the search.
+     */
     class PathNode
     {
         public:
-            PathNode(std::shared_ptr<NavTriangle>, float, float);
+            PathNode(const NavTriangle *, float, float);
 
-            const std::shared_ptr<NavTriangle> &getNavTriangle() const;
+            const NavTriangle *getNavTriangle() const;
 
             void setGScore(float);
             float getGScore() const;
             float getHScore() const;
             float getFScore() const;
 
-            void setPreviousNode(const std::shared_ptr<PathNode> &, const std::shared_ptr<NavLink> &);
-            const std::shared_ptr<PathNode> &getPreviousNode() const;
+            void setPreviousNode(const PathNode *, const NavLink *);
+            const PathNode *getPreviousNode() const;
             PathNodeEdgesLink computePathNodeEdgesLink() const;
 
+            void setFunnel(const PathNodeFunnel &);
+            const PathNodeFunnel &getFunnel() const;
+
         private:
-            std::shared_ptr<NavTriangle> navTriangle;
+            const NavTriangle *navTriangle;
 
             float gScore;
             float hScore;
 
-            std::shared_ptr<PathNode> previousNode;
-            std::shared_ptr<NavLink> navLink; //link between previousNode and this
+            const PathNode *previousNode;
+            const NavLink *navLink; //link between previousNode and this
+
+            PathNodeFunnel funnel;
     };
 
 }
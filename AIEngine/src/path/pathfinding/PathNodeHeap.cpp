@@ -0,0 +1,150 @@
+#include <cassert>
+#include <limits>
+#include <algorithm>
+
+#include "PathNodeHeap.h"
+
+#define HEAP_ARITY 4
+
+namespace urchin
+{
+
+    //static
+    const unsigned int PathNodeHeap::NOT_IN_HEAP = std::numeric_limits<unsigned int>::max();
+
+    PathNodeHeap::PathNodeHeap() :
+            nextSequence(0)
+    {
+
+    }
+
+    /**
+     * Empty the heap and prepare it to store nodes from 0 to 'numberNodes' excluded. Memory is kept between two resets.
+     */
+    void PathNodeHeap::reset(std::size_t numberNodes)
+    {
+        for(const auto &heapEntry : heap)
+        {
+            positions[heapEntry.nodeIndex] = NOT_IN_HEAP;
+        }
+        heap.clear();
+        positions.resize(numberNodes, NOT_IN_HEAP);
+        nextSequence = 0;
+    }
+
+    bool PathNodeHeap::isEmpty() const
+    {
+        return heap.empty();
+    }
+
+    bool PathNodeHeap::contains(unsigned int nodeIndex) const
+    {
+        assert(nodeIndex < positions.size());
+
+        return positions[nodeIndex] != NOT_IN_HEAP;
+    }
+
+    void PathNodeHeap::push(unsigned int nodeIndex, float fScore)
+    {
+        assert(!contains(nodeIndex));
+
+        heap.push_back({fScore, nextSequence++, nodeIndex});
+        positions[nodeIndex] = static_cast<unsigned int>(heap.size() - 1);
+        siftUp(heap.size() - 1);
+    }
+
+    void PathNodeHeap::decreaseKey(unsigned int nodeIndex, float fScore)
+    {
+        assert(contains(nodeIndex));
+
+        std::size_t position = positions[nodeIndex];
+        assert(fScore <= heap[position].fScore);
+
+        heap[position].fScore = fScore;
+        siftUp(position);
+    }
+
+    /**
+     * @return Index of the node having the smallest score
+     */
+    unsigned int PathNodeHeap::pop()
+    {
+        assert(!isEmpty());
+
+        unsigned int nodeIndex = heap[0].nodeIndex;
+        positions[nodeIndex] = NOT_IN_HEAP;
+
+        HeapEntry lastEntry = heap.back();
+        heap.pop_back();
+        if(!heap.empty())
+        {
+            placeEntry(0, lastEntry);
+            siftDown(0);
+        }
+
+        return nodeIndex;
+    }
+
+    bool PathNodeHeap::isLess(const HeapEntry &entry1, const HeapEntry &entry2) const
+    {
+        if(entry1.fScore != entry2.fScore)
+        {
+            return entry1.fScore < entry2.fScore;
+        }
+        return entry1.sequence < entry2.sequence;
+    }
+
+    void PathNodeHeap::siftUp(std::size_t position)
+    {
+        HeapEntry entry = heap[position];
+        while(position > 0)
+        {
+            std::size_t parentPosition = (position - 1) / HEAP_ARITY;
+            if(!isLess(entry, heap[parentPosition]))
+            {
+                break;
+            }
+            placeEntry(position, heap[parentPosition]);
+            position = parentPosition;
+        }
+        placeEntry(position, entry);
+    }
+
+    void PathNodeHeap::siftDown(std::size_t position)
+    {
+        HeapEntry entry = heap[position];
+        while(true)
+        {
+            std::size_t firstChildPosition = position * HEAP_ARITY + 1;
+            if(firstChildPosition >= heap.size())
+            {
+                break;
+            }
+
+            std::size_t smallestChildPosition = firstChildPosition;
+            std::size_t endChildPosition = std::min(firstChildPosition + HEAP_ARITY, heap.size());
+            for(std::size_t childPosition = firstChildPosition + 1; childPosition < endChildPosition; ++childPosition)
+            {
+                if(isLess(heap[childPosition], heap[smallestChildPosition]))
+                {
+                    smallestChildPosition = childPosition;
+                }
+            }
+
+            if(!isLess(heap[smallestChildPosition], entry))
+            {
+                break;
+            }
+            placeEntry(position, heap[smallestChildPosition]);
+            position = smallestChildPosition;
+        }
+        placeEntry(position, entry);
+    }
+
+    void PathNodeHeap::placeEntry(std::size_t position, const HeapEntry &entry)
+    {
+        heap[position] = entry;
+        positions[entry.nodeIndex] = static_cast<unsigned int>(position);
+    }
+
+}
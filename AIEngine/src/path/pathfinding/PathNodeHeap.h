@@ -0,0 +1,50 @@
+#ifndef URCHINENGINE_PATHNODEHEAP_H
+#define URCHINENGINE_PATHNODEHEAP_H
+
+#include <vector>
+#include <cstdint>
+
+namespace urchin
+{
+
+    /**
+     * Indexed d-ary min-heap of path nodes identified by a dense index. Position of each node in the heap is known which
+     * allows to check if a node is in the heap and to decrease its key in O(log n).
+     */
+    class PathNodeHeap
+    {
+        public:
+            PathNodeHeap();
+
+            void reset(std::size_t);
+
+            bool isEmpty() const;
+            bool contains(unsigned int) const;
+
+            void push(unsigned int, float);
+            void decreaseKey(unsigned int, float);
+            unsigned int pop();
+
+        private:
+            struct HeapEntry
+            {
+                float fScore;
+                uint64_t sequence; //nodes having same score are popped in their insertion order
+                unsigned int nodeIndex;
+            };
+
+            bool isLess(const HeapEntry &, const HeapEntry &) const;
+            void siftUp(std::size_t);
+            void siftDown(std::size_t);
+            void placeEntry(std::size_t, const HeapEntry &);
+
+            static const unsigned int NOT_IN_HEAP;
+
+            std::vector<HeapEntry> heap;
+            std::vector<unsigned int> positions;
+            uint64_t nextSequence;
+    };
+
+}
+
+#endif
@@ -6,10 +6,10 @@
 namespace urchin
 {
 
-    PathPortal::PathPortal(LineSegment3D<float> portal, std::shared_ptr<PathNode> previousPathNode, std::shared_ptr<PathNode> nextPathNode, bool bIsJumpOriginPortal) :
+    PathPortal::PathPortal(LineSegment3D<float> portal, const PathNode *previousPathNode, const PathNode *nextPathNode, bool bIsJumpOriginPortal) :
         portal(std::move(portal)),
-        previousPathNode(std::move(previousPathNode)),
-        nextPathNode(std::move(nextPathNode)),
+        previousPathNode(previousPathNode),
+        nextPathNode(nextPathNode),
         bHasTransitionPoint(false),
         bIsJumpOriginPortal(bIsJumpOriginPortal)
     {
@@ -52,12 +52,12 @@ namespace urchin
         return portal;
     }
 
-    const std::shared_ptr<PathNode> &PathPortal::getPreviousPathNode() const
+    const PathNode *PathPortal::getPreviousPathNode() const
     {
         return previousPathNode;
     }
 
-    const std::shared_ptr<PathNode> &PathPortal::getNextPathNode() const
+    const PathNode *PathPortal::getNextPathNode() const
     {
         return nextPathNode;
     }
@@ -7,78 +7,130 @@
 namespace urchin
 {
 
-    bool PathNodeCompare::operator()(const std::shared_ptr<PathNode> &node1, const std::shared_ptr<PathNode> &node2) const
+    PathfindingAStar::PathfindingAStar(std::shared_ptr<NavMesh> navMesh) :
+            jumpAdditionalCost(ConfigService::instance()->getFloatValue("pathfinding.jumpAdditionalCost")),
+            navMesh(std::move(navMesh)),
+            incrementalGScore(true),
+            polygonGraph(nullptr),
+            queryId(0)
     {
-        return node1->getFScore() < node2->getFScore();
+
     }
 
-    PathfindingAStar::PathfindingAStar(std::shared_ptr<NavMesh> navMesh) :
-            jumpAdditionalCost(ConfigService::instance()->getFloatValue("pathfinding.jumpAdditionalCost")),
-            navMesh(std::move(navMesh))
+    /**
+     * @param incrementalGScore True to compute the G score by extending the funnel of the previous node (default). False to
+     * execute the funnel algorithm from the start point for each G score.
+     */
+    void PathfindingAStar::setIncrementalGScore(bool incrementalGScore)
     {
+        this->incrementalGScore = incrementalGScore;
+    }
 
+    /**
+     * @param polygonGraph Graph of the polygons used to restrict the search to a corridor of polygons (hierarchical search).
+     * Graph is only used when it has been updated with the current state of the navigation mesh. Null value disables the
+     * hierarchical search (default).
+     */
+    void PathfindingAStar::setPolygonGraph(const NavPolygonGraph *polygonGraph)
+    {
+        this->polygonGraph = polygonGraph;
     }
 
-    std::vector<PathPoint> PathfindingAStar::findPath(const Point3<float> &startPoint, const Point3<float> &endPoint) const
+    std::vector<PathPoint> PathfindingAStar::findPath(const Point3<float> &startPoint, const Point3<float> &endPoint)
     {
         ScopeProfiler scopeProfiler("ai", "findPath");
 
-        std::shared_ptr<NavTriangle> startTriangle = findTriangle(startPoint);
-        std::shared_ptr<NavTriangle> endTriangle = findTriangle(endPoint);
+        const NavTriangle *startTriangle = findTriangle(startPoint);
+        const NavTriangle *endTriangle = findTriangle(endPoint);
         if(!startTriangle || !endTriangle)
         {
             return {}; //no path exists
         }
 
-        float startEndHScore = computeHScore(startTriangle, endPoint);
+        if(polygonGraph && polygonGraph->getNavMeshUpdateId() == navMesh->getUpdateId())
+        { //search a corridor of polygons and refine the path inside the corridor
+            if(polygonCorridorSearch.findCorridor(*polygonGraph, startTriangle, startPoint, endTriangle, endPoint, corridorPolygonIndices))
+            {
+                std::vector<PathPoint> corridorPath = searchPath(startTriangle, startPoint, endTriangle, endPoint, true);
+                if(!corridorPath.empty())
+                {
+                    return corridorPath;
+                }
+            }
+        }
 
-        std::set<NavTriangle *> closedList;
-        std::multiset<std::shared_ptr<PathNode>, PathNodeCompare> openList;
-        openList.insert(std::make_shared<PathNode>(startTriangle, 0.0, startEndHScore));
+        return searchPath(startTriangle, startPoint, endTriangle, endPoint, false);
+    }
 
-        std::shared_ptr<PathNode> endNodePath = nullptr;
-        while(!openList.empty())
+    /**
+     * @param inCorridor True to only search on the triangles of the polygons of the corridor (see corridorPolygonIndices)
+     */
+    std::vector<PathPoint> PathfindingAStar::searchPath(const NavTriangle *startTriangle, const Point3<float> &startPoint,
+            const NavTriangle *endTriangle, const Point3<float> &endPoint, bool inCorridor)
+    {
+        resetSearchMemory();
+        if(inCorridor)
         {
-            auto currentNodeIt = openList.begin(); //node with smallest fScore
-            std::shared_ptr<PathNode> currentNode = *currentNodeIt;
+            for(unsigned int polygonIndex : corridorPolygonIndices)
+            {
+                for(const auto &triangle : navMesh->getPolygons()[polygonIndex]->getTriangles())
+                {
+                    corridorQueryIds[triangle->getNavMeshId()] = queryId;
+                }
+            }
+        }
+
+        float startEndHScore = computeHScore(startTriangle, endPoint);
+        PathNode *startNode = createPathNode(startTriangle, 0.0, startEndHScore);
+        incrementalFunnelAlgorithm.startFunnel(*startNode, startPoint);
+        openList.push(startTriangle->getNavMeshId(), startNode->getFScore());
 
-            closedList.insert(currentNode->getNavTriangle().get());
-            openList.erase(currentNodeIt);
+        const PathNode *endNodePath = nullptr;
+        while(!openList.isEmpty())
+        {
+            unsigned int currentNodeId = openList.pop(); //node with smallest fScore
+            const PathNode *currentNode = &pathNodes[currentNodeId];
+            closedQueryIds[currentNodeId] = queryId;
 
-            const auto &currTriangle = currentNode->getNavTriangle();
-            for(const auto &link : currTriangle->getLinks())
+            for(const auto &link : currentNode->getNavTriangle()->getLinks())
             {
-                auto neighborTriangle = link->getTargetTriangle();
+                const NavTriangle *neighborTriangle = link->getTargetTriangle().get();
+                unsigned int neighborNodeId = neighborTriangle->getNavMeshId();
 
-                if(closedList.find(neighborTriangle.get())!=closedList.end())
-                { //already processed
+                if(isClosed(neighborNodeId) || (inCorridor && corridorQueryIds[neighborNodeId] != queryId))
+                { //already processed or outside the corridor
                     continue;
                 }
 
-                std::shared_ptr<PathNode> neighborNodePath = retrievePathNodeFrom(openList, neighborTriangle);
-                if(!neighborNodePath)
+                PathNode neighborNodeCandidate(neighborTriangle, 0.0f, 0.0f);
+                neighborNodeCandidate.setPreviousNode(currentNode, link.get());
+                float gScore = computeGScore(neighborNodeCandidate, startPoint);
+
+                if(!openList.contains(neighborNodeId))
                 {
-                    float gScore = computeGScore(currentNode, link, startPoint);
                     float hScore = computeHScore(neighborTriangle, endPoint);
-                    neighborNodePath.reset(new PathNode(neighborTriangle, gScore, hScore));
-                    neighborNodePath->setPreviousNode(currentNode, link);
+                    PathNode *neighborNodePath = createPathNode(neighborTriangle, gScore, hScore);
+                    neighborNodePath->setPreviousNode(currentNode, link.get());
+                    neighborNodePath->setFunnel(neighborNodeCandidate.getFunnel());
 
                     if(!endNodePath || neighborNodePath->getFScore() < endNodePath->getFScore())
                     {
-                        openList.insert(neighborNodePath);
+                        openList.push(neighborNodeId, neighborNodePath->getFScore());
                     }
 
-                    if(neighborTriangle.get() == endTriangle.get())
+                    if(neighborTriangle == endTriangle)
                     { //end triangle reached but continue on path nodes having a smaller F score
                         endNodePath = neighborNodePath;
                     }
                 }else
                 {
-                    float gScore = computeGScore(currentNode, link, startPoint);
+                    PathNode *neighborNodePath = &pathNodes[neighborNodeId];
                     if(neighborNodePath->getGScore() > gScore)
                     { //better path found to reach neighborNodePath: override previous values
                         neighborNodePath->setGScore(gScore);
-                        neighborNodePath->setPreviousNode(currentNode, link);
+                        neighborNodePath->setPreviousNode(currentNode, link.get());
+                        neighborNodePath->setFunnel(neighborNodeCandidate.getFunnel());
+                        openList.decreaseKey(neighborNodeId, neighborNodePath->getFScore());
                     }
                 }
             }
@@ -93,33 +145,35 @@ namespace urchin
         return {}; //no path exists
     }
 
-    std::shared_ptr<NavTriangle> PathfindingAStar::findTriangle(const Point3<float> &point) const
+    /**
+     * @return Highest triangle located below the point
+     */
+    const NavTriangle *PathfindingAStar::findTriangle(const Point3<float> &point)
     {
         float bestVerticalDistance = std::numeric_limits<float>::max();
-        std::shared_ptr<NavTriangle> result = nullptr;
+        const NavTriangle *result = nullptr;
 
-        for (const auto &polygon : navMesh->getPolygons())
+        Point2<float> flattenPoint(point.X, point.Z);
+        candidateTriangleIds.clear();
+        navMesh->getTriangleGrid().pointQuery(flattenPoint, candidateTriangleIds);
+
+        for (unsigned int triangleId : candidateTriangleIds)
         {
-            for (std::size_t triIndex = 0; triIndex < polygon->getTriangles().size(); ++triIndex)
+            const NavTriangle *triangle = navMesh->getTriangles()[triangleId].get();
+            if (isPointInsideTriangle(flattenPoint, triangle->getNavPolygon().get(), triangle))
             {
-                const auto &triangle = polygon->getTriangles()[triIndex];
-                Point2<float> flattenPoint(point.X, point.Z);
-
-                if (isPointInsideTriangle(flattenPoint, polygon, triangle))
+                float verticalDistance = point.Y - triangle->getCenterPoint().Y;
+                if (verticalDistance >= 0.0 && verticalDistance < bestVerticalDistance)
                 {
-                    float verticalDistance = point.Y - triangle->getCenterPoint().Y;
-                    if (verticalDistance >= 0.0 && verticalDistance < bestVerticalDistance)
-                    {
-                        bestVerticalDistance = verticalDistance;
-                        result = triangle;
-                    }
+                    bestVerticalDistance = verticalDistance;
+                    result = triangle;
                 }
             }
         }
         return result;
     }
 
-    bool PathfindingAStar::isPointInsideTriangle(const Point2<float> &point, const std::shared_ptr<NavPolygon> &polygon, const std::shared_ptr<NavTriangle> &triangle) const
+    bool PathfindingAStar::isPointInsideTriangle(const Point2<float> &point, const NavPolygon *polygon, const NavTriangle *triangle) const
     {
         Point3<float> p0 = polygon->getPoint(triangle->getIndex(0));
         Point3<float> p1 = polygon->getPoint(triangle->getIndex(1));
@@ -137,27 +191,87 @@ namespace urchin
         return (p1.X - p3.X) * (p2.Y - p3.Y) - (p2.X - p3.X) * (p1.Y - p3.Y);
     }
 
-    std::shared_ptr<PathNode> PathfindingAStar::retrievePathNodeFrom(const std::multiset<std::shared_ptr<PathNode>, PathNodeCompare> &pathNodes,
-                                                                     const std::shared_ptr<NavTriangle> &navTriangle) const
+    /**
+     * Prepare the search memory for a new query. Memory is allocated only when the navigation mesh grows and the closed
+     * list is emptied in constant time thanks to the query ID.
+     */
+    void PathfindingAStar::resetSearchMemory()
     {
-        for(const auto &pathNode : pathNodes)
+        unsigned int numberTriangles = navMesh->getNumberTriangles();
+        if(pathNodes.size() != numberTriangles)
         {
-            if(pathNode->getNavTriangle().get() == navTriangle.get())
-            {
-                return pathNode;
-            }
+            pathNodes.resize(numberTriangles, PathNode(nullptr, 0.0f, 0.0f));
+            closedQueryIds.resize(numberTriangles, 0);
+            corridorQueryIds.resize(numberTriangles, 0);
         }
-        return std::shared_ptr<PathNode>();
+        openList.reset(numberTriangles);
+
+        if(++queryId == 0)
+        { //query ID overflow
+            std::fill(closedQueryIds.begin(), closedQueryIds.end(), 0);
+            std::fill(corridorQueryIds.begin(), corridorQueryIds.end(), 0);
+            queryId = 1;
+        }
+    }
+
+    bool PathfindingAStar::isClosed(unsigned int nodeId) const
+    {
+        return closedQueryIds[nodeId] == queryId;
+    }
+
+    PathNode *PathfindingAStar::createPathNode(const NavTriangle *navTriangle, float gScore, float hScore)
+    {
+        PathNode *pathNode = &pathNodes[navTriangle->getNavMeshId()];
+        *pathNode = PathNode(navTriangle, gScore, hScore);
+        return pathNode;
+    }
+
+    /**
+     * Compute score from 'startPoint' to center of the node triangle
+     * @param node Node having a previous node. Its funnel is updated when incremental G score is used.
+     */
+    float PathfindingAStar::computeGScore(PathNode &node, const Point3<float> &startPoint)
+    {
+        if(incrementalGScore)
+        {
+            return computeIncrementalGScore(node);
+        }
+        return computeFunnelGScore(node, startPoint);
+    }
+
+    /**
+     * Compute score by extending the funnel of the previous node with the portal crossed to reach the node. Jumps and
+     * topography changes add a transition point on their portal as done by PathfindingAStar#addMissingTransitionPoints.
+     */
+    float PathfindingAStar::computeIncrementalGScore(PathNode &node)
+    {
+        const PathNode *previousNode = node.getPreviousNode();
+        PathNodeEdgesLink pathNodeEdgesLink = node.computePathNodeEdgesLink();
+
+        if(!pathNodeEdgesLink.areIdenticalEdges)
+        { //jump
+            Point3<float> jumpStartPoint = pathNodeEdgesLink.sourceEdge.closestPoint(previousNode->getFunnel().lastTransitionPoint);
+            Point3<float> jumpEndPoint = pathNodeEdgesLink.targetEdge.closestPoint(jumpStartPoint);
+            incrementalFunnelAlgorithm.addTransitionPoint(node, jumpStartPoint, jumpAdditionalCost, jumpEndPoint);
+        }else if(previousNode->getNavTriangle()->getNavPolygon()->getNavTopography() != node.getNavTriangle()->getNavPolygon()->getNavTopography())
+        {
+            Point3<float> transitionPoint = pathNodeEdgesLink.targetEdge.closestPoint(previousNode->getFunnel().lastTransitionPoint);
+            incrementalFunnelAlgorithm.addTransitionPoint(node, transitionPoint, 0.0f, transitionPoint);
+        }else
+        { //edge points are in CCW order of the previous triangle: second point is on left of character when it leaves the triangle
+            const LineSegment3D<float> &edge = pathNodeEdgesLink.targetEdge;
+            incrementalFunnelAlgorithm.addPortal(node, LineSegment3D<float>(edge.getB(), edge.getA()));
+        }
+
+        return incrementalFunnelAlgorithm.computeCost(node, node.getNavTriangle()->getCenterPoint());
     }
 
     /**
-     * Compute score from 'startPoint to 'link'
+     * Compute score by executing the funnel algorithm from the start point
      */
-    float PathfindingAStar::computeGScore(const std::shared_ptr<PathNode> &currentNode, const std::shared_ptr<NavLink> &link, const Point3<float> &startPoint) const
+    float PathfindingAStar::computeFunnelGScore(const PathNode &node, const Point3<float> &startPoint) const
     {
-        std::shared_ptr<PathNode> neighborNodePath = std::make_shared<PathNode>(link->getTargetTriangle(), 0.0f, 0.0f);
-        neighborNodePath->setPreviousNode(currentNode, link);
-        std::vector<std::shared_ptr<PathPortal>> pathPortals = determinePath(neighborNodePath, startPoint, link->getTargetTriangle()->getCenterPoint());
+        std::vector<std::shared_ptr<PathPortal>> pathPortals = determinePath(&node, startPoint, node.getNavTriangle()->getCenterPoint());
         std::vector<PathPoint> path = pathPortalsToPathPoints(pathPortals, false);
 
         float pathCost = 0.0f;
@@ -176,19 +290,19 @@ namespace urchin
     /**
      * Compute approximate score from 'current' to 'endPoint'
      */
-    float PathfindingAStar::computeHScore(const std::shared_ptr<NavTriangle> &current, const Point3<float> &endPoint) const
+    float PathfindingAStar::computeHScore(const NavTriangle *current, const Point3<float> &endPoint) const
     {
         Point3<float> currentPoint = current->getCenterPoint();
         return std::abs(currentPoint.X - endPoint.X) + std::abs(currentPoint.Y - endPoint.Y) + std::abs(currentPoint.Z - endPoint.Z);
     }
 
-    std::vector<std::shared_ptr<PathPortal>> PathfindingAStar::determinePath(const std::shared_ptr<PathNode> &endNode, const Point3<float> &startPoint,
+    std::vector<std::shared_ptr<PathPortal>> PathfindingAStar::determinePath(const PathNode *endNode, const Point3<float> &startPoint,
                                                                const Point3<float> &endPoint) const
     {
         std::vector<std::shared_ptr<PathPortal>> portals;
         portals.reserve(10); //estimated memory size
 
-        std::shared_ptr<PathNode> pathNode = endNode;
+        const PathNode *pathNode = endNode;
         std::shared_ptr<PathPortal> endPortal = std::make_shared<PathPortal>(LineSegment3D<float>(endPoint, endPoint), pathNode, nullptr, false);
         portals.emplace_back(endPortal);
         while(pathNode->getPreviousNode()!=nullptr)
@@ -8,34 +8,46 @@
 #include "path/navmesh/model/output/NavMesh.h"
 #include "path/navmesh/model/output/NavTriangle.h"
 #include "path/pathfinding/PathNode.h"
+#include "path/pathfinding/PathNodeHeap.h"
+#include "path/pathfinding/IncrementalFunnelAlgorithm.h"
 #include "path/pathfinding/PathPortal.h"
+#include "path/pathfinding/hierarchical/NavPolygonGraph.h"
+#include "path/pathfinding/hierarchical/PolygonCorridorSearch.h"
 #include "path/PathPoint.h"
 
 namespace urchin
 {
 
-    struct PathNodeCompare
-    {
-        bool operator()(const std::shared_ptr<PathNode> &, const std::shared_ptr<PathNode> &) const;
-    };
-
+    /**
+     * A* search on the triangles of a navigation mesh. Memory used by the search (nodes, open list, closed list) is kept
+     * between the queries: an instance must not be used by several threads at the same time.
+     */
     class PathfindingAStar
     {
         public:
             explicit PathfindingAStar(std::shared_ptr<NavMesh>);
 
-            std::vector<PathPoint> findPath(const Point3<float> &, const Point3<float> &) const;
+            void setIncrementalGScore(bool);
+            void setPolygonGraph(const NavPolygonGraph *);
+
+            std::vector<PathPoint> findPath(const Point3<float> &, const Point3<float> &);
 
         private:
-            std::shared_ptr<NavTriangle> findTriangle(const Point3<float> &) const;
-            bool isPointInsideTriangle(const Point2<float> &, const std::shared_ptr<NavPolygon> &, const std::shared_ptr<NavTriangle> &) const;
+            std::vector<PathPoint> searchPath(const NavTriangle *, const Point3<float> &, const NavTriangle *, const Point3<float> &, bool);
+            const NavTriangle *findTriangle(const Point3<float> &);
+            bool isPointInsideTriangle(const Point2<float> &, const NavPolygon *, const NavTriangle *) const;
             float sign(const Point2<float> &, const Point2<float> &, const Point2<float> &) const;
 
-            std::shared_ptr<PathNode> retrievePathNodeFrom(const std::multiset<std::shared_ptr<PathNode>, PathNodeCompare> &, const std::shared_ptr<NavTriangle> &) const;
-            float computeGScore(const std::shared_ptr<PathNode> &, const std::shared_ptr<NavLink> &, const Point3<float> &) const;
-            float computeHScore(const std::shared_ptr<NavTriangle> &, const Point3<float> &) const;
+            void resetSearchMemory();
+            bool isClosed(unsigned int) const;
+            PathNode *createPathNode(const NavTriangle *, float, float);
 
-            std::vector<std::shared_ptr<PathPortal>> determinePath(const std::shared_ptr<PathNode> &, const Point3<float> &, const Point3<float> &) const;
+            float computeGScore(PathNode &, const Point3<float> &);
+            float computeIncrementalGScore(PathNode &);
+            float computeFunnelGScore(const PathNode &, const Point3<float> &) const;
+            float computeHScore(const NavTriangle *, const Point3<float> &) const;
+
+            std::vector<std::shared_ptr<PathPortal>> determinePath(const PathNode *, const Point3<float> &, const Point3<float> &) const;
             LineSegment3D<float> rearrangePortal(const LineSegment3D<float> &, const std::vector<std::shared_ptr<PathPortal>> &) const;
             Point3<float> middlePoint(const LineSegment3D<float> &) const;
 
@@ -45,6 +57,19 @@ namespace urchin
 
             const float jumpAdditionalCost;
             std::shared_ptr<NavMesh> navMesh;
+            bool incrementalGScore;
+            const NavPolygonGraph *polygonGraph;
+
+            unsigned int queryId;
+            std::vector<PathNode> pathNodes; //node of a triangle is stored at the index NavTriangle#getNavMeshId()
+            std::vector<unsigned int> closedQueryIds; //triangle is in closed list when its value is equals to current query ID
+            PathNodeHeap openList;
+            IncrementalFunnelAlgorithm incrementalFunnelAlgorithm;
+            std::vector<unsigned int> candidateTriangleIds;
+
+            PolygonCorridorSearch polygonCorridorSearch;
+            std::vector<unsigned int> corridorPolygonIndices;
+            std::vector<unsigned int> corridorQueryIds; //triangle is in corridor when its value is equals to current query ID
     };
 
 }
@@ -0,0 +1,304 @@
+#include <limits>
+#include <cassert>
+
+#include "NavPolygonGraph.h"
+
+namespace urchin
+{
+
+    bool NavPolygonGraph::PortalLocation::operator==(const PortalLocation &other) const
+    {
+        return triangleIndex == other.triangleIndex && point == other.point;
+    }
+
+    NavPolygonGraph::NavPolygonGraph() :
+            jumpAdditionalCost(ConfigService::instance()->getFloatValue("pathfinding.jumpAdditionalCost")),
+            navMeshUpdateId(0),
+            numberUpdatedPolygons(0)
+    {
+
+    }
+
+    /**
+     * Update the graph from the navigation mesh. Navigation mesh must not be modified until the next update of the graph.
+     */
+    void NavPolygonGraph::update(const NavMesh &navMesh)
+    {
+        ScopeProfiler scopeProfiler("ai", "upPolyGraph");
+
+        navMeshUpdateId = navMesh.getUpdateId();
+
+        trianglePolygonIndices.assign(navMesh.getNumberTriangles(), 0);
+        polygonIndicesById.clear();
+        for(std::size_t polygonIndex = 0; polygonIndex < navMesh.getPolygons().size(); ++polygonIndex)
+        {
+            for(const auto &triangle : navMesh.getPolygons()[polygonIndex]->getTriangles())
+            {
+                trianglePolygonIndices[triangle->getNavMeshId()] = static_cast<unsigned int>(polygonIndex);
+            }
+            polygonIndicesById[navMesh.getPolygons()[polygonIndex]->getId()] = static_cast<unsigned int>(polygonIndex);
+        }
+
+        updatePolygonsData(navMesh);
+        createPortals(navMesh);
+        updatePolygonCosts(navMesh);
+    }
+
+    /**
+     * @return Update identifier of the navigation mesh used for the last update (see NavMesh#getUpdateId())
+     */
+    unsigned int NavPolygonGraph::getNavMeshUpdateId() const
+    {
+        return navMeshUpdateId;
+    }
+
+    /**
+     * @return Number of polygons having their crossing costs computed during the last update
+     */
+    unsigned int NavPolygonGraph::getNumberUpdatedPolygons() const
+    {
+        return numberUpdatedPolygons;
+    }
+
+    /**
+     * @return Index of the triangle polygon in NavMesh#getPolygons()
+     */
+    unsigned int NavPolygonGraph::getPolygonIndex(const NavTriangle *triangle) const
+    {
+        return trianglePolygonIndices[triangle->getNavMeshId()];
+    }
+
+    const std::vector<PolygonPortal> &NavPolygonGraph::getPortals() const
+    {
+        return portals;
+    }
+
+    /**
+     * @return Indices of the portals entering in the polygon
+     */
+    const std::vector<unsigned int> &NavPolygonGraph::getEntryPortals(unsigned int polygonIndex) const
+    {
+        return polygonsEntryPortals[polygonIndex];
+    }
+
+    /**
+     * @return Indices of the portals leaving the polygon
+     */
+    const std::vector<unsigned int> &NavPolygonGraph::getExitPortals(unsigned int polygonIndex) const
+    {
+        return polygonsExitPortals[polygonIndex];
+    }
+
+    /**
+     * @return Cost to cross the polygon from an entry portal (see PolygonPortal#entryIndex) to an exit portal (see PolygonPortal#exitIndex)
+     */
+    float NavPolygonGraph::getCrossingCost(unsigned int polygonIndex, unsigned int entryIndex, unsigned int exitIndex) const
+    {
+        const PolygonData *polygonData = polygonsData[polygonIndex];
+        return polygonData->crossingCosts[entryIndex * polygonData->exitPortals.size() + exitIndex];
+    }
+
+    /**
+     * Exit portals are only computed for the new polygons and for the polygons having their links modified since the previous update
+     */
+    void NavPolygonGraph::updatePolygonsData(const NavMesh &navMesh)
+    {
+        polygonsData.clear();
+        for(std::size_t polygonIndex = 0; polygonIndex < navMesh.getPolygons().size(); ++polygonIndex)
+        {
+            const std::shared_ptr<NavPolygon> &polygon = navMesh.getPolygons()[polygonIndex];
+            auto itPolygonData = polygonsDataById.find(polygon->getId());
+            if(itPolygonData == polygonsDataById.end())
+            {
+                itPolygonData = polygonsDataById.emplace(polygon->getId(), PolygonData{}).first;
+                computeExitPortals(navMesh, static_cast<unsigned int>(polygonIndex), itPolygonData->second);
+            }else if(itPolygonData->second.linksUpdateId != polygon->getLinksUpdateId())
+            {
+                computeExitPortals(navMesh, static_cast<unsigned int>(polygonIndex), itPolygonData->second);
+            }
+            itPolygonData->second.navMeshUpdateId = navMeshUpdateId;
+            polygonsData.push_back(&itPolygonData->second);
+        }
+
+        //remove data of polygons not present anymore in the navigation mesh
+        for(auto it = polygonsDataById.begin(); it != polygonsDataById.end();)
+        {
+            if(it->second.navMeshUpdateId != navMeshUpdateId)
+            {
+                it = polygonsDataById.erase(it);
+            }else
+            {
+                ++it;
+            }
+        }
+    }
+
+    void NavPolygonGraph::computeExitPortals(const NavMesh &navMesh, unsigned int polygonIndex, PolygonData &polygonData)
+    {
+        const std::shared_ptr<NavPolygon> &polygon = navMesh.getPolygons()[polygonIndex];
+        linksByTargetPolygon.clear();
+        for(const auto &triangle : polygon->getTriangles())
+        {
+            for(const auto &link : triangle->getLinks())
+            {
+                unsigned int targetPolygonIndex = getPolygonIndex(link->getTargetTriangle().get());
+                if(link->getLinkType() != NavLinkType::STANDARD && targetPolygonIndex != polygonIndex)
+                {
+                    linksByTargetPolygon[targetPolygonIndex].emplace_back(std::make_pair(triangle.get(), link.get()));
+                }
+            }
+        }
+
+        std::vector<ExitPortal> exitPortals;
+        exitPortals.reserve(linksByTargetPolygon.size());
+        for(const auto &targetPolygonLinks : linksByTargetPolygon)
+        {
+            unsigned int targetPolygonId = navMesh.getPolygons()[targetPolygonLinks.first]->getId();
+            exitPortals.push_back(computeExitPortal(targetPolygonId, targetPolygonLinks.second));
+        }
+
+        //costs stay valid when the exit locations are unchanged
+        bool sameExits = exitPortals.size() == polygonData.exitPortals.size();
+        for(std::size_t i = 0; i < exitPortals.size() && sameExits; ++i)
+        {
+            sameExits = exitPortals[i].exit == polygonData.exitPortals[i].exit;
+        }
+        polygonData.costsUpToDate = polygonData.costsUpToDate && sameExits;
+
+        polygonData.linksUpdateId = polygon->getLinksUpdateId();
+        polygonData.exitPortals = std::move(exitPortals);
+    }
+
+    /**
+     * Compute the exit portal for the links between two polygons. Link located in the middle of the links is used to compute the crossing points.
+     */
+    NavPolygonGraph::ExitPortal NavPolygonGraph::computeExitPortal(unsigned int targetPolygonId, const std::vector<std::pair<const NavTriangle *, const NavLink *>> &links) const
+    {
+        std::vector<Point3<float>> exitPoints;
+        exitPoints.reserve(links.size());
+        Point3<float> averageExitPoint(0.0f, 0.0f, 0.0f);
+        for(const auto &link : links)
+        {
+            LineSegment3D<float> sourceEdge = link.first->computeEdge(link.second->getSourceEdgeIndex());
+            LineSegment3D<float> exitEdge = link.second->getLinkConstraint()->computeSourceJumpEdge(sourceEdge);
+            exitPoints.emplace_back((exitEdge.getA() + exitEdge.getB()) / 2.0f);
+            averageExitPoint += exitPoints.back() / (float)links.size();
+        }
+
+        std::size_t middleLinkIndex = 0;
+        for(std::size_t i = 1; i < links.size(); ++i)
+        {
+            if(exitPoints[i].squareDistance(averageExitPoint) < exitPoints[middleLinkIndex].squareDistance(averageExitPoint))
+            {
+                middleLinkIndex = i;
+            }
+        }
+        const NavTriangle *sourceTriangle = links[middleLinkIndex].first;
+        const NavLink *link = links[middleLinkIndex].second;
+        const NavTriangle *targetTriangle = link->getTargetTriangle().get();
+
+        ExitPortal exitPortal{};
+        exitPortal.targetPolygonId = targetPolygonId;
+        exitPortal.exit = toPortalLocation(sourceTriangle, exitPoints[middleLinkIndex]);
+        if(link->getLinkType() == NavLinkType::JUMP)
+        {
+            LineSegment3D<float> targetEdge = targetTriangle->computeEdge(static_cast<std::size_t>(link->getLinkConstraint()->getTargetEdgeIndex()));
+            exitPortal.entry = toPortalLocation(targetTriangle, targetEdge.closestPoint(exitPortal.exit.point));
+            exitPortal.crossingCost = exitPortal.exit.point.distance(exitPortal.entry.point) + jumpAdditionalCost;
+        }else
+        {
+            exitPortal.entry = toPortalLocation(targetTriangle, exitPortal.exit.point);
+            exitPortal.crossingCost = 0.0f;
+        }
+
+        return exitPortal;
+    }
+
+    /**
+     * Create the portals of the navigation mesh from the exit portals of the polygons
+     */
+    void NavPolygonGraph::createPortals(const NavMesh &navMesh)
+    {
+        std::size_t numberPolygons = navMesh.getPolygons().size();
+        portals.clear();
+        polygonsEntryPortals.resize(numberPolygons);
+        polygonsExitPortals.resize(numberPolygons);
+        for(std::size_t polygonIndex = 0; polygonIndex < numberPolygons; ++polygonIndex)
+        { //clear portals indices without releasing memory
+            polygonsEntryPortals[polygonIndex].clear();
+            polygonsExitPortals[polygonIndex].clear();
+        }
+
+        for(std::size_t polygonIndex = 0; polygonIndex < numberPolygons; ++polygonIndex)
+        {
+            const std::shared_ptr<NavPolygon> &polygon = navMesh.getPolygons()[polygonIndex];
+            for(const auto &exitPortal : polygonsData[polygonIndex]->exitPortals)
+            {
+                auto itTargetPolygonIndex = polygonIndicesById.find(exitPortal.targetPolygonId);
+                assert(itTargetPolygonIndex != polygonIndicesById.end());
+                unsigned int targetPolygonIndex = itTargetPolygonIndex->second;
+
+                PolygonPortal portal{};
+                portal.sourcePolygonIndex = static_cast<unsigned int>(polygonIndex);
+                portal.targetPolygonIndex = targetPolygonIndex;
+                portal.sourceTriangle = polygon->getTriangle(exitPortal.exit.triangleIndex).get();
+                portal.targetTriangle = navMesh.getPolygons()[targetPolygonIndex]->getTriangle(exitPortal.entry.triangleIndex).get();
+                portal.exitPoint = exitPortal.exit.point;
+                portal.entryPoint = exitPortal.entry.point;
+                portal.crossingCost = exitPortal.crossingCost;
+                portal.exitIndex = static_cast<unsigned int>(polygonsExitPortals[polygonIndex].size());
+                portal.entryIndex = static_cast<unsigned int>(polygonsEntryPortals[targetPolygonIndex].size());
+
+                polygonsExitPortals[polygonIndex].push_back(static_cast<unsigned int>(portals.size()));
+                polygonsEntryPortals[targetPolygonIndex].push_back(static_cast<unsigned int>(portals.size()));
+                portals.push_back(portal);
+            }
+        }
+    }
+
+    /**
+     * Compute the costs to cross the polygons. Costs of a polygon are reused from the previous update when the polygon
+     * has not been regenerated and its portals are unchanged.
+     */
+    void NavPolygonGraph::updatePolygonCosts(const NavMesh &navMesh)
+    {
+        numberUpdatedPolygons = 0;
+
+        for(std::size_t polygonIndex = 0; polygonIndex < navMesh.getPolygons().size(); ++polygonIndex)
+        {
+            PolygonData &polygonData = *polygonsData[polygonIndex];
+
+            polygonEntries.clear();
+            for(unsigned int entryPortalIndex : polygonsEntryPortals[polygonIndex])
+            {
+                const PolygonPortal &entryPortal = portals[entryPortalIndex];
+                polygonEntries.push_back(polygonsData[entryPortal.sourcePolygonIndex]->exitPortals[entryPortal.exitIndex].entry);
+            }
+
+            if(!polygonData.costsUpToDate || polygonData.entries != polygonEntries)
+            {
+                const std::shared_ptr<NavPolygon> &polygon = navMesh.getPolygons()[polygonIndex];
+                polygonData.crossingCosts.clear();
+                polygonData.crossingCosts.reserve(polygonEntries.size() * polygonData.exitPortals.size());
+                for(unsigned int entryPortalIndex : polygonsEntryPortals[polygonIndex])
+                {
+                    polygonDistanceAlgorithm.compute(*polygon, portals[entryPortalIndex].targetTriangle, portals[entryPortalIndex].entryPoint);
+                    for(unsigned int exitPortalIndex : polygonsExitPortals[polygonIndex])
+                    {
+                        polygonData.crossingCosts.push_back(polygonDistanceAlgorithm.computeCost(portals[exitPortalIndex].sourceTriangle, portals[exitPortalIndex].exitPoint));
+                    }
+                }
+                polygonData.entries = polygonEntries;
+                polygonData.costsUpToDate = true;
+                numberUpdatedPolygons++;
+            }
+        }
+    }
+
+    NavPolygonGraph::PortalLocation NavPolygonGraph::toPortalLocation(const NavTriangle *triangle, const Point3<float> &point) const
+    {
+        unsigned int polygonFirstTriangleId = triangle->getNavPolygon()->getTriangles()[0]->getNavMeshId();
+        return {triangle->getNavMeshId() - polygonFirstTriangleId, point};
+    }
+
+}
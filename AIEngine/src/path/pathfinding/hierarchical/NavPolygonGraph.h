@@ -0,0 +1,107 @@
+#ifndef URCHINENGINE_NAVPOLYGONGRAPH_H
+#define URCHINENGINE_NAVPOLYGONGRAPH_H
+
+#include <vector>
+#include <map>
+#include "UrchinCommon.h"
+
+#include "path/navmesh/model/output/NavMesh.h"
+#include "path/pathfinding/hierarchical/PolygonDistanceAlgorithm.h"
+
+namespace urchin
+{
+
+    /**
+     * Portal between two polygons. It represents all the links (join polygons or jump) from the source polygon to the target polygon.
+     */
+    struct PolygonPortal
+    {
+        unsigned int sourcePolygonIndex;
+        unsigned int targetPolygonIndex;
+        const NavTriangle *sourceTriangle;
+        const NavTriangle *targetTriangle;
+        Point3<float> exitPoint; //point where the source polygon is left
+        Point3<float> entryPoint; //point where the target polygon is entered
+        float crossingCost;
+
+        unsigned int exitIndex; //index of the portal in the exit portals of the source polygon
+        unsigned int entryIndex; //index of the portal in the entry portals of the target polygon
+    };
+
+    /**
+     * Abstraction of a navigation mesh where polygons are connected by portals. Cost to cross each polygon from an entry portal
+     * to an exit portal is cached. The graph is updated incrementally: exit portals are only computed again for the polygons which
+     * have been regenerated or relinked (see NavPolygon#getLinksUpdateId()) and costs are only computed again for the polygons
+     * having a modified portal.
+     */
+    class NavPolygonGraph
+    {
+        public:
+            NavPolygonGraph();
+
+            void update(const NavMesh &);
+
+            unsigned int getNavMeshUpdateId() const;
+            unsigned int getNumberUpdatedPolygons() const;
+
+            unsigned int getPolygonIndex(const NavTriangle *) const;
+            const std::vector<PolygonPortal> &getPortals() const;
+            const std::vector<unsigned int> &getEntryPortals(unsigned int) const;
+            const std::vector<unsigned int> &getExitPortals(unsigned int) const;
+            float getCrossingCost(unsigned int, unsigned int, unsigned int) const;
+
+        private:
+            struct PortalLocation
+            {
+                unsigned int triangleIndex; //index of the triangle in its polygon
+                Point3<float> point;
+
+                bool operator==(const PortalLocation &) const;
+            };
+
+            struct ExitPortal
+            {
+                unsigned int targetPolygonId;
+                PortalLocation exit;
+                PortalLocation entry; //entry location in the target polygon
+                float crossingCost;
+            };
+
+            struct PolygonData
+            {
+                unsigned int linksUpdateId;
+                unsigned int navMeshUpdateId; //last navigation mesh update containing the polygon
+                std::vector<ExitPortal> exitPortals;
+
+                bool costsUpToDate;
+                std::vector<PortalLocation> entries;
+                std::vector<float> crossingCosts; //cost from entry i to exit j at index: i * exitPortals.size() + j
+            };
+
+            void updatePolygonsData(const NavMesh &);
+            void computeExitPortals(const NavMesh &, unsigned int, PolygonData &);
+            ExitPortal computeExitPortal(unsigned int, const std::vector<std::pair<const NavTriangle *, const NavLink *>> &) const;
+            void createPortals(const NavMesh &);
+            void updatePolygonCosts(const NavMesh &);
+            PortalLocation toPortalLocation(const NavTriangle *, const Point3<float> &) const;
+
+            const float jumpAdditionalCost;
+            unsigned int navMeshUpdateId;
+            unsigned int numberUpdatedPolygons;
+
+            std::vector<unsigned int> trianglePolygonIndices; //polygon index of each triangle (indexed by NavTriangle#getNavMeshId())
+            std::vector<PolygonPortal> portals;
+            std::vector<std::vector<unsigned int>> polygonsEntryPortals;
+            std::vector<std::vector<unsigned int>> polygonsExitPortals;
+            std::vector<PolygonData *> polygonsData;
+            std::map<unsigned int, PolygonData> polygonsDataById; //data by NavPolygon#getId()
+            std::map<unsigned int, unsigned int> polygonIndicesById;
+            std::map<unsigned int, std::vector<std::pair<const NavTriangle *, const NavLink *>>> linksByTargetPolygon; //links by target polygon index
+            std::vector<PortalLocation> polygonEntries;
+
+            PolygonDistanceAlgorithm polygonDistanceAlgorithm;
+    };
+
+}
+
+#endif
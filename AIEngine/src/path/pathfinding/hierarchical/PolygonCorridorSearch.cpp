@@ -0,0 +1,141 @@
+#include <limits>
+#include <algorithm>
+
+#include "PolygonCorridorSearch.h"
+
+namespace urchin
+{
+
+    PolygonCorridorSearch::PolygonCorridorSearch() :
+            queryId(0)
+    {
+
+    }
+
+    /**
+     * Nodes of the search are the portals of the graph. Start and end polygons are connected to their portals with costs
+     * computed for the start and end points.
+     * @param corridorPolygonIndices [out] Indices of the polygons crossed from start triangle to end triangle
+     * @return True when a corridor has been found
+     */
+    bool PolygonCorridorSearch::findCorridor(const NavPolygonGraph &polygonGraph, const NavTriangle *startTriangle, const Point3<float> &startPoint,
+            const NavTriangle *endTriangle, const Point3<float> &endPoint, std::vector<unsigned int> &corridorPolygonIndices)
+    {
+        corridorPolygonIndices.clear();
+        unsigned int startPolygonIndex = polygonGraph.getPolygonIndex(startTriangle);
+        unsigned int endPolygonIndex = polygonGraph.getPolygonIndex(endTriangle);
+        if(startPolygonIndex == endPolygonIndex)
+        {
+            corridorPolygonIndices.push_back(startPolygonIndex);
+            return true;
+        }
+
+        const std::vector<PolygonPortal> &portals = polygonGraph.getPortals();
+        auto endNodeIndex = static_cast<unsigned int>(portals.size());
+        resetSearchMemory(portals.size() + 1);
+
+        const std::vector<unsigned int> &endEntryPortals = polygonGraph.getEntryPortals(endPolygonIndex);
+        if(endEntryPortals.empty())
+        {
+            return false;
+        }
+        polygonDistanceAlgorithm.compute(*endTriangle->getNavPolygon(), endTriangle, endPoint);
+        endCosts.clear();
+        for(unsigned int entryPortalIndex : endEntryPortals)
+        {
+            endCosts.push_back(polygonDistanceAlgorithm.computeCost(portals[entryPortalIndex].targetTriangle, portals[entryPortalIndex].entryPoint));
+        }
+
+        polygonDistanceAlgorithm.compute(*startTriangle->getNavPolygon(), startTriangle, startPoint);
+        for(unsigned int exitPortalIndex : polygonGraph.getExitPortals(startPolygonIndex))
+        {
+            const PolygonPortal &exitPortal = portals[exitPortalIndex];
+            float gScore = polygonDistanceAlgorithm.computeCost(exitPortal.sourceTriangle, exitPortal.exitPoint) + exitPortal.crossingCost;
+            updateNode(exitPortalIndex, gScore, exitPortal.entryPoint.distance(endPoint), endNodeIndex);
+        }
+
+        while(!openList.isEmpty())
+        {
+            unsigned int nodeIndex = openList.pop();
+            closedNodes[nodeIndex] = true;
+            if(nodeIndex == endNodeIndex)
+            { //corridor: start polygon then target polygons of portals
+                for(unsigned int portalIndex = previousNodes[endNodeIndex]; portalIndex != endNodeIndex; portalIndex = previousNodes[portalIndex])
+                {
+                    corridorPolygonIndices.push_back(portals[portalIndex].targetPolygonIndex);
+                }
+                corridorPolygonIndices.push_back(startPolygonIndex);
+                std::reverse(corridorPolygonIndices.begin(), corridorPolygonIndices.end());
+                return true;
+            }
+
+            const PolygonPortal &portal = portals[nodeIndex];
+            unsigned int polygonIndex = portal.targetPolygonIndex;
+            if(polygonIndex == endPolygonIndex)
+            {
+                updateNode(endNodeIndex, gScores[nodeIndex] + endCosts[portal.entryIndex], 0.0f, nodeIndex);
+            }
+
+            for(unsigned int exitPortalIndex : polygonGraph.getExitPortals(polygonIndex))
+            {
+                const PolygonPortal &exitPortal = portals[exitPortalIndex];
+                float gScore = gScores[nodeIndex] + polygonGraph.getCrossingCost(polygonIndex, portal.entryIndex, exitPortal.exitIndex) + exitPortal.crossingCost;
+                updateNode(exitPortalIndex, gScore, exitPortal.entryPoint.distance(endPoint), nodeIndex);
+            }
+        }
+
+        return false;
+    }
+
+    void PolygonCorridorSearch::resetSearchMemory(std::size_t numberNodes)
+    {
+        if(nodeQueryIds.size() != numberNodes)
+        {
+            nodeQueryIds.assign(numberNodes, 0);
+            gScores.resize(numberNodes);
+            previousNodes.resize(numberNodes);
+            closedNodes.resize(numberNodes);
+            queryId = 0;
+        }
+        openList.reset(numberNodes);
+
+        if(queryId == std::numeric_limits<unsigned int>::max())
+        {
+            std::fill(nodeQueryIds.begin(), nodeQueryIds.end(), 0);
+            queryId = 0;
+        }
+        queryId++;
+    }
+
+    /**
+     * Update the node when it is reached with a smaller G score
+     * @param previousNodeIndex Index of the previous node. Nodes reached from the start polygon have the end node as previous node.
+     */
+    void PolygonCorridorSearch::updateNode(unsigned int nodeIndex, float gScore, float hScore, unsigned int previousNodeIndex)
+    {
+        if(gScore >= std::numeric_limits<float>::max())
+        { //portal not reachable from the previous node
+            return;
+        }
+
+        if(nodeQueryIds[nodeIndex] != queryId)
+        {
+            nodeQueryIds[nodeIndex] = queryId;
+            closedNodes[nodeIndex] = false;
+        }else if(closedNodes[nodeIndex] || gScore >= gScores[nodeIndex])
+        {
+            return;
+        }
+
+        gScores[nodeIndex] = gScore;
+        previousNodes[nodeIndex] = previousNodeIndex;
+        if(openList.contains(nodeIndex))
+        {
+            openList.decreaseKey(nodeIndex, gScore + hScore);
+        }else
+        {
+            openList.push(nodeIndex, gScore + hScore);
+        }
+    }
+
+}
@@ -0,0 +1,44 @@
+#ifndef URCHINENGINE_POLYGONCORRIDORSEARCH_H
+#define URCHINENGINE_POLYGONCORRIDORSEARCH_H
+
+#include <vector>
+#include "UrchinCommon.h"
+
+#include "path/navmesh/model/output/NavTriangle.h"
+#include "path/pathfinding/PathNodeHeap.h"
+#include "path/pathfinding/hierarchical/NavPolygonGraph.h"
+#include "path/pathfinding/hierarchical/PolygonDistanceAlgorithm.h"
+
+namespace urchin
+{
+
+    /**
+     * A* search on the portals of a polygon graph to find the polygons crossed by a path. Memory used by the search is kept
+     * between the queries: an instance must not be used by several threads at the same time.
+     */
+    class PolygonCorridorSearch
+    {
+        public:
+            PolygonCorridorSearch();
+
+            bool findCorridor(const NavPolygonGraph &, const NavTriangle *, const Point3<float> &, const NavTriangle *, const Point3<float> &,
+                    std::vector<unsigned int> &);
+
+        private:
+            void resetSearchMemory(std::size_t);
+            void updateNode(unsigned int, float, float, unsigned int);
+
+            unsigned int queryId;
+            std::vector<unsigned int> nodeQueryIds; //node is initialized for the query when its value is equals to current query ID
+            std::vector<float> gScores;
+            std::vector<unsigned int> previousNodes;
+            std::vector<bool> closedNodes;
+            PathNodeHeap openList;
+
+            std::vector<float> endCosts; //cost from the entry portals of the end polygon to the end point
+            PolygonDistanceAlgorithm polygonDistanceAlgorithm;
+    };
+
+}
+
+#endif
@@ -0,0 +1,86 @@
+#include <limits>
+#include <cassert>
+
+#include "PolygonDistanceAlgorithm.h"
+
+namespace urchin
+{
+
+    /**
+     * @param polygon Polygon having triangles with contiguous IDs (see NavMesh#getTriangles())
+     * @param startTriangle Triangle of the polygon containing the start point
+     */
+    void PolygonDistanceAlgorithm::compute(const NavPolygon &polygon, const NavTriangle *startTriangle, const Point3<float> &startPoint)
+    {
+        std::size_t numberTriangles = polygon.getTriangles().size();
+        firstTriangleId = polygon.getTriangles()[0]->getNavMeshId();
+
+        costs.assign(numberTriangles, std::numeric_limits<float>::max());
+        positions.resize(numberTriangles);
+        settled.assign(numberTriangles, false);
+        openList.reset(numberTriangles);
+
+        unsigned int startTriangleIndex = toTriangleIndex(startTriangle);
+        costs[startTriangleIndex] = 0.0f;
+        positions[startTriangleIndex] = startPoint;
+        openList.push(startTriangleIndex, 0.0f);
+
+        while(!openList.isEmpty())
+        {
+            unsigned int triangleIndex = openList.pop();
+            settled[triangleIndex] = true;
+            const NavTriangle *triangle = polygon.getTriangles()[triangleIndex].get();
+
+            for(const auto &link : triangle->getLinks())
+            {
+                if(link->getLinkType() != NavLinkType::STANDARD)
+                { //link toward another polygon
+                    continue;
+                }
+
+                unsigned int neighborIndex = toTriangleIndex(link->getTargetTriangle().get());
+                if(settled[neighborIndex])
+                {
+                    continue;
+                }
+
+                LineSegment3D<float> edge = triangle->computeEdge(link->getSourceEdgeIndex());
+                Point3<float> edgeMiddle = (edge.getA() + edge.getB()) / 2.0f;
+                float cost = costs[triangleIndex] + positions[triangleIndex].distance(edgeMiddle);
+                if(cost < costs[neighborIndex])
+                {
+                    costs[neighborIndex] = cost;
+                    positions[neighborIndex] = edgeMiddle;
+                    if(openList.contains(neighborIndex))
+                    {
+                        openList.decreaseKey(neighborIndex, cost);
+                    }else
+                    {
+                        openList.push(neighborIndex, cost);
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @return Cost to reach the point located in the triangle or max float value when triangle cannot be reached
+     */
+    float PolygonDistanceAlgorithm::computeCost(const NavTriangle *triangle, const Point3<float> &point) const
+    {
+        unsigned int triangleIndex = toTriangleIndex(triangle);
+        if(costs[triangleIndex] == std::numeric_limits<float>::max())
+        {
+            return std::numeric_limits<float>::max();
+        }
+        return costs[triangleIndex] + positions[triangleIndex].distance(point);
+    }
+
+    unsigned int PolygonDistanceAlgorithm::toTriangleIndex(const NavTriangle *triangle) const
+    {
+        assert(triangle->getNavMeshId() >= firstTriangleId && triangle->getNavMeshId() - firstTriangleId < costs.size());
+
+        return triangle->getNavMeshId() - firstTriangleId;
+    }
+
+}
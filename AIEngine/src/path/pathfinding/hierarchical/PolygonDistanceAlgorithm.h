@@ -0,0 +1,37 @@
+#ifndef URCHINENGINE_POLYGONDISTANCEALGORITHM_H
+#define URCHINENGINE_POLYGONDISTANCEALGORITHM_H
+
+#include <vector>
+#include "UrchinCommon.h"
+
+#include "path/navmesh/model/output/NavPolygon.h"
+#include "path/navmesh/model/output/NavTriangle.h"
+#include "path/pathfinding/PathNodeHeap.h"
+
+namespace urchin
+{
+
+    /**
+     * Compute the cost to move from a point to all the triangles of a polygon (Dijkstra algorithm). Characters move from
+     * edge middle to edge middle: costs are approximations used to choose a corridor of polygons.
+     */
+    class PolygonDistanceAlgorithm
+    {
+        public:
+            void compute(const NavPolygon &, const NavTriangle *, const Point3<float> &);
+
+            float computeCost(const NavTriangle *, const Point3<float> &) const;
+
+        private:
+            unsigned int toTriangleIndex(const NavTriangle *) const;
+
+            unsigned int firstTriangleId;
+            std::vector<float> costs; //cost to reach the triangle position
+            std::vector<Point3<float>> positions; //point where the triangle is entered
+            std::vector<bool> settled;
+            PathNodeHeap openList;
+    };
+
+}
+
+#endif
@@ -160,6 +160,12 @@ namespace urchin
 		return boxShape.getVolume();
 	}
 
+	template<class T> T AABBox<T>::getSurfaceArea() const
+	{
+		const Vector3<T> &halfSizes = boxShape.getHalfSizes();
+		return (T)8.0 * (halfSizes.X*halfSizes.Y + halfSizes.Y*halfSizes.Z + halfSizes.Z*halfSizes.X);
+	}
+
 	template<class T> AABBox<T> AABBox<T>::moveAABBox(const Transform<T> &transform) const
 	{
 		return transform.getTransformMatrix() * (*this);
@@ -41,6 +41,7 @@ namespace urchin
 			Point3<T> getSupportPoint(const Vector3<T> &) const;
 			std::vector<Point3<T>> getPoints() const;
 			T getVolume() const;
+			T getSurfaceArea() const;
 
 			AABBox<T> moveAABBox(const Transform<T> &) const;
 			Matrix4<T> toProjectionMatrix() const;
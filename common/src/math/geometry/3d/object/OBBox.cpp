@@ -140,22 +140,21 @@ namespace urchin
 		throw std::invalid_argument("Invalid index: " + std::to_string(index));
 	}
 
+	/**
+	 * @return Point of OBBox having the maximum dot product with the direction. Each half size is taken in the same
+	 * direction as the given direction: no need to compute the eight points. In case of equality, the first point
+	 * (according to points sort of OBBox<T>::getPoint) is returned.
+	 */
 	template<class T> Point3<T> OBBox<T>::getSupportPoint(const Vector3<T> &direction) const
 	{
-		T maxPointDotDirection = getPoint(0).toVector().dotProduct(direction);
-		Point3<T> maxPoint = getPoint(0);
-
-		for(unsigned int i=1;i<8; ++i)
+		Vector3<T> centerToSupportPoint(0.0, 0.0, 0.0);
+		for(unsigned int i=0; i<3; ++i)
 		{
-			T currentPointDotDirection  = getPoint(i).toVector().dotProduct(direction);
-			if(currentPointDotDirection > maxPointDotDirection)
-			{
-				maxPointDotDirection = currentPointDotDirection;
-				maxPoint = getPoint(i);
-			}
+			T halfSize = axis[i].dotProduct(direction) >= (T)0.0 ? this->getHalfSize(i) : -this->getHalfSize(i);
+			centerToSupportPoint += halfSize * axis[i];
 		}
 
-		return maxPoint;
+		return centerOfMass.translate(centerToSupportPoint);
 	}
 
 	template<class T> AABBox<T> OBBox<T>::toAABBox() const
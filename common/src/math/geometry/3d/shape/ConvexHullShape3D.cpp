@@ -38,7 +38,10 @@ namespace urchin
 		points(points),
 		indexedTriangles(indexedTriangles)
 	{
-
+		for(const auto &itPoints : points)
+		{
+			packedPoints.addPoint(itPoints.first, itPoints.second.point);
+		}
 	}
 
 	/**
@@ -140,6 +143,7 @@ namespace urchin
 		{
             std::size_t newPointIndex = nextPointIndex++;
 			points[newPointIndex].point = newPoint;
+			packedPoints.addPoint(newPointIndex, newPoint);
 
 			for (auto &edge : edges)
 			{
@@ -167,20 +171,7 @@ namespace urchin
 
 	template<class T> Point3<T> ConvexHullShape3D<T>::getSupportPoint(const Vector3<T> &direction) const
 	{
-		T maxPointDotDirection = points.begin()->second.point.toVector().dotProduct(direction);
-		Point3<T> maxPoint = points.begin()->second.point;
-
-		for(const auto &itPoints : points)
-		{
-			T currentPointDotDirection  = itPoints.second.point.toVector().dotProduct(direction);
-			if(currentPointDotDirection > maxPointDotDirection)
-			{
-				maxPointDotDirection = currentPointDotDirection;
-				maxPoint = itPoints.second.point;
-			}
-		}
-
-		return maxPoint;
+		return packedPoints.getSupportPoint(direction);
 	}
 
 	/**
@@ -233,6 +224,7 @@ namespace urchin
             if(pointTriangles.empty())
             { //orphan point: remove it
                 points.erase(indices[i]);
+                packedPoints.removePoint(indices[i]);
             }
 
 		}
@@ -305,6 +297,7 @@ namespace urchin
 		{
 			it.second.triangleIndices.push_back(triangleIndex1);
 			it.second.triangleIndices.push_back(triangleIndex2);
+			packedPoints.addPoint(it.first, it.second.point);
 		}
 
 		//5. build tetrahedron (find a no coplanar point to the triangle)
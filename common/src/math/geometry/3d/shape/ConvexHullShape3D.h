@@ -10,6 +10,7 @@
 
 #include "math/geometry/3d/shape/ConvexShape3D.h"
 #include "math/geometry/3d/IndexedTriangle3D.h"
+#include "math/geometry/3d/util/PackedPoints3D.h"
 #include "math/algebra/point/Point3.h"
 
 namespace urchin
@@ -53,6 +54,7 @@ namespace urchin
 
 			std::map<std::size_t, ConvexHullPoint<T>> points; //first: point index, second: convex hull point
 			std::map<std::size_t, IndexedTriangle3D<T>> indexedTriangles; //first: triangle index, second: triangle representing the convex hull
+			PackedPoints3D<T> packedPoints; //copy of points coordinates for support point search
 	};
 
 	template<class T> std::ostream& operator <<(std::ostream &, const ConvexHullShape3D<T> &);
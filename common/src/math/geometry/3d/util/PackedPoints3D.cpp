@@ -0,0 +1,177 @@
+#include <algorithm>
+#include <stdexcept>
+#include <limits>
+#if defined(__AVX__)
+	#include <immintrin.h>
+#elif defined(__SSE__)
+	#include <xmmintrin.h>
+#endif
+
+#include "PackedPoints3D.h"
+
+namespace urchin
+{
+
+	/**
+	 * @param pointIndex Index of the point used to remove it later
+	 */
+	template<class T> void PackedPoints3D<T>::addPoint(std::size_t pointIndex, const Point3<T> &point)
+	{
+		pointIndices.push_back(pointIndex);
+		xCoordinates.push_back(point.X);
+		yCoordinates.push_back(point.Y);
+		zCoordinates.push_back(point.Z);
+	}
+
+	/**
+	 * Remove the point and shift the next points. Order of points is kept: support point search returns the first added point
+	 * in case of equality.
+	 */
+	template<class T> void PackedPoints3D<T>::removePoint(std::size_t pointIndex)
+	{
+		auto itFind = std::find(pointIndices.begin(), pointIndices.end(), pointIndex);
+		if(itFind == pointIndices.end())
+		{
+			throw std::invalid_argument("Impossible to remove unknown point: " + std::to_string(pointIndex));
+		}
+
+		auto position = std::distance(pointIndices.begin(), itFind);
+		pointIndices.erase(itFind);
+		xCoordinates.erase(xCoordinates.begin() + position);
+		yCoordinates.erase(yCoordinates.begin() + position);
+		zCoordinates.erase(zCoordinates.begin() + position);
+	}
+
+	template<class T> std::size_t PackedPoints3D<T>::getSize() const
+	{
+		return pointIndices.size();
+	}
+
+	template<class T> Point3<T> PackedPoints3D<T>::getPoint(std::size_t position) const
+	{
+		return Point3<T>(xCoordinates[position], yCoordinates[position], zCoordinates[position]);
+	}
+
+	/**
+	 * @return Point having the maximum dot product with the direction. When several points have the same dot product, the first added one is returned.
+	 */
+	template<class T> Point3<T> PackedPoints3D<T>::getSupportPoint(const Vector3<T> &direction) const
+	{
+		if(pointIndices.empty())
+		{
+			throw std::runtime_error("Impossible to find support point on empty points");
+		}
+
+		return getPoint(findSupportPointPosition(direction));
+	}
+
+	template<class T> std::size_t PackedPoints3D<T>::findSupportPointPosition(const Vector3<T> &direction) const
+	{
+		std::size_t maxPosition = 0;
+		T maxPointDotDirection = -std::numeric_limits<T>::max();
+
+		for(std::size_t i=0; i<pointIndices.size(); ++i)
+		{
+			T currentPointDotDirection = xCoordinates[i]*direction.X + yCoordinates[i]*direction.Y + zCoordinates[i]*direction.Z;
+			if(currentPointDotDirection > maxPointDotDirection)
+			{
+				maxPointDotDirection = currentPointDotDirection;
+				maxPosition = i;
+			}
+		}
+
+		return maxPosition;
+	}
+
+#if defined(__AVX__) || defined(__SSE__)
+	/**
+	 * Each SIMD lane keeps its maximum dot product and the position of the associated point. Positions are stored in float:
+	 * exact up to 2^24 points. Remaining points which don't fill a full SIMD register are handled with scalar instructions.
+	 */
+	template<> std::size_t PackedPoints3D<float>::findSupportPointPosition(const Vector3<float> &direction) const
+	{
+		#if defined(__AVX__)
+			constexpr std::size_t LANES = 8;
+			__m256 directionX = _mm256_set1_ps(direction.X);
+			__m256 directionY = _mm256_set1_ps(direction.Y);
+			__m256 directionZ = _mm256_set1_ps(direction.Z);
+			__m256 maxDots = _mm256_set1_ps(-std::numeric_limits<float>::max());
+			__m256 maxPositions = _mm256_setzero_ps();
+			__m256 positions = _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f);
+			const __m256 positionsIncrement = _mm256_set1_ps(static_cast<float>(LANES));
+		#else
+			constexpr std::size_t LANES = 4;
+			__m128 directionX = _mm_set1_ps(direction.X);
+			__m128 directionY = _mm_set1_ps(direction.Y);
+			__m128 directionZ = _mm_set1_ps(direction.Z);
+			__m128 maxDots = _mm_set1_ps(-std::numeric_limits<float>::max());
+			__m128 maxPositions = _mm_setzero_ps();
+			__m128 positions = _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f);
+			const __m128 positionsIncrement = _mm_set1_ps(static_cast<float>(LANES));
+		#endif
+
+		std::size_t simdSize = pointIndices.size() - (pointIndices.size() % LANES);
+		for(std::size_t i=0; i<simdSize; i+=LANES)
+		{
+			#if defined(__AVX__)
+				__m256 dots = _mm256_add_ps(_mm256_add_ps(
+						_mm256_mul_ps(_mm256_loadu_ps(&xCoordinates[i]), directionX),
+						_mm256_mul_ps(_mm256_loadu_ps(&yCoordinates[i]), directionY)),
+						_mm256_mul_ps(_mm256_loadu_ps(&zCoordinates[i]), directionZ));
+				__m256 greaterMask = _mm256_cmp_ps(dots, maxDots, _CMP_GT_OQ);
+				maxDots = _mm256_blendv_ps(maxDots, dots, greaterMask);
+				maxPositions = _mm256_blendv_ps(maxPositions, positions, greaterMask);
+				positions = _mm256_add_ps(positions, positionsIncrement);
+			#else
+				__m128 dots = _mm_add_ps(_mm_add_ps(
+						_mm_mul_ps(_mm_loadu_ps(&xCoordinates[i]), directionX),
+						_mm_mul_ps(_mm_loadu_ps(&yCoordinates[i]), directionY)),
+						_mm_mul_ps(_mm_loadu_ps(&zCoordinates[i]), directionZ));
+				__m128 greaterMask = _mm_cmpgt_ps(dots, maxDots);
+				maxDots = _mm_or_ps(_mm_and_ps(greaterMask, dots), _mm_andnot_ps(greaterMask, maxDots));
+				maxPositions = _mm_or_ps(_mm_and_ps(greaterMask, positions), _mm_andnot_ps(greaterMask, maxPositions));
+				positions = _mm_add_ps(positions, positionsIncrement);
+			#endif
+		}
+
+		float laneMaxDots[LANES];
+		float laneMaxPositions[LANES];
+		#if defined(__AVX__)
+			_mm256_storeu_ps(laneMaxDots, maxDots);
+			_mm256_storeu_ps(laneMaxPositions, maxPositions);
+		#else
+			_mm_storeu_ps(laneMaxDots, maxDots);
+			_mm_storeu_ps(laneMaxPositions, maxPositions);
+		#endif
+
+		std::size_t maxPosition = 0;
+		float maxPointDotDirection = -std::numeric_limits<float>::max();
+		for(std::size_t lane=0; lane<LANES; ++lane)
+		{ //lowest position wins in case of equality to return the first point as the scalar version
+			auto lanePosition = static_cast<std::size_t>(laneMaxPositions[lane]);
+			if(laneMaxDots[lane] > maxPointDotDirection || (laneMaxDots[lane] == maxPointDotDirection && lanePosition < maxPosition))
+			{
+				maxPointDotDirection = laneMaxDots[lane];
+				maxPosition = lanePosition;
+			}
+		}
+
+		for(std::size_t i=simdSize; i<pointIndices.size(); ++i)
+		{
+			float currentPointDotDirection = xCoordinates[i]*direction.X + yCoordinates[i]*direction.Y + zCoordinates[i]*direction.Z;
+			if(currentPointDotDirection > maxPointDotDirection)
+			{
+				maxPointDotDirection = currentPointDotDirection;
+				maxPosition = i;
+			}
+		}
+
+		return maxPosition;
+	}
+#endif
+
+	//explicit template
+	template class PackedPoints3D<float>;
+	template class PackedPoints3D<double>;
+
+}
@@ -0,0 +1,37 @@
+#ifndef URCHINENGINE_PACKEDPOINTS3D_H
+#define URCHINENGINE_PACKEDPOINTS3D_H
+
+#include <vector>
+
+#include "math/algebra/point/Point3.h"
+#include "math/algebra/vector/Vector3.h"
+
+namespace urchin
+{
+
+	/**
+	* Points stored in structure of arrays layout (one array by coordinate) in order to search support point with SIMD instructions
+	*/
+	template<class T> class PackedPoints3D
+	{
+		public:
+			void addPoint(std::size_t, const Point3<T> &);
+			void removePoint(std::size_t);
+
+			std::size_t getSize() const;
+			Point3<T> getPoint(std::size_t) const;
+
+			Point3<T> getSupportPoint(const Vector3<T> &) const;
+
+		private:
+			std::size_t findSupportPointPosition(const Vector3<T> &) const;
+
+			std::vector<std::size_t> pointIndices; //indices of points in convex hull
+			std::vector<T> xCoordinates;
+			std::vector<T> yCoordinates;
+			std::vector<T> zCoordinates;
+	};
+
+}
+
+#endif
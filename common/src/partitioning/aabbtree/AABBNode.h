@@ -1,6 +1,9 @@
 #ifndef URCHINENGINE_AABBNODE_H
 #define URCHINENGINE_AABBNODE_H
 
+#include <cstdint>
+#include <limits>
+
 #include "partitioning/aabbtree/AABBNodeData.h"
 #include "math/geometry/3d/object/AABBox.h"
 
@@ -9,41 +12,35 @@ namespace urchin
 
     template<class OBJ> class AABBTree;
 
+    /**
+    * Node of AABBTree. Nodes are stored contiguously in the tree and linked by their index in the tree node pool.
+    */
 	template<class OBJ> class AABBNode
 	{
 		public:
             friend class AABBTree<OBJ>;
 
+            static constexpr uint32_t NULL_NODE = std::numeric_limits<uint32_t>::max();
+
 			explicit AABBNode(AABBNodeData<OBJ> *);
-			~AABBNode();
 
             AABBNodeData<OBJ> *getNodeData() const;
 
 			bool isLeaf() const;
 			bool isRoot() const;
 
-			void setParent(AABBNode *);
-			AABBNode *getParent() const;
-
-			void setLeftChild(AABBNode *);
-			AABBNode *getLeftChild() const;
-			void setRightChild(AABBNode *);
-			AABBNode *getRightChild() const;
-
-			AABBNode *getSibling() const;
+			uint32_t getParentIndex() const;
+			uint32_t getLeftChildIndex() const;
+			uint32_t getRightChildIndex() const;
 
 			const AABBox<float> &getAABBox() const;
-			void updateAABBox(float);
-
-	    protected:
-            void clearNodeData();
 
 		private:
             AABBNodeData<OBJ> *nodeData;
 			AABBox<float> aabbox;
 
-			AABBNode<OBJ> *parentNode;
-			AABBNode<OBJ> *children[2];
+			uint32_t parentIndex; //next free node index when node is not used
+			uint32_t children[2];
 	};
 
     #include "AABBNode.inl"
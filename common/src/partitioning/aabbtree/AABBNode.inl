@@ -1,17 +1,9 @@
 template<class OBJ> AABBNode<OBJ>::AABBNode(AABBNodeData<OBJ> *nodeData) :
         nodeData(nodeData),
-        parentNode(nullptr)
+        parentIndex(NULL_NODE)
 {
-    this->children[0] = nullptr;
-    this->children[1] = nullptr;
-}
-
-template<class OBJ> AABBNode<OBJ>::~AABBNode()
-{
-    delete children[0];
-    delete children[1];
-
-    delete nodeData;
+    this->children[0] = NULL_NODE;
+    this->children[1] = NULL_NODE;
 }
 
 template<class OBJ> AABBNodeData<OBJ> *AABBNode<OBJ>::getNodeData() const
@@ -21,57 +13,29 @@ template<class OBJ> AABBNodeData<OBJ> *AABBNode<OBJ>::getNodeData() const
 
 template<class OBJ> bool AABBNode<OBJ>::isLeaf() const
 {
-    return children[0]==nullptr;
+    return children[0]==NULL_NODE;
 }
 
 template<class OBJ> bool AABBNode<OBJ>::isRoot() const
 {
-    return parentNode==nullptr;
-}
-
-template<class OBJ> void AABBNode<OBJ>::setParent(AABBNode *parentNode)
-{
-    this->parentNode = parentNode;
-}
-
-template<class OBJ> AABBNode<OBJ> *AABBNode<OBJ>::getParent() const
-{
-    return parentNode;
+    return parentIndex==NULL_NODE;
 }
 
-template<class OBJ> void AABBNode<OBJ>::setLeftChild(AABBNode *leftChild)
+template<class OBJ> uint32_t AABBNode<OBJ>::getParentIndex() const
 {
-    this->children[0] = leftChild;
-    if(leftChild)
-    {
-        this->children[0]->setParent(this);
-    }
+    return parentIndex;
 }
 
-template<class OBJ> AABBNode<OBJ> *AABBNode<OBJ>::getLeftChild() const
+template<class OBJ> uint32_t AABBNode<OBJ>::getLeftChildIndex() const
 {
     return children[0];
 }
 
-template<class OBJ> void AABBNode<OBJ>::setRightChild(AABBNode *rightChild)
-{
-    this->children[1] = rightChild;
-    if(rightChild)
-    {
-        this->children[1]->setParent(this);
-    }
-}
-
-template<class OBJ> AABBNode<OBJ> *AABBNode<OBJ>::getRightChild() const
+template<class OBJ> uint32_t AABBNode<OBJ>::getRightChildIndex() const
 {
     return children[1];
 }
 
-template<class OBJ> AABBNode<OBJ> *AABBNode<OBJ>::getSibling() const
-{
-    return parentNode->getLeftChild()==this ? parentNode->getRightChild() : parentNode->getLeftChild();
-}
-
 /**
  * Returns fat AABBox for leaf and bounding box for branch
  */
@@ -79,22 +43,3 @@ template<class OBJ> const AABBox<float> &AABBNode<OBJ>::getAABBox() const
 {
     return aabbox;
 }
-
-template<class OBJ> void AABBNode<OBJ>::updateAABBox(float fatMargin)
-{
-    if (isLeaf())
-    {
-        Point3<float> fatMargin3(fatMargin, fatMargin, fatMargin);
-        AABBox<float> objectBox = nodeData->retrieveObjectAABBox();
-
-        aabbox = AABBox<float>(objectBox.getMin()-fatMargin3, objectBox.getMax()+fatMargin3);
-    }else
-    {
-        aabbox = children[0]->getAABBox().merge(children[1]->getAABBox());
-    }
-}
-
-template<class OBJ> void AABBNode<OBJ>::clearNodeData()
-{
-    nodeData = nullptr;
-}
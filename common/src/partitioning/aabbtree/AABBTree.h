@@ -1,6 +1,15 @@
 #ifndef URCHINENGINE_AABBTREE_H
 #define URCHINENGINE_AABBTREE_H
 
+#include <unordered_map>
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
 #include "partitioning/aabbtree/AABBNode.h"
 #include "partitioning/aabbtree/AABBNodeData.h"
 #include "math/geometry/3d/Ray.h"
@@ -10,6 +19,9 @@
 namespace urchin
 {
 
+	/**
+	 * AABB tree where nodes are stored contiguously in a node pool and linked by their index
+	 */
 	template<class OBJ> class AABBTree
 	{
 		public:
@@ -18,36 +30,56 @@ namespace urchin
 
 			void updateFatMargin(float);
 
-            AABBNode<OBJ> *getRootNode() const;
+            const AABBNode<OBJ> *getRootNode() const;
+            const AABBNode<OBJ> *getNode(OBJ) const;
             AABBNodeData<OBJ> *getNodeData(OBJ) const;
             void getAllNodeObjects(std::vector<OBJ> &) const;
 
 			void addObject(AABBNodeData<OBJ> *);
-            virtual void postAddObjectCallback(AABBNode<OBJ> *);
-
 			void removeObject(AABBNodeData<OBJ> *);
 			void removeObject(OBJ);
-            virtual void preRemoveObjectCallback(AABBNode<OBJ> *);
-
+			bool updateObject(OBJ);
 			void updateObjects();
-			virtual void preUpdateObjectCallback(AABBNode<OBJ> *);
+			void rebuild();
 
 			void aabboxQuery(const AABBox<float> &, std::vector<OBJ> &) const;
 			void rayQuery(const Ray<float> &, std::vector<OBJ> &) const;
+			void rayBatchQuery(const std::vector<Ray<float>> &, std::vector<std::pair<uint32_t, OBJ>> &) const;
 			void enlargedRayQuery(const Ray<float> &, float, const OBJ, std::vector<OBJ> &) const;
 
-	    protected:
-            std::map<OBJ, AABBNode<OBJ> *> objectsNode;
-            mutable std::vector<AABBNode<OBJ> *> browseNodes;
-
 		private:
-            std::vector<AABBNodeData<OBJ> *> extractAllNodeData();
-			void insertNode(AABBNode<OBJ> *, AABBNode<OBJ> *);
-			void replaceNode(AABBNode<OBJ> *, AABBNode<OBJ> *);
-			void removeNode(AABBNode<OBJ> *);
+            struct RayPacket
+            {
+                uint32_t nodeIndex;
+                std::size_t firstRayPosition; //position of the first ray index in browseRayIndices
+                std::size_t nbRays;
+            };
+
+            uint32_t allocateNode(AABBNodeData<OBJ> *);
+            void freeNode(uint32_t);
+            void setChild(uint32_t, unsigned int, uint32_t);
+            void updateAABBox(uint32_t);
+
+            void collectLeaves(std::vector<uint32_t> &) const;
+            bool updateLeaf(uint32_t);
+			void insertLeaf(uint32_t);
+			float computeDescendCost(uint32_t, const AABBox<float> &) const;
+			void detachLeaf(uint32_t);
+			void replaceNode(uint32_t, uint32_t);
+			void refitAncestors(uint32_t);
+			void rotateNode(uint32_t);
+			void swapNodes(uint32_t, uint32_t);
+			uint32_t buildSubtree(std::vector<uint32_t>::iterator, std::vector<uint32_t>::iterator);
 
 			float fatMargin;
-			AABBNode<OBJ> *rootNode;
+			std::vector<AABBNode<OBJ>> nodes;
+			uint32_t rootNodeIndex;
+			uint32_t freeNodeIndex;
+
+            std::unordered_map<OBJ, uint32_t> objectsNode;
+            mutable std::vector<uint32_t> browseNodes;
+            mutable std::vector<RayPacket> browseRayPackets;
+            mutable std::vector<uint32_t> browseRayIndices;
 	};
 
     #include "AABBTree.inl"
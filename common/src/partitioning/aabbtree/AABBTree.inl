@@ -1,37 +1,76 @@
 
 template<class OBJ> AABBTree<OBJ>::AABBTree(float fatMargin) :
         fatMargin(fatMargin),
-        rootNode(nullptr)
+        rootNodeIndex(AABBNode<OBJ>::NULL_NODE),
+        freeNodeIndex(AABBNode<OBJ>::NULL_NODE)
 {
 
 }
 
 template<class OBJ> AABBTree<OBJ>::~AABBTree()
 {
-    delete rootNode;
+    for(const auto &objectNode : objectsNode)
+    {
+        delete nodes[objectNode.second].nodeData;
+    }
 }
 
 template<class OBJ> void AABBTree<OBJ>::updateFatMargin(float fatMargin)
 {
     this->fatMargin = fatMargin;
 
-    std::vector<AABBNodeData<OBJ> *> allNodeData = extractAllNodeData();
-    delete rootNode;
-    rootNode = nullptr;
+    std::vector<uint32_t> leafIndices;
+    collectLeaves(leafIndices);
+
+    std::vector<AABBNodeData<OBJ> *> allNodeData;
+    allNodeData.reserve(leafIndices.size());
+    for(uint32_t leafIndex : leafIndices)
+    {
+        allNodeData.push_back(nodes[leafIndex].nodeData);
+    }
+
+    nodes.clear();
+    objectsNode.clear();
+    rootNodeIndex = AABBNode<OBJ>::NULL_NODE;
+    freeNodeIndex = AABBNode<OBJ>::NULL_NODE;
     for(const auto nodeData : allNodeData)
     {
         addObject(nodeData);
     }
 }
 
-template <class OBJ> AABBNode<OBJ> *AABBTree<OBJ>::getRootNode() const
+/**
+ * @return Root node or null when tree is empty. Returned node is invalidated by any modification of the tree.
+ */
+template <class OBJ> const AABBNode<OBJ> *AABBTree<OBJ>::getRootNode() const
+{
+    if(rootNodeIndex==AABBNode<OBJ>::NULL_NODE)
+    {
+        return nullptr;
+    }
+    return &nodes[rootNodeIndex];
+}
+
+/**
+ * @return Leaf node of the object or null when object is not in the tree. Returned node is invalidated by any modification of the tree.
+ */
+template <class OBJ> const AABBNode<OBJ> *AABBTree<OBJ>::getNode(OBJ object) const
 {
-    return rootNode;
+    auto itFind = objectsNode.find(object);
+    if(itFind!=objectsNode.end())
+    {
+        return &nodes[itFind->second];
+    }
+    return nullptr;
 }
 
+/**
+ * @return Node data of the object or null when object is not in the tree
+ */
 template <class OBJ> AABBNodeData<OBJ> *AABBTree<OBJ>::getNodeData(OBJ object) const
 {
-    return objectsNode.find(object)->second->getNodeData();
+    const AABBNode<OBJ> *leafNode = getNode(object);
+    return leafNode ? leafNode->getNodeData() : nullptr;
 }
 
 /**
@@ -41,125 +80,271 @@ template <class OBJ> AABBNodeData<OBJ> *AABBTree<OBJ>::getNodeData(OBJ object) c
 template <class OBJ> void AABBTree<OBJ>::getAllNodeObjects(std::vector<OBJ> &nodeObjects) const
 {
     browseNodes.clear();
-    if(rootNode != nullptr)
+    if(rootNodeIndex != AABBNode<OBJ>::NULL_NODE)
     {
-        browseNodes.push_back(rootNode);
+        browseNodes.push_back(rootNodeIndex);
     }
 
     for(std::size_t i=0; i<browseNodes.size(); ++i)
     { //tree traversal: pre-order (iterative)
-        const AABBNode<OBJ> *currentNode = browseNodes[i];
+        const AABBNode<OBJ> &currentNode = nodes[browseNodes[i]];
 
-        if (currentNode->isLeaf())
+        if (currentNode.isLeaf())
         {
-            nodeObjects.push_back(currentNode->getNodeData()->getNodeObject());
+            nodeObjects.push_back(currentNode.getNodeData()->getNodeObject());
         }else
         {
-            browseNodes.push_back(currentNode->getRightChild());
-            browseNodes.push_back(currentNode->getLeftChild());
+            browseNodes.push_back(currentNode.children[1]);
+            browseNodes.push_back(currentNode.children[0]);
         }
     }
 }
 
-template <class OBJ> std::vector<AABBNodeData<OBJ> *> AABBTree<OBJ>::extractAllNodeData()
+/**
+ * @param leafIndices [out] Indices of all leaves in tree pre-order
+ */
+template <class OBJ> void AABBTree<OBJ>::collectLeaves(std::vector<uint32_t> &leafIndices) const
 {
-    std::vector<AABBNodeData<OBJ> *> allNodeData = {};
-
     browseNodes.clear();
-    if(rootNode != nullptr)
+    if(rootNodeIndex != AABBNode<OBJ>::NULL_NODE)
     {
-        browseNodes.push_back(rootNode);
+        browseNodes.push_back(rootNodeIndex);
     }
 
     for(std::size_t i=0; i<browseNodes.size(); ++i)
     { //tree traversal: pre-order (iterative)
-        AABBNode<OBJ> *currentNode = browseNodes[i];
+        const AABBNode<OBJ> &currentNode = nodes[browseNodes[i]];
 
-        if (currentNode->isLeaf())
+        if (currentNode.isLeaf())
         {
-            allNodeData.push_back(currentNode->getNodeData());
-            currentNode->clearNodeData();
+            leafIndices.push_back(browseNodes[i]);
         }else
         {
-            browseNodes.push_back(currentNode->getRightChild());
-            browseNodes.push_back(currentNode->getLeftChild());
+            browseNodes.push_back(currentNode.children[1]);
+            browseNodes.push_back(currentNode.children[0]);
         }
     }
+}
 
-    return allNodeData;
+template<class OBJ> uint32_t AABBTree<OBJ>::allocateNode(AABBNodeData<OBJ> *nodeData)
+{
+    uint32_t nodeIndex;
+    if(freeNodeIndex != AABBNode<OBJ>::NULL_NODE)
+    {
+        nodeIndex = freeNodeIndex;
+        freeNodeIndex = nodes[nodeIndex].parentIndex;
+        nodes[nodeIndex] = AABBNode<OBJ>(nodeData);
+    }else
+    {
+        if(nodes.size() >= AABBNode<OBJ>::NULL_NODE)
+        {
+            throw std::runtime_error("Maximum number of nodes reached in AABBTree: " + std::to_string(nodes.size()));
+        }
+        nodeIndex = (uint32_t)nodes.size();
+        nodes.emplace_back(nodeData);
+    }
+    return nodeIndex;
 }
 
-template <class OBJ> void AABBTree<OBJ>::addObject(AABBNodeData<OBJ> *nodeData)
+template<class OBJ> void AABBTree<OBJ>::freeNode(uint32_t nodeIndex)
 {
-    auto *nodeToInsert = new AABBNode<OBJ>(nodeData);
+    AABBNode<OBJ> &node = nodes[nodeIndex];
+    node.nodeData = nullptr;
+    node.children[0] = AABBNode<OBJ>::NULL_NODE;
+    node.children[1] = AABBNode<OBJ>::NULL_NODE;
+    node.parentIndex = freeNodeIndex;
+    freeNodeIndex = nodeIndex;
+}
+
+/**
+ * @param childPosition 0 for left child, 1 for right child
+ */
+template<class OBJ> void AABBTree<OBJ>::setChild(uint32_t parentIndex, unsigned int childPosition, uint32_t childIndex)
+{
+    nodes[parentIndex].children[childPosition] = childIndex;
+    nodes[childIndex].parentIndex = parentIndex;
+}
 
-    if (rootNode)
+/**
+ * Compute fat AABBox for leaf and bounding box for branch
+ */
+template<class OBJ> void AABBTree<OBJ>::updateAABBox(uint32_t nodeIndex)
+{
+    AABBNode<OBJ> &node = nodes[nodeIndex];
+    if (node.isLeaf())
     {
-        nodeToInsert->updateAABBox(fatMargin);
-        insertNode(nodeToInsert, rootNode);
+        Point3<float> fatMargin3(fatMargin, fatMargin, fatMargin);
+        AABBox<float> objectBox = node.nodeData->retrieveObjectAABBox();
+
+        node.aabbox = AABBox<float>(objectBox.getMin()-fatMargin3, objectBox.getMax()+fatMargin3);
     }else
     {
-        rootNode = nodeToInsert;
-        rootNode->updateAABBox(fatMargin);
+        node.aabbox = nodes[node.children[0]].aabbox.merge(nodes[node.children[1]].aabbox);
     }
+}
+
+template <class OBJ> void AABBTree<OBJ>::addObject(AABBNodeData<OBJ> *nodeData)
+{
+    uint32_t nodeToInsert = allocateNode(nodeData);
+    updateAABBox(nodeToInsert);
+    insertLeaf(nodeToInsert);
 
     objectsNode[nodeData->getNodeObject()] = nodeToInsert;
+}
+
+/**
+ * Insert the leaf next to the sibling which minimizes the surface area heuristic (SAH) cost.
+ * Cost of a sibling is the area of the new parent node plus the area increase of all ancestors.
+ */
+template<class OBJ> void AABBTree<OBJ>::insertLeaf(uint32_t leafToInsert)
+{
+    if(rootNodeIndex == AABBNode<OBJ>::NULL_NODE)
+    {
+        rootNodeIndex = leafToInsert;
+        nodes[rootNodeIndex].parentIndex = AABBNode<OBJ>::NULL_NODE;
+        return;
+    }
 
-    postAddObjectCallback(nodeToInsert);
+    const AABBox<float> leafAABBox = nodes[leafToInsert].aabbox;
+    uint32_t siblingIndex = rootNodeIndex;
+    while(!nodes[siblingIndex].isLeaf())
+    {
+        const AABBNode<OBJ> &siblingNode = nodes[siblingIndex];
+        float area = siblingNode.aabbox.getSurfaceArea();
+        float combinedArea = siblingNode.aabbox.merge(leafAABBox).getSurfaceArea();
+
+        float newParentCost = 2.0f * combinedArea;
+        float inheritanceCost = 2.0f * (combinedArea - area);
+
+        float leftCost = computeDescendCost(siblingNode.children[0], leafAABBox) + inheritanceCost;
+        float rightCost = computeDescendCost(siblingNode.children[1], leafAABBox) + inheritanceCost;
+
+        if(newParentCost < leftCost && newParentCost < rightCost)
+        {
+            break;
+        }
+
+        siblingIndex = leftCost < rightCost ? siblingNode.children[0] : siblingNode.children[1];
+    }
+
+    uint32_t newParent = allocateNode(nullptr);
+    replaceNode(siblingIndex, newParent);
+    setChild(newParent, 0, leafToInsert);
+    setChild(newParent, 1, siblingIndex);
+
+    refitAncestors(newParent);
 }
 
-template<class OBJ>  void AABBTree<OBJ>::postAddObjectCallback(AABBNode<OBJ> *)
+template<class OBJ> float AABBTree<OBJ>::computeDescendCost(uint32_t nodeIndex, const AABBox<float> &leafAABBox) const
 {
-    //can be override
+    const AABBNode<OBJ> &node = nodes[nodeIndex];
+    float combinedArea = node.aabbox.merge(leafAABBox).getSurfaceArea();
+    if(node.isLeaf())
+    {
+        return combinedArea;
+    }
+    return combinedArea - node.aabbox.getSurfaceArea();
 }
 
-template<class OBJ> void AABBTree<OBJ>::insertNode(AABBNode<OBJ> *nodeToInsert, AABBNode<OBJ> *currentNode)
+template<class OBJ> void AABBTree<OBJ>::replaceNode(uint32_t nodeToReplace, uint32_t newNode)
 {
-    if (currentNode->isLeaf())
+    uint32_t parentIndex = nodes[nodeToReplace].parentIndex;
+    if(parentIndex != AABBNode<OBJ>::NULL_NODE)
     {
-        auto *newParent = new AABBNode<OBJ>(nullptr);
-        replaceNode(currentNode, newParent);
-        newParent->setLeftChild(nodeToInsert);
-        newParent->setRightChild(currentNode);
-        newParent->updateAABBox(fatMargin);
+        setChild(parentIndex, nodes[parentIndex].children[0]==nodeToReplace ? 0 : 1, newNode);
     }else
     {
-        const AABBox<float> &leftAABBox = currentNode->getLeftChild()->getAABBox();
-        float volumeDiffLeft = leftAABBox.merge(nodeToInsert->getAABBox()).getVolume() - leftAABBox.getVolume();
+        rootNodeIndex = newNode;
+        nodes[newNode].parentIndex = AABBNode<OBJ>::NULL_NODE;
+    }
+}
 
-        const AABBox<float> &rightAABBox = currentNode->getRightChild()->getAABBox();
-        float volumeDiffRight = rightAABBox.merge(nodeToInsert->getAABBox()).getVolume() - rightAABBox.getVolume();
+/**
+ * Refit the bounding boxes from the node up to the root and apply tree rotations on the way to keep the tree balanced
+ */
+template<class OBJ> void AABBTree<OBJ>::refitAncestors(uint32_t nodeIndex)
+{
+    while(nodeIndex != AABBNode<OBJ>::NULL_NODE)
+    {
+        rotateNode(nodeIndex);
+        updateAABBox(nodeIndex);
 
-        if(volumeDiffLeft < volumeDiffRight)
-        {
-            insertNode(nodeToInsert, currentNode->getLeftChild());
-        }else
+        nodeIndex = nodes[nodeIndex].parentIndex;
+    }
+}
+
+/**
+ * Swap a child of the node with a grandchild (child of the other child) when it reduces the surface area of the other child
+ */
+template<class OBJ> void AABBTree<OBJ>::rotateNode(uint32_t nodeIndex)
+{
+    const AABBNode<OBJ> &leftChild = nodes[nodes[nodeIndex].children[0]];
+    const AABBNode<OBJ> &rightChild = nodes[nodes[nodeIndex].children[1]];
+
+    float bestAreaDiff = 0.0f;
+    uint32_t bestChild = AABBNode<OBJ>::NULL_NODE;
+    uint32_t bestGrandChild = AABBNode<OBJ>::NULL_NODE;
+
+    if(!rightChild.isLeaf())
+    {
+        float rightArea = rightChild.aabbox.getSurfaceArea();
+
+        float areaDiff = leftChild.aabbox.merge(nodes[rightChild.children[1]].aabbox).getSurfaceArea() - rightArea;
+        if(areaDiff < bestAreaDiff)
         {
-            insertNode(nodeToInsert, currentNode->getRightChild());
+            bestAreaDiff = areaDiff;
+            bestChild = nodes[nodeIndex].children[0];
+            bestGrandChild = rightChild.children[0];
         }
 
-        currentNode->updateAABBox(fatMargin);
+        areaDiff = leftChild.aabbox.merge(nodes[rightChild.children[0]].aabbox).getSurfaceArea() - rightArea;
+        if(areaDiff < bestAreaDiff)
+        {
+            bestAreaDiff = areaDiff;
+            bestChild = nodes[nodeIndex].children[0];
+            bestGrandChild = rightChild.children[1];
+        }
     }
-}
 
-template<class OBJ> void AABBTree<OBJ>::replaceNode(AABBNode<OBJ> *nodeToReplace, AABBNode<OBJ> *newNode)
-{
-    if(nodeToReplace->getParent())
+    if(!leftChild.isLeaf())
     {
-        if(nodeToReplace->getParent()->getLeftChild()==nodeToReplace)
+        float leftArea = leftChild.aabbox.getSurfaceArea();
+
+        float areaDiff = rightChild.aabbox.merge(nodes[leftChild.children[1]].aabbox).getSurfaceArea() - leftArea;
+        if(areaDiff < bestAreaDiff)
         {
-            nodeToReplace->getParent()->setLeftChild(newNode);
-        }else
+            bestAreaDiff = areaDiff;
+            bestChild = nodes[nodeIndex].children[1];
+            bestGrandChild = leftChild.children[0];
+        }
+
+        areaDiff = rightChild.aabbox.merge(nodes[leftChild.children[0]].aabbox).getSurfaceArea() - leftArea;
+        if(areaDiff < bestAreaDiff)
         {
-            nodeToReplace->getParent()->setRightChild(newNode);
+            bestChild = nodes[nodeIndex].children[1];
+            bestGrandChild = leftChild.children[1];
         }
-    }else
+    }
+
+    if(bestChild != AABBNode<OBJ>::NULL_NODE)
     {
-        rootNode = newNode;
-        newNode->setParent(nullptr);
+        swapNodes(bestChild, bestGrandChild);
     }
 }
 
+template<class OBJ> void AABBTree<OBJ>::swapNodes(uint32_t child, uint32_t grandChild)
+{
+    uint32_t parentIndex = nodes[child].parentIndex;
+    uint32_t grandChildParentIndex = nodes[grandChild].parentIndex;
+    unsigned int childPosition = nodes[parentIndex].children[0]==child ? 0 : 1;
+    unsigned int grandChildPosition = nodes[grandChildParentIndex].children[0]==grandChild ? 0 : 1;
+
+    setChild(parentIndex, childPosition, grandChild);
+    setChild(grandChildParentIndex, grandChildPosition, child);
+
+    updateAABBox(grandChildParentIndex);
+}
+
 template<class OBJ> void AABBTree<OBJ>::removeObject(AABBNodeData<OBJ> *nodeData)
 {
     removeObject(nodeData->getNodeObject());
@@ -170,67 +355,143 @@ template<class OBJ> void AABBTree<OBJ>::removeObject(OBJ object)
     auto itFind = objectsNode.find(object);
     if(itFind!=objectsNode.end())
     {
-        AABBNode<OBJ> *nodeToRemove = itFind->second;
-        preRemoveObjectCallback(nodeToRemove);
+        uint32_t nodeToRemove = itFind->second;
+        objectsNode.erase(itFind);
 
-        objectsNode.erase(object);
-        removeNode(nodeToRemove);
+        detachLeaf(nodeToRemove);
+        delete nodes[nodeToRemove].nodeData;
+        freeNode(nodeToRemove);
     }
 }
 
-template<class OBJ> void AABBTree<OBJ>::preRemoveObjectCallback(AABBNode<OBJ> *)
-{
-    //can be override
-}
-
-template<class OBJ> void AABBTree<OBJ>::removeNode(AABBNode<OBJ> *nodeToRemove)
+/**
+ * Remove the leaf from the tree hierarchy without freeing it
+ */
+template<class OBJ> void AABBTree<OBJ>::detachLeaf(uint32_t leafToDetach)
 {
-    AABBNode<OBJ> *parentNode = nodeToRemove->getParent();
+    uint32_t parentIndex = nodes[leafToDetach].parentIndex;
 
-    if(!parentNode)
+    if(parentIndex == AABBNode<OBJ>::NULL_NODE)
     {
-        rootNode = nullptr;
+        rootNodeIndex = AABBNode<OBJ>::NULL_NODE;
     }else
     {
-        AABBNode<OBJ> *sibling = nodeToRemove->getSibling();
-        replaceNode(parentNode, sibling);
+        const AABBNode<OBJ> &parentNode = nodes[parentIndex];
+        uint32_t siblingIndex = parentNode.children[0]==leafToDetach ? parentNode.children[1] : parentNode.children[0];
+        replaceNode(parentIndex, siblingIndex);
+        freeNode(parentIndex);
 
-        parentNode->setLeftChild(nullptr); //avoid child removal
-        parentNode->setRightChild(nullptr); //avoid child removal
-        delete parentNode;
+        refitAncestors(nodes[siblingIndex].parentIndex);
+        nodes[leafToDetach].parentIndex = AABBNode<OBJ>::NULL_NODE;
     }
+}
 
-    delete nodeToRemove;
+/**
+ * Re-insert the object in the tree when its AABBox is not included anymore in the fat AABBox of its leaf
+ * @return True when the object has been re-inserted
+ */
+template<class OBJ> bool AABBTree<OBJ>::updateObject(OBJ object)
+{
+    auto itFind = objectsNode.find(object);
+    return itFind!=objectsNode.end() && updateLeaf(itFind->second);
 }
 
 template<class OBJ> void AABBTree<OBJ>::updateObjects()
 {
-    for(int i=objectsNode.size()-1; i>=0; --i)
-    { //loop backward to remove elements
-        auto it = objectsNode.begin();
-        std::advance(it, i);
-
-        AABBNode<OBJ> *leaf = it->second;
-        if(it->second->getNodeData()->isObjectMoving())
+    for(uint32_t nodeIndex=0; nodeIndex<(uint32_t)nodes.size(); ++nodeIndex)
+    { //leaf indices are not modified by update: pool can be iterated while leaves are re-inserted
+        const AABBNode<OBJ> &node = nodes[nodeIndex];
+        if(node.isLeaf() && node.nodeData && node.nodeData->isObjectMoving())
         {
-            preUpdateObjectCallback(leaf);
+            updateLeaf(nodeIndex);
+        }
+    }
+}
 
-            const AABBox<float> &leafFatAABBox = leaf->getAABBox();
-            const AABBox<float> &objectAABBox = leaf->getNodeData()->retrieveObjectAABBox();
+template<class OBJ> bool AABBTree<OBJ>::updateLeaf(uint32_t leafIndex)
+{
+    const AABBox<float> &leafFatAABBox = nodes[leafIndex].aabbox;
+    const AABBox<float> &objectAABBox = nodes[leafIndex].nodeData->retrieveObjectAABBox();
+    if(leafFatAABBox.include(objectAABBox))
+    {
+        return false;
+    }
 
-            if(!leafFatAABBox.include(objectAABBox))
-            {
-                AABBNodeData<OBJ> *clonedNodeData = leaf->getNodeData()->clone();
-                removeObject(leaf->getNodeData());
-                addObject(clonedNodeData);
-            }
+    detachLeaf(leafIndex);
+    updateAABBox(leafIndex);
+    insertLeaf(leafIndex);
+    return true;
+}
+
+/**
+ * Rebuild the whole tree from top to bottom by splitting the leaves at the median of the largest axis.
+ * Rebuild produces a better tree than incremental insertions but is too expensive to be executed when objects move.
+ */
+template<class OBJ> void AABBTree<OBJ>::rebuild()
+{
+    if(rootNodeIndex == AABBNode<OBJ>::NULL_NODE || nodes[rootNodeIndex].isLeaf())
+    {
+        return;
+    }
+
+    std::vector<uint32_t> leafIndices;
+    leafIndices.reserve(objectsNode.size());
+    collectLeaves(leafIndices);
+
+    for(uint32_t nodeIndex=0; nodeIndex<(uint32_t)nodes.size(); ++nodeIndex)
+    {
+        const AABBNode<OBJ> &node = nodes[nodeIndex];
+        if(!node.isLeaf())
+        {
+            freeNode(nodeIndex);
         }
     }
+
+    rootNodeIndex = buildSubtree(leafIndices.begin(), leafIndices.end());
+    nodes[rootNodeIndex].parentIndex = AABBNode<OBJ>::NULL_NODE;
 }
 
-template<class OBJ> void AABBTree<OBJ>::preUpdateObjectCallback(AABBNode<OBJ> *)
+template<class OBJ> uint32_t AABBTree<OBJ>::buildSubtree(std::vector<uint32_t>::iterator begin, std::vector<uint32_t>::iterator end)
 {
-    //can be override
+    auto nbLeaves = std::distance(begin, end);
+    if(nbLeaves==1)
+    {
+        return *begin;
+    }
+
+    Point3<float> minCenter(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+    Point3<float> maxCenter(-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max(), -std::numeric_limits<float>::max());
+    for(auto it = begin; it!=end; ++it)
+    {
+        Point3<float> center = nodes[*it].aabbox.getCenterOfMass();
+        for(int axis=0; axis<3; ++axis)
+        {
+            minCenter[axis] = std::min(minCenter[axis], center[axis]);
+            maxCenter[axis] = std::max(maxCenter[axis], center[axis]);
+        }
+    }
+
+    int splitAxis = 0;
+    for(int axis=1; axis<3; ++axis)
+    {
+        if(maxCenter[axis] - minCenter[axis] > maxCenter[splitAxis] - minCenter[splitAxis])
+        {
+            splitAxis = axis;
+        }
+    }
+
+    auto middle = begin + nbLeaves / 2;
+    std::nth_element(begin, middle, end, [&](uint32_t leafIndex1, uint32_t leafIndex2) {
+        return nodes[leafIndex1].aabbox.getCenterOfMass()[splitAxis] < nodes[leafIndex2].aabbox.getCenterOfMass()[splitAxis];
+    });
+
+    uint32_t leftChild = buildSubtree(begin, middle);
+    uint32_t rightChild = buildSubtree(middle, end);
+    uint32_t branchNode = allocateNode(nullptr);
+    setChild(branchNode, 0, leftChild);
+    setChild(branchNode, 1, rightChild);
+    updateAABBox(branchNode);
+    return branchNode;
 }
 
 /**
@@ -239,24 +500,24 @@ template<class OBJ> void AABBTree<OBJ>::preUpdateObjectCallback(AABBNode<OBJ> *)
 template<class OBJ> void AABBTree<OBJ>::aabboxQuery(const AABBox<float> &aabbox, std::vector<OBJ> &objectsAABBoxHit) const
 {
     browseNodes.clear();
-    if(rootNode != nullptr)
+    if(rootNodeIndex != AABBNode<OBJ>::NULL_NODE)
     {
-        browseNodes.push_back(rootNode);
+        browseNodes.push_back(rootNodeIndex);
     }
 
     for(std::size_t i=0; i<browseNodes.size(); ++i)
     { //tree traversal: pre-order (iterative)
-        const AABBNode<OBJ> *currentNode = browseNodes[i];
+        const AABBNode<OBJ> &currentNode = nodes[browseNodes[i]];
 
-        if(currentNode->getAABBox().collideWithAABBox(aabbox))
+        if(currentNode.aabbox.collideWithAABBox(aabbox))
         {
-            if (currentNode->isLeaf())
+            if (currentNode.isLeaf())
             {
-                objectsAABBoxHit.push_back(currentNode->getNodeData()->getNodeObject());
+                objectsAABBoxHit.push_back(currentNode.nodeData->getNodeObject());
             }else
             {
-                browseNodes.push_back(currentNode->getRightChild());
-                browseNodes.push_back(currentNode->getLeftChild());
+                browseNodes.push_back(currentNode.children[1]);
+                browseNodes.push_back(currentNode.children[0]);
             }
         }
     }
@@ -268,24 +529,80 @@ template<class OBJ> void AABBTree<OBJ>::aabboxQuery(const AABBox<float> &aabbox,
 template<class OBJ> void AABBTree<OBJ>::rayQuery(const Ray<float> &ray, std::vector<OBJ> &objectsAABBoxHitRay) const
 {
     browseNodes.clear();
-    if(rootNode != nullptr)
+    if(rootNodeIndex != AABBNode<OBJ>::NULL_NODE)
     {
-        browseNodes.push_back(rootNode);
+        browseNodes.push_back(rootNodeIndex);
     }
 
     for(std::size_t i=0; i<browseNodes.size(); ++i)
     { //tree traversal: pre-order (iterative)
-        const AABBNode<OBJ> *currentNode = browseNodes[i];
+        const AABBNode<OBJ> &currentNode = nodes[browseNodes[i]];
+
+        if(currentNode.aabbox.collideWithRay(ray))
+        {
+            if (currentNode.isLeaf())
+            {
+                objectsAABBoxHitRay.push_back(currentNode.nodeData->getNodeObject());
+            }else
+            {
+                browseNodes.push_back(currentNode.children[1]);
+                browseNodes.push_back(currentNode.children[0]);
+            }
+        }
+    }
+}
+
+/**
+ * Process a ray query for a batch of rays in one tree traversal. Rays are traversed together as a packet: each node box is
+ * tested against all the rays of the packet which reached it and only the rays hitting the box continue in the children.
+ * @param rayIndexObjectsAABBoxHitRays [out] Pairs of ray index and object AABBox hit by this ray
+ */
+template<class OBJ> void AABBTree<OBJ>::rayBatchQuery(const std::vector<Ray<float>> &rays, std::vector<std::pair<uint32_t, OBJ>> &rayIndexObjectsAABBoxHitRays) const
+{
+    browseRayPackets.clear();
+    browseRayIndices.clear();
+    if(rootNodeIndex != AABBNode<OBJ>::NULL_NODE && !rays.empty())
+    {
+        for(uint32_t rayIndex = 0; rayIndex < rays.size(); ++rayIndex)
+        {
+            browseRayIndices.push_back(rayIndex);
+        }
+        browseRayPackets.push_back({rootNodeIndex, 0, rays.size()});
+    }
+
+    while(!browseRayPackets.empty())
+    { //tree traversal: pre-order (iterative)
+        RayPacket rayPacket = browseRayPackets.back();
+        browseRayPackets.pop_back();
+        const AABBNode<OBJ> &currentNode = nodes[rayPacket.nodeIndex];
+
+        //ray indices stored after the packet rays belong to sub-trees already browsed
+        std::size_t firstHitRayPosition = rayPacket.firstRayPosition + rayPacket.nbRays;
+        browseRayIndices.resize(firstHitRayPosition);
+
+        for(std::size_t i = rayPacket.firstRayPosition; i < firstHitRayPosition; ++i)
+        {
+            uint32_t rayIndex = browseRayIndices[i];
+            if(currentNode.aabbox.collideWithRay(rays[rayIndex]))
+            {
+                browseRayIndices.push_back(rayIndex);
+            }
+        }
 
-        if(currentNode->getAABBox().collideWithRay(ray))
+        std::size_t nbHitRays = browseRayIndices.size() - firstHitRayPosition;
+        if(nbHitRays > 0)
         {
-            if (currentNode->isLeaf())
+            if (currentNode.isLeaf())
             {
-                objectsAABBoxHitRay.push_back(currentNode->getNodeData()->getNodeObject());
+                OBJ object = currentNode.nodeData->getNodeObject();
+                for(std::size_t i = firstHitRayPosition; i < browseRayIndices.size(); ++i)
+                {
+                    rayIndexObjectsAABBoxHitRays.emplace_back(browseRayIndices[i], object);
+                }
             }else
             {
-                browseNodes.push_back(currentNode->getRightChild());
-                browseNodes.push_back(currentNode->getLeftChild());
+                browseRayPackets.push_back({currentNode.children[1], firstHitRayPosition, nbHitRays});
+                browseRayPackets.push_back({currentNode.children[0], firstHitRayPosition, nbHitRays});
             }
         }
     }
@@ -301,29 +618,29 @@ template<class OBJ> void AABBTree<OBJ>::enlargedRayQuery(const Ray<float> &ray,
                                std::vector<OBJ> &objectsAABBoxHitEnlargedRay) const
 {
     browseNodes.clear();
-    if(rootNode != nullptr)
+    if(rootNodeIndex != AABBNode<OBJ>::NULL_NODE)
     {
-        browseNodes.push_back(rootNode);
+        browseNodes.push_back(rootNodeIndex);
     }
 
     for(std::size_t i=0; i<browseNodes.size(); ++i)
     { //tree traversal: pre-order (iterative)
-        const AABBNode<OBJ> *currentNode = browseNodes[i];
+        const AABBNode<OBJ> &currentNode = nodes[browseNodes[i]];
 
-        AABBox<float> extendedNodeAABBox = currentNode->getAABBox().enlarge(enlargeNodeBoxHalfSize, enlargeNodeBoxHalfSize);
+        AABBox<float> extendedNodeAABBox = currentNode.aabbox.enlarge(enlargeNodeBoxHalfSize, enlargeNodeBoxHalfSize);
         if(extendedNodeAABBox.collideWithRay(ray))
         {
-            if (currentNode->isLeaf())
+            if (currentNode.isLeaf())
             {
-                OBJ object = currentNode->getNodeData()->getNodeObject();
+                OBJ object = currentNode.nodeData->getNodeObject();
                 if(object!=objectToExclude)
                 {
                     objectsAABBoxHitEnlargedRay.push_back(object);
                 }
             }else
             {
-                browseNodes.push_back(currentNode->getRightChild());
-                browseNodes.push_back(currentNode->getLeftChild());
+                browseNodes.push_back(currentNode.children[1]);
+                browseNodes.push_back(currentNode.children[0]);
             }
         }
     }
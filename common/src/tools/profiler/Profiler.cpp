@@ -1,23 +1,48 @@
 #include <iostream>
-#include <cassert>
+#include <iomanip>
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <chrono>
 
 #include "Profiler.h"
 #include "tools/ConfigService.h"
 #include "tools/logger/Logger.h"
 #include "tools/logger/FileLogger.h"
 
+#define PROFILER_TRACE_EVENTS_BY_THREAD 16384
+#define PROFILER_INSTANCES_CACHE_SIZE 64
+
 namespace urchin
 {
     //static
+    std::mutex Profiler::instancesMutex;
     std::map<std::string, std::shared_ptr<Profiler>> Profiler::instances;
+    std::mutex Profiler::threadTracesMutex;
+    std::vector<std::unique_ptr<Profiler::ThreadTrace>> Profiler::threadTraces;
+
+    Profiler::ThreadTrace::ThreadTrace(unsigned int threadIndex) :
+            threadIndex(threadIndex),
+            firstProfiler(nullptr),
+            nbEvents(0),
+            events(new TraceEvent[PROFILER_TRACE_EVENTS_BY_THREAD])
+    {
+
+    }
+
+    Profiler::ThreadTrace::~ThreadTrace()
+    {
+        delete[] events;
+    }
 
     Profiler::Profiler(const std::string &instanceName) :
+            profiledThreadId(std::this_thread::get_id()),
             instanceName(instanceName),
             profilerRoot(new ProfilerNode("root", nullptr)),
             currentNode(profilerRoot)
     {
         std::string enableKey = "profiler." + instanceName + "Enable";
-        isEnable = ConfigService::instance()->getBoolValue(enableKey);
+        isEnable.store(ConfigService::instance()->getBoolValue(enableKey), std::memory_order_relaxed);
     }
 
     Profiler::~Profiler()
@@ -27,6 +52,8 @@ namespace urchin
 
     std::shared_ptr<Profiler> Profiler::getInstance(const std::string &instanceName)
     {
+        std::lock_guard<std::mutex> lock(instancesMutex);
+
         auto instanceIt = instances.find(instanceName);
         if(instanceIt!=instances.end())
         {
@@ -38,13 +65,46 @@ namespace urchin
         return profiler;
     }
 
-    void Profiler::startNewProfile(const std::string &nodeName)
+    /**
+     * Find the instance from a string literal name. Instances are cached by address of the name for the calling thread:
+     * the map look-up and its lock are only done at the first call of each name address on each thread.
+     */
+    Profiler *Profiler::findInstance(const char *instanceName)
     {
-        if(isEnable)
+        thread_local std::array<std::pair<const char *, Profiler *>, PROFILER_INSTANCES_CACHE_SIZE> instancesCache{};
+
+        std::size_t cacheIndex = (reinterpret_cast<uintptr_t>(instanceName) >> 3u) % PROFILER_INSTANCES_CACHE_SIZE;
+        for(std::size_t i = 0; i < PROFILER_INSTANCES_CACHE_SIZE; ++i)
         {
-            assert(nodeName.length() <= 15); //ensure to use "small string optimization"
+            auto &cachedInstance = instancesCache[(cacheIndex + i) % PROFILER_INSTANCES_CACHE_SIZE];
+            if(cachedInstance.first == instanceName)
+            {
+                return cachedInstance.second;
+            }else if(cachedInstance.first == nullptr)
+            {
+                Profiler *profiler = getInstance(instanceName).get(); //instances are never destroyed before the end of the program
+                cachedInstance = std::make_pair(instanceName, profiler);
+                return profiler;
+            }
+        }
+
+        return getInstance(instanceName).get(); //cache full
+    }
 
-            if (currentNode->getName() == nodeName)
+    bool Profiler::isEnabled() const
+    {
+        return isEnable.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Start a profile. Calls coming from another thread than the profiled thread (e.g. worker threads) are ignored.
+     * @param nodeName Name of the zone: a string literal is expected because the nodes are identified by the address of the name
+     */
+    void Profiler::startNewProfile(const char *nodeName)
+    {
+        if(isEnabled() && std::this_thread::get_id() == profiledThreadId)
+        {
+            if (currentNode->hasName(nodeName))
             {
                 currentNode->startTimer();
             } else
@@ -62,13 +122,13 @@ namespace urchin
         }
     }
 
-    void Profiler::stopProfile(const std::string &nodeName)
+    void Profiler::stopProfile(const char *nodeName)
     {
-        if(isEnable)
+        if(isEnabled() && std::this_thread::get_id() == profiledThreadId)
         {
-            if (!nodeName.empty() && currentNode->getName() != nodeName)
+            if (nodeName != nullptr && !currentNode->hasName(nodeName))
             {
-                throw std::runtime_error("Impossible to stop node '" + nodeName + "' because current node is '" + currentNode->getName() + "'");
+                throw std::runtime_error("Impossible to stop node '" + std::string(nodeName) + "' because current node is '" + currentNode->getName() + "'");
             }
 
             if (currentNode->getParent() == nullptr)
@@ -85,9 +145,85 @@ namespace urchin
         }
     }
 
+    /**
+     * Record a zone in the trace ring buffer of the calling thread. Oldest events are overwritten when the buffer is full.
+     * No lock is taken: each thread writes in its own buffer.
+     * @param zoneName Name of the zone: a string literal is expected because the address is kept in the trace
+     */
+    void Profiler::addTraceEvent(const char *zoneName, int64_t startTimeNs, int64_t endTimeNs)
+    {
+        if(isEnabled())
+        {
+            ThreadTrace *threadTrace = getThreadTrace();
+            if(threadTrace->firstProfiler.load(std::memory_order_relaxed) == nullptr)
+            {
+                threadTrace->firstProfiler.store(this, std::memory_order_relaxed);
+            }
+
+            uint64_t eventIndex = threadTrace->nbEvents.load(std::memory_order_relaxed);
+            TraceEvent &traceEvent = threadTrace->events[eventIndex % PROFILER_TRACE_EVENTS_BY_THREAD];
+            traceEvent.zoneName = zoneName;
+            traceEvent.profiler = this;
+            traceEvent.startTimeNs = startTimeNs;
+            traceEvent.durationNs = endTimeNs - startTimeNs;
+            threadTrace->nbEvents.store(eventIndex + 1, std::memory_order_release);
+        }
+    }
+
+    /**
+     * @return Trace buffer of the calling thread. The buffer is created at first call and it is kept after the end of the
+     * thread to allow the export of its events.
+     */
+    Profiler::ThreadTrace *Profiler::getThreadTrace()
+    {
+        thread_local ThreadTrace *threadTrace = nullptr;
+        if(threadTrace == nullptr)
+        {
+            std::lock_guard<std::mutex> lock(threadTracesMutex);
+            threadTraces.push_back(std::make_unique<ThreadTrace>(static_cast<unsigned int>(threadTraces.size()) + 1));
+            threadTrace = threadTraces.back().get();
+        }
+        return threadTrace;
+    }
+
+    /**
+     * Update the value of a counter (e.g. pool usage). Counters are logged with the profiling result. Calls can come from
+     * any thread.
+     */
+    void Profiler::updateCounter(const std::string &counterName, unsigned int value)
+    {
+        if(isEnabled())
+        {
+            std::lock_guard<std::mutex> lock(countersMutex);
+            counters[counterName] = value;
+        }
+    }
+
+    /**
+     * Clear the profiling results and profile the calling thread. This method must not be called while a profile is in progress.
+     * @param isEnable Enable or disable the profiler regardless of the configuration (e.g. benchmarks)
+     */
+    void Profiler::reset(bool isEnable)
+    {
+        if (currentNode != profilerRoot)
+        {
+            throw std::runtime_error("Current node must be the root node to reset the profiler. Current node: " + currentNode->getName());
+        }
+
+        delete profilerRoot;
+        profilerRoot = new ProfilerNode("root", nullptr);
+        currentNode = profilerRoot;
+        profiledThreadId = std::this_thread::get_id();
+
+        std::lock_guard<std::mutex> lock(countersMutex);
+        counters.clear();
+
+        this->isEnable.store(isEnable, std::memory_order_relaxed);
+    }
+
     void Profiler::log()
     {
-        if(isEnable)
+        if(isEnabled())
         {
             if (currentNode != profilerRoot)
             {
@@ -101,9 +237,116 @@ namespace urchin
             logStream << "Profiling result (" << instanceName << "):" << std::endl;
             profilerRoot->log(0, logStream, -1.0);
 
+            std::lock_guard<std::mutex> lock(countersMutex);
+            if(!counters.empty())
+            {
+                logStream << "Counters (" << instanceName << "):" << std::endl;
+                for(const auto &counter : counters)
+                {
+                    logStream << " - " << counter.first << ": " << counter.second << std::endl;
+                }
+            }
+
             Logger::logger().logInfo(logStream.str());
             Logger::defineLogger(std::move(oldLogger));
         }
     }
 
+    /**
+     * Write the profiling result and the counters in JSON format (e.g. regression tracking of benchmarks)
+     */
+    void Profiler::writeJson(std::ostream &jsonStream)
+    {
+        if (currentNode != profilerRoot)
+        {
+            throw std::runtime_error("Current node must be the root node to write JSON. Current node: " + currentNode->getName());
+        }
+
+        jsonStream << "{\"instance\":\"" << instanceName << "\",\"nodes\":[";
+        std::vector<ProfilerNode *> nodes = profilerRoot->getChildren();
+        for(std::size_t i=0; i<nodes.size(); ++i)
+        {
+            jsonStream << (i==0 ? "" : ",");
+            nodes[i]->writeJson(jsonStream);
+        }
+        jsonStream << "],\"counters\":{";
+
+        std::lock_guard<std::mutex> lock(countersMutex);
+        for(auto it = counters.begin(); it != counters.end(); ++it)
+        {
+            jsonStream << (it==counters.begin() ? "" : ",") << "\"" << it->first << "\":" << it->second;
+        }
+        jsonStream << "}}";
+    }
+
+    int64_t Profiler::currentTimeNs()
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    /**
+     * Write the trace events of all threads and all profiler instances in Chrome trace format. Times are expressed in
+     * microseconds from the first event. The threads are named with the profiler instance of their first event.
+     * The trace should be written when the profiled threads are idle: events written at the same time can be incoherent.
+     */
+    void Profiler::writeChromeTrace(std::ostream &traceStream)
+    {
+        std::lock_guard<std::mutex> lock(threadTracesMutex);
+
+        int64_t originTimeNs = std::numeric_limits<int64_t>::max();
+        for(const auto &threadTrace : threadTraces)
+        {
+            uint64_t nbEvents = threadTrace->nbEvents.load(std::memory_order_acquire);
+            for(uint64_t i = nbEvents - std::min(nbEvents, (uint64_t)PROFILER_TRACE_EVENTS_BY_THREAD); i < nbEvents; ++i)
+            {
+                originTimeNs = std::min(originTimeNs, threadTrace->events[i % PROFILER_TRACE_EVENTS_BY_THREAD].startTimeNs);
+            }
+        }
+
+        std::ios_base::fmtflags oldFlags = traceStream.flags();
+        std::streamsize oldPrecision = traceStream.precision();
+        traceStream << std::fixed << std::setprecision(3);
+
+        traceStream << "{\"traceEvents\":[";
+        bool isFirstEvent = true;
+        for(const auto &threadTrace : threadTraces)
+        {
+            const Profiler *firstProfiler = threadTrace->firstProfiler.load(std::memory_order_relaxed);
+            if(firstProfiler != nullptr)
+            {
+                traceStream << (isFirstEvent ? "" : ",") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << threadTrace->threadIndex
+                        << ",\"args\":{\"name\":\"" << firstProfiler->instanceName << "-" << threadTrace->threadIndex << "\"}}";
+                isFirstEvent = false;
+            }
+
+            uint64_t nbEvents = threadTrace->nbEvents.load(std::memory_order_acquire);
+            for(uint64_t i = nbEvents - std::min(nbEvents, (uint64_t)PROFILER_TRACE_EVENTS_BY_THREAD); i < nbEvents; ++i)
+            {
+                const TraceEvent &traceEvent = threadTrace->events[i % PROFILER_TRACE_EVENTS_BY_THREAD];
+                traceStream << (isFirstEvent ? "" : ",") << "{\"name\":\"" << traceEvent.zoneName << "\",\"cat\":\"" << traceEvent.profiler->instanceName
+                        << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << threadTrace->threadIndex
+                        << ",\"ts\":" << (double)(traceEvent.startTimeNs - originTimeNs) / 1000.0
+                        << ",\"dur\":" << (double)traceEvent.durationNs / 1000.0 << "}";
+                isFirstEvent = false;
+            }
+        }
+        traceStream << "],\"displayTimeUnit\":\"ms\"}";
+
+        traceStream.flags(oldFlags);
+        traceStream.precision(oldPrecision);
+    }
+
+    /**
+     * Remove the trace events of all threads. This method must not be called while a profiled thread is running.
+     */
+    void Profiler::clearTrace()
+    {
+        std::lock_guard<std::mutex> lock(threadTracesMutex);
+        for(const auto &threadTrace : threadTraces)
+        {
+            threadTrace->nbEvents.store(0, std::memory_order_relaxed);
+            threadTrace->firstProfiler.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
 }
@@ -3,13 +3,23 @@
 
 #include <memory>
 #include <map>
-#include <stack>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <ostream>
+#include <cstdint>
 
 #include "tools/profiler/ProfilerNode.h"
 
 namespace urchin
 {
 
+    /**
+     * Hierarchical profiler of an engine (physics, ai, 3d, sound). Zones are identified by the address of their name: names
+     * must be string literals. The hierarchical result is built for the profiled thread while all threads record their zones
+     * in their own trace ring buffer which can be exported in Chrome trace format (chrome://tracing, Perfetto).
+     */
     class Profiler
     {
         public:
@@ -17,20 +27,62 @@ namespace urchin
             ~Profiler();
 
             static std::shared_ptr<Profiler> getInstance(const std::string &);
+            static Profiler *findInstance(const char *);
 
-            void startNewProfile(const std::string &);
-            void stopProfile(const std::string &nodeName = "");
+            bool isEnabled() const;
+
+            void startNewProfile(const char *);
+            void stopProfile(const char *nodeName = nullptr);
+            void addTraceEvent(const char *, int64_t, int64_t);
+
+            void updateCounter(const std::string &, unsigned int);
+
+            void reset(bool);
 
             void log();
+            void writeJson(std::ostream &);
+
+            static int64_t currentTimeNs();
+            static void writeChromeTrace(std::ostream &);
+            static void clearTrace();
 
         private:
+            struct TraceEvent
+            {
+                const char *zoneName;
+                const Profiler *profiler;
+                int64_t startTimeNs;
+                int64_t durationNs;
+            };
+
+            struct ThreadTrace
+            {
+                explicit ThreadTrace(unsigned int);
+                ~ThreadTrace();
+
+                unsigned int threadIndex;
+                std::atomic<const Profiler *> firstProfiler; //profiler used to name the thread in trace
+                std::atomic<uint64_t> nbEvents;
+                TraceEvent *events;
+            };
+
+            static ThreadTrace *getThreadTrace();
+
+            static std::mutex instancesMutex;
             static std::map<std::string, std::shared_ptr<Profiler>> instances;
 
-            bool isEnable;
+            static std::mutex threadTracesMutex;
+            static std::vector<std::unique_ptr<ThreadTrace>> threadTraces;
+
+            std::atomic<bool> isEnable;
+            std::thread::id profiledThreadId;
             std::string instanceName;
 
             ProfilerNode *profilerRoot;
             ProfilerNode *currentNode;
+
+            std::mutex countersMutex;
+            std::map<std::string, unsigned int> counters;
     };
 
 }
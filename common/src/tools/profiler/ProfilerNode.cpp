@@ -1,17 +1,23 @@
 #include <stdexcept>
 #include <iostream>
-#include <numeric>
 #include <iomanip>
-#include <utility>
+#include <cstring>
+#include <algorithm>
 
 #include "ProfilerNode.h"
 
 namespace urchin
 {
-    ProfilerNode::ProfilerNode(std::string name, ProfilerNode *parent) :
-            name(std::move(name)),
+    /**
+     * @param name Name of the node: a string literal is expected because the node is identified by the address of the name
+     */
+    ProfilerNode::ProfilerNode(const char *name, ProfilerNode *parent) :
+            nameId(name),
+            name(name),
             parent(parent),
-            startCount(0)
+            startCount(0),
+            nbTimes(0),
+            totalTimes(0.0)
     {
 
     }
@@ -29,6 +35,15 @@ namespace urchin
         return name;
     }
 
+    /**
+     * @return True when node has the name. Names are compared by address: same names defined in several translation units
+     * are compared by value.
+     */
+    bool ProfilerNode::hasName(const char *name) const
+    {
+        return nameId == name || std::strcmp(nameId, name) == 0;
+    }
+
     ProfilerNode *ProfilerNode::getParent() const
     {
         return parent;
@@ -39,11 +54,19 @@ namespace urchin
         return children;
     }
 
-    ProfilerNode *ProfilerNode::findChildren(const std::string &name) const
+    ProfilerNode *ProfilerNode::findChildren(const char *name) const
     {
         for(const auto &child : children)
         {
-            if(child->getName() == name)
+            if(child->nameId == name)
+            {
+                return child;
+            }
+        }
+
+        for(const auto &child : children)
+        {
+            if(std::strcmp(child->nameId, name) == 0)
             {
                 return child;
             }
@@ -85,7 +108,11 @@ namespace urchin
             auto endTime = std::chrono::high_resolution_clock::now();
             double durationMs = static_cast<std::chrono::duration<double, std::milli>>(endTime - startTime).count();
 
-            times.push_back(durationMs);
+            if(nbTimes > 0)
+            { //remove first time (avoid counting time for potential initialization process)
+                totalTimes += durationMs;
+            }
+            nbTimes++;
             isStopped = true;
         }
 
@@ -95,13 +122,13 @@ namespace urchin
     }
 
     double ProfilerNode::computeTotalTimes() const
-    { //remove first element (avoid counting time for potential initialization process)
-        return std::accumulate(times.begin() + 1, times.end(), 0.0);
+    {
+        return totalTimes;
     }
 
     int ProfilerNode::getNbValidTimes() const
-    { //remove first element (avoid counting time for potential initialization process)
-        return static_cast<int>(times.size()) - 1;
+    { //remove first time (avoid counting time for potential initialization process)
+        return static_cast<int>(nbTimes) - 1;
     }
 
     void ProfilerNode::log(unsigned int level, std::stringstream &logStream, double levelOneTotalTime)
@@ -148,4 +175,26 @@ namespace urchin
             child->log(level + 1, logStream, levelOneTotalTime);
         }
     }
+
+    /**
+     * Write the node and its children in JSON format. Times are expressed in milliseconds.
+     */
+    void ProfilerNode::writeJson(std::ostream &jsonStream) const
+    {
+        int nbValidTimes = std::max(0, getNbValidTimes());
+        double totalTime = nbValidTimes > 0 ? computeTotalTimes() : 0.0;
+        double averageTime = nbValidTimes > 0 ? totalTime / nbValidTimes : 0.0;
+
+        jsonStream << "{\"name\":\"" << name << "\"";
+        jsonStream << ",\"calls\":" << nbValidTimes;
+        jsonStream << ",\"totalMs\":" << totalTime;
+        jsonStream << ",\"averageMs\":" << averageTime;
+        jsonStream << ",\"children\":[";
+        for(std::size_t i=0; i<children.size(); ++i)
+        {
+            jsonStream << (i==0 ? "" : ",");
+            children[i]->writeJson(jsonStream);
+        }
+        jsonStream << "]}";
+    }
 }
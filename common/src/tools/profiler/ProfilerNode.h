@@ -4,6 +4,7 @@
 #include <chrono>
 #include <string>
 #include <vector>
+#include <ostream>
 
 namespace urchin
 {
@@ -11,15 +12,16 @@ namespace urchin
     class ProfilerNode
     {
         public:
-            ProfilerNode(std::string , ProfilerNode *);
+            ProfilerNode(const char *, ProfilerNode *);
             ~ProfilerNode();
 
             const std::string &getName() const;
+            bool hasName(const char *) const;
 
             ProfilerNode *getParent() const;
 
             std::vector<ProfilerNode *> getChildren() const;
-            ProfilerNode *findChildren(const std::string &) const;
+            ProfilerNode *findChildren(const char *) const;
             void addChild(ProfilerNode *);
 
             bool isStarted();
@@ -27,18 +29,21 @@ namespace urchin
             bool stopTimer();
 
             void log(unsigned int, std::stringstream &, double);
+            void writeJson(std::ostream &) const;
 
         private:
             double computeTotalTimes() const;
             int getNbValidTimes() const;
 
+            const char *nameId;
             std::string name;
             ProfilerNode *parent;
             std::vector<ProfilerNode *> children;
 
             unsigned int startCount;
             std::chrono::time_point<std::chrono::high_resolution_clock> startTime;
-            std::vector<double> times;
+            unsigned int nbTimes;
+            double totalTimes; //first time excluded
     };
 
 }
@@ -3,15 +3,25 @@
 
 namespace urchin
 {
-    ScopeProfiler::ScopeProfiler(const std::string &instanceName, const std::string &nodeName) :
-            instanceName(instanceName),
-            nodeName(nodeName)
+    ScopeProfiler::ScopeProfiler(const char *instanceName, const char *nodeName) :
+            profiler(Profiler::findInstance(instanceName)),
+            nodeName(nodeName),
+            isProfiling(profiler->isEnabled()),
+            startTimeNs(0)
     {
-        Profiler::getInstance(instanceName)->startNewProfile(nodeName);
+        if(isProfiling)
+        {
+            profiler->startNewProfile(nodeName);
+            startTimeNs = Profiler::currentTimeNs();
+        }
     }
 
     ScopeProfiler::~ScopeProfiler()
     {
-        Profiler::getInstance(instanceName)->stopProfile(nodeName);
+        if(isProfiling)
+        {
+            profiler->addTraceEvent(nodeName, startTimeNs, Profiler::currentTimeNs());
+            profiler->stopProfile(nodeName);
+        }
     }
 }
@@ -1,20 +1,28 @@
 #ifndef URCHINENGINE_SCOPEPROFILER_H
 #define URCHINENGINE_SCOPEPROFILER_H
 
-#include <string>
+#include <cstdint>
 
 namespace urchin
 {
 
+    class Profiler;
+
+    /**
+     * Profile the scope. Instance and node names must be string literals: they are identified by their address. When the
+     * profiler instance is disabled, the cost is limited to a look-up in a small cache of the thread.
+     */
     class ScopeProfiler
     {
         public:
-            ScopeProfiler(const std::string &, const std::string &);
+            ScopeProfiler(const char *, const char *);
             ~ScopeProfiler();
 
         private:
-            std::string instanceName;
-            std::string nodeName;
+            Profiler *profiler;
+            const char *nodeName;
+            bool isProfiling;
+            int64_t startTimeNs;
     };
 
 }
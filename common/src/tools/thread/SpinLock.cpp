@@ -0,0 +1,49 @@
+#include <thread>
+#if defined(__SSE2__)
+    #include <emmintrin.h>
+#endif
+
+#include "SpinLock.h"
+
+#define MAX_SPINS_BEFORE_YIELD 64
+
+namespace urchin
+{
+
+    SpinLock::SpinLock() :
+            locked(false)
+    {
+
+    }
+
+    void SpinLock::lock()
+    {
+        while(locked.exchange(true, std::memory_order_acquire))
+        {
+            unsigned int spins = 0;
+            while(locked.load(std::memory_order_relaxed))
+            { //wait on a read to not invalidate the cache line of the lock owner
+                if(++spins < MAX_SPINS_BEFORE_YIELD)
+                {
+                    #if defined(__SSE2__)
+                        _mm_pause();
+                    #endif
+                }else
+                {
+                    std::this_thread::yield();
+                }
+            }
+        }
+    }
+
+    bool SpinLock::try_lock()
+    {
+        return !locked.load(std::memory_order_relaxed) && !locked.exchange(true, std::memory_order_acquire);
+    }
+
+    void SpinLock::unlock()
+    {
+        locked.store(false, std::memory_order_release);
+    }
+
+}
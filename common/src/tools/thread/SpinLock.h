@@ -0,0 +1,31 @@
+#ifndef URCHINENGINE_SPINLOCK_H
+#define URCHINENGINE_SPINLOCK_H
+
+#include <atomic>
+
+namespace urchin
+{
+
+    /**
+    * Lightweight lock for short critical sections. The lock is stored inline in the protected object and doesn't require
+    * any system call when it is not contended. A waiting thread spins for a while and then yields its time slice.
+    * Lock can be used with std::lock_guard.
+    */
+    class SpinLock
+    {
+        public:
+            SpinLock();
+            SpinLock(const SpinLock &) = delete;
+            SpinLock &operator=(const SpinLock &) = delete;
+
+            void lock();
+            bool try_lock();
+            void unlock();
+
+        private:
+            std::atomic_bool locked;
+    };
+
+}
+
+#endif
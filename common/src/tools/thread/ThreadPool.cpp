@@ -0,0 +1,144 @@
+#include <algorithm>
+
+#include "ThreadPool.h"
+
+namespace urchin
+{
+
+    /**
+     * @param numThreads Number of threads processing a job, including the calling thread
+     */
+    ThreadPool::ThreadPool(unsigned int numThreads) :
+            numThreads(std::max(1u, numThreads)),
+            job(nullptr),
+            jobSize(0),
+            jobNumThreads(0),
+            jobGeneration(0),
+            remainingWorkers(0),
+            stopWorkers(false)
+    {
+        for(unsigned int threadIndex = 1; threadIndex < this->numThreads; ++threadIndex)
+        {
+            workerThreads.emplace_back(&ThreadPool::startWorker, this, threadIndex);
+        }
+    }
+
+    ThreadPool::~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopWorkers = true;
+        }
+        jobAvailableCondition.notify_all();
+
+        for(auto &workerThread : workerThreads)
+        {
+            workerThread.join();
+        }
+    }
+
+    unsigned int ThreadPool::getNumThreads() const
+    {
+        return numThreads;
+    }
+
+    /**
+     * Split the range [0, size) in contiguous sub-ranges (one by thread) and execute the job on each sub-range.
+     * Method returns once all sub-ranges have been processed. An exception thrown by the job is re-thrown in the calling thread.
+     * @param job Job to execute with parameters: thread index, begin index (inclusive) and end index (exclusive)
+     * @param maxThreads Maximum number of threads used for the job. A value of 0 uses all the threads of the pool.
+     */
+    void ThreadPool::parallelFor(std::size_t size, const std::function<void(unsigned int, std::size_t, std::size_t)> &job, unsigned int maxThreads)
+    {
+        unsigned int numThreadsForJob = (maxThreads == 0) ? numThreads : std::min(maxThreads, numThreads);
+        if(numThreadsForJob <= 1 || size <= 1)
+        {
+            job(0, 0, size);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            this->job = &job;
+            this->jobSize = size;
+            this->jobNumThreads = numThreadsForJob;
+            this->jobException = nullptr;
+            this->remainingWorkers = numThreads - 1;
+            this->jobGeneration++;
+        }
+        jobAvailableCondition.notify_all();
+
+        std::exception_ptr callerException = nullptr;
+        try
+        {
+            executeRange(0);
+        }catch(...)
+        {
+            callerException = std::current_exception();
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        jobDoneCondition.wait(lock, [&]{return remainingWorkers == 0;});
+        this->job = nullptr;
+
+        if(callerException)
+        {
+            std::rethrow_exception(callerException);
+        }else if(jobException)
+        {
+            std::rethrow_exception(jobException);
+        }
+    }
+
+    void ThreadPool::startWorker(unsigned int threadIndex)
+    {
+        unsigned int lastJobGeneration = 0;
+        while(true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                jobAvailableCondition.wait(lock, [&]{return stopWorkers || jobGeneration != lastJobGeneration;});
+                if(stopWorkers)
+                {
+                    return;
+                }
+                lastJobGeneration = jobGeneration;
+            }
+
+            std::exception_ptr workerException = nullptr;
+            try
+            {
+                executeRange(threadIndex);
+            }catch(...)
+            {
+                workerException = std::current_exception();
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if(workerException && !jobException)
+                {
+                    jobException = workerException;
+                }
+                remainingWorkers--;
+            }
+            jobDoneCondition.notify_one();
+        }
+    }
+
+    void ThreadPool::executeRange(unsigned int threadIndex)
+    {
+        if(threadIndex >= jobNumThreads)
+        {
+            return;
+        }
+
+        std::size_t beginIndex = (jobSize * threadIndex) / jobNumThreads;
+        std::size_t endIndex = (jobSize * (threadIndex + 1)) / jobNumThreads;
+        if(beginIndex < endIndex)
+        {
+            (*job)(threadIndex, beginIndex, endIndex);
+        }
+    }
+
+}
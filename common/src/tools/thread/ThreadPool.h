@@ -0,0 +1,50 @@
+#ifndef URCHINENGINE_THREADPOOL_H
+#define URCHINENGINE_THREADPOOL_H
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+
+namespace urchin
+{
+
+    /**
+    * Pool of persistent threads allowing to split a job in several ranges processed in parallel.
+    * The thread calling the pool takes part in the job: a pool of N threads creates N-1 worker threads.
+    */
+    class ThreadPool
+    {
+        public:
+            explicit ThreadPool(unsigned int);
+            ~ThreadPool();
+
+            unsigned int getNumThreads() const;
+
+            void parallelFor(std::size_t, const std::function<void(unsigned int, std::size_t, std::size_t)> &, unsigned int maxThreads = 0);
+
+        private:
+            void startWorker(unsigned int);
+            void executeRange(unsigned int);
+
+            const unsigned int numThreads;
+            std::vector<std::thread> workerThreads;
+
+            std::mutex mutex;
+            std::condition_variable jobAvailableCondition;
+            std::condition_variable jobDoneCondition;
+
+            const std::function<void(unsigned int, std::size_t, std::size_t)> *job;
+            std::size_t jobSize;
+            unsigned int jobNumThreads;
+            unsigned int jobGeneration;
+            unsigned int remainingWorkers;
+            std::exception_ptr jobException;
+            bool stopWorkers;
+    };
+
+}
+
+#endif
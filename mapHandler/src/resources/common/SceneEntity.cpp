@@ -2,14 +2,17 @@
 
 namespace urchin
 {
-    void SceneEntity::refresh()
+    /**
+     * @param interpolationFactor Interpolation factor between the two last transforms computed by the physics
+     */
+    void SceneEntity::refresh(float interpolationFactor)
     {
         RigidBody *rigidBody = getRigidBody();
         if(rigidBody)
         {
             if(rigidBody->isActive() || rigidBody->isManuallyMovedAndResetFlag())
             {
-                moveTo(rigidBody->getTransform());
+                moveTo(rigidBody->getInterpolatedTransform(interpolationFactor));
             }
         }
     }
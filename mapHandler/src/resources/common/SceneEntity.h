@@ -12,7 +12,7 @@ namespace urchin
         public:
             virtual ~SceneEntity() = default;
 
-            void refresh();
+            void refresh(float);
 
         protected:
             virtual RigidBody *getRigidBody() const = 0;
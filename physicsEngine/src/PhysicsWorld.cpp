@@ -1,8 +1,11 @@
 #include <chrono>
 #include <algorithm>
+#include <cmath>
 
 #include "PhysicsWorld.h"
 #include "processable/raytest/RayTester.h"
+#include "processable/raytest/RayBatchTester.h"
+#include "object/pool/CollisionConvexObjectPool.h"
 
 #define DEFAULT_GRAVITY Vector3<float>(0.0f, -9.81f, 0.0f)
 
@@ -17,7 +20,9 @@ namespace urchin
 			physicsSimulationStopper(false),
 			gravity(DEFAULT_GRAVITY),
 			timeStep(0.0f),
+			maxSubsteps(ConfigService::instance()->getUnsignedIntValue("physicsWorld.maxSubsteps")),
 			paused(true),
+			lastStepTime(std::chrono::steady_clock::now().time_since_epoch().count()),
 			bodyManager(new BodyManager()),
 			collisionWorld(new CollisionWorld(bodyManager)),
             collisionVisualizer(nullptr)
@@ -44,6 +49,7 @@ namespace urchin
 		delete collisionWorld;
 		delete bodyManager;
 
+		CollisionConvexObjectPool::instance()->getObjectsPool()->updateProfilerCounters("physics");
 		Profiler::getInstance("physics")->log();
 	}
 
@@ -105,6 +111,22 @@ namespace urchin
 		return rayTester->getRayTestResult();
 	}
 
+	/**
+	 * Test a batch of rays on next physics step. All the rays are processed together: prefer this method to several calls of
+	 * "rayTest" when many rays must be tested.
+	 */
+	std::shared_ptr<const RayBatchTestResult> PhysicsWorld::rayBatchTest(const std::vector<Ray<float>> &rays)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		std::shared_ptr<RayBatchTester> rayBatchTester = std::make_shared<RayBatchTester>(rays);
+		rayBatchTester->initialize(this);
+
+		oneShotProcessables.push_back(rayBatchTester);
+
+		return rayBatchTester->getRayBatchTestResult();
+	}
+
 	/**
 	 * @param gravity Gravity expressed in units/s^2
 	 */
@@ -182,39 +204,88 @@ namespace urchin
 		}
 	}
 
+	/**
+	 * Process the physics steps in the calling thread without real time synchronization (e.g. benchmarks). This method
+	 * cannot be used when the physics thread is started. A paused physics world is not processed.
+	 * @param timeStep Time of one step expressed in second
+	 * @param numSteps Number of steps to process
+	 */
+	void PhysicsWorld::processSteps(float timeStep, unsigned int numSteps)
+	{
+		if(physicsSimulationThread)
+		{
+			throw std::runtime_error("Physics steps cannot be processed manually because physics thread is started");
+		}
+
+		this->timeStep = timeStep;
+		for(unsigned int i=0; i<numSteps; ++i)
+		{
+			processPhysicsUpdate(timeStep);
+		}
+		lastStepTime.store(std::chrono::steady_clock::now().time_since_epoch().count(), std::memory_order_release);
+	}
+
+	/**
+	 * Return the interpolation factor between the two last transforms of the bodies to render them at the current time.
+	 * The rendered transforms are one time step late on the simulation but move smoothly even if the render frequency
+	 * is different from the physics frequency.
+	 * @return Interpolation factor between 0.0 (previous transform) and 1.0 (last transform)
+	 */
+	float PhysicsWorld::getInterpolationFactor() const
+	{
+		if(timeStep <= 0.0f)
+		{
+			return 1.0f;
+		}
+
+		auto lastStepTimePoint = std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(lastStepTime.load(std::memory_order_acquire)));
+		float timeSinceLastStep = std::chrono::duration<float>(std::chrono::steady_clock::now() - lastStepTimePoint).count();
+
+		return MathAlgorithm::clamp(timeSinceLastStep / timeStep, 0.0f, 1.0f);
+	}
+
+	/**
+	 * Process the physics with a fixed time step. The elapsed time is accumulated and consumed by steps of 'timeStep': several
+	 * steps are processed when the physics is late, within the limit of 'maxSubsteps'.
+	 */
 	void PhysicsWorld::startPhysicsUpdate()
 	{
 		try
 		{
-			float remainingTime = 0.0f;
-            float maxAdditionalTimeStep = timeStep * 0.5f;
-			auto frameStartTime = std::chrono::high_resolution_clock::now();
+			float accumulatedTime = 0.0f;
+			auto previousTime = std::chrono::steady_clock::now();
 
 			while (continueExecution())
 			{
-                float additionalTimeStep = std::abs(remainingTime);
-                if(additionalTimeStep > maxAdditionalTimeStep)
-                {
-					//Cannot process physics update with 'additionalTimeStep'. Value is too big and can lead to physics errors.
-					//Use 'maxAdditionalTimeStep' which lead to slow-down of the physics.
-                    additionalTimeStep = maxAdditionalTimeStep;
-                }
+				auto currentTime = std::chrono::steady_clock::now();
+				accumulatedTime += std::chrono::duration<float>(currentTime - previousTime).count();
+				previousTime = currentTime;
 
-                processPhysicsUpdate(timeStep + additionalTimeStep);
+				unsigned int numSubsteps = 0;
+				while(accumulatedTime >= timeStep && numSubsteps < maxSubsteps)
+				{
+					processPhysicsUpdate(timeStep);
 
-				auto frameEndTime = std::chrono::high_resolution_clock::now();
-				auto diffTimeMicroSeconds = std::chrono::duration_cast<std::chrono::microseconds>(frameEndTime - frameStartTime).count();
-				remainingTime = (timeStep + additionalTimeStep) - static_cast<float>(diffTimeMicroSeconds / 1000000.0);
+					accumulatedTime -= timeStep;
+					numSubsteps++;
+				}
 
-				if (remainingTime >= 0.0f)
+				if(accumulatedTime >= timeStep)
 				{
-					std::this_thread::sleep_for(std::chrono::milliseconds(static_cast<int>(remainingTime * 1000.0f)));
+					//Cannot catch up the real time with 'maxSubsteps' steps: drop the remaining time which lead to slow-down of the physics.
+					accumulatedTime = std::fmod(accumulatedTime, timeStep);
+				}
+
+				if(numSubsteps > 0)
+				{ //bodies transforms correspond to the current time minus the accumulated time not simulated yet
+					auto stepTime = currentTime - std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float>(accumulatedTime));
+					lastStepTime.store(stepTime.time_since_epoch().count(), std::memory_order_release);
+				}
 
-					remainingTime = 0.0f;
-					frameStartTime = std::chrono::high_resolution_clock::now();
-				} else
+				auto sleepTime = std::chrono::duration<float>(timeStep - accumulatedTime) - (std::chrono::steady_clock::now() - currentTime);
+				if(sleepTime.count() > 0.0f)
 				{
-					frameStartTime = frameEndTime;
+					std::this_thread::sleep_for(sleepTime);
 				}
 			}
 		}catch(std::exception &e)
@@ -260,6 +331,8 @@ namespace urchin
 			collisionWorld->process(frameTimeStep, gravity);
 
 			executeProcessables(copiedProcessables, frameTimeStep, gravity);
+
+			CollisionConvexObjectPool::instance()->getObjectsPool()->updateProfilerCounters("physics");
 		}
 	}
 
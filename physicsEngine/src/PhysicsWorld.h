@@ -6,6 +6,7 @@
 #include <memory>
 #include <thread>
 #include <mutex>
+#include <chrono>
 #include "UrchinCommon.h"
 
 #include "body/model/AbstractBody.h"
@@ -13,6 +14,7 @@
 #include "collision/CollisionWorld.h"
 #include "processable/Processable.h"
 #include "processable/raytest/RayTestResult.h"
+#include "processable/raytest/RayBatchTestResult.h"
 #include "visualizer/CollisionVisualizer.h"
 
 namespace urchin
@@ -34,6 +36,7 @@ namespace urchin
 			void removeProcessable(const std::shared_ptr<Processable> &);
 
 			std::shared_ptr<const RayTestResult> rayTest(const Ray<float> &);
+			std::shared_ptr<const RayBatchTestResult> rayBatchTest(const std::vector<Ray<float>> &);
 
 			void setGravity(const Vector3<float> &);
 			Vector3<float> getGravity() const;
@@ -44,6 +47,9 @@ namespace urchin
 			bool isPaused() const;
 			void interrupt();
 			void controlExecution();
+			void processSteps(float, unsigned int);
+
+			float getInterpolationFactor() const;
 
 			void createCollisionVisualizer();
 			const CollisionVisualizer *getCollisionVisualizer() const;
@@ -63,7 +69,9 @@ namespace urchin
 			mutable std::mutex mutex;
 			Vector3<float> gravity;
 			float timeStep;
+			const unsigned int maxSubsteps;
 			bool paused;
+			std::atomic<std::chrono::steady_clock::rep> lastStepTime;
 
 			BodyManager *bodyManager;
 			CollisionWorld *collisionWorld;
@@ -6,6 +6,7 @@
 #include "body/model/RigidBody.h"
 #include "body/work/WorkRigidBody.h"
 #include "body/work/WorkGhostBody.h"
+#include "body/work/BodyStateStore.h"
 #include "body/InertiaCalculation.h"
 
 #include "shape/CollisionShape3D.h"
@@ -16,6 +17,7 @@
 #include "shape/CollisionConeShape.h"
 #include "shape/CollisionConvexHullShape.h"
 #include "shape/CollisionCompoundShape.h"
+#include "shape/CompoundChildrenBVH.h"
 #include "shape/CollisionHeightfieldShape.h"
 
 #include "object/CollisionConvexObject3D.h"
@@ -38,9 +40,11 @@
 #include "collision/narrowphase/algorithm/continuous/result/ContinuousCollisionResult.h"
 #include "collision/island/IslandContainer.h"
 #include "collision/island/IslandElement.h"
+#include "collision/constraintsolver/WarmStartCache.h"
 
 #include "processable/Processable.h"
 #include "processable/raytest/RayTestResult.h"
+#include "processable/raytest/RayBatchTestResult.h"
 
 #include "character/PhysicsCharacterController.h"
 #include "character/PhysicsCharacter.h"
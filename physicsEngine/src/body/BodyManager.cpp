@@ -6,6 +6,7 @@ namespace urchin
 {
 
 	BodyManager::BodyManager() :
+		bodyStateStore(new BodyStateStore()),
 		lastUpdatedWorkBody(nullptr)
 	{
 
@@ -22,6 +23,8 @@ namespace urchin
 		{
 			delete workBody;
 		}
+
+		delete bodyStateStore;
 	}
 
 	void BodyManager::addBody(AbstractBody *body)
@@ -47,6 +50,14 @@ namespace urchin
 		return workBodies;
 	}
 
+	/**
+	 * @return State of the work rigid bodies stored as structure of arrays
+	 */
+	BodyStateStore *BodyManager::getBodyStateStore() const
+	{
+		return bodyStateStore;
+	}
+
 	/**
 	 * Setup work bodies with new data on bodies
 	 */
@@ -83,7 +94,7 @@ namespace urchin
 	void BodyManager::createNewWorkBody(AbstractBody *body)
 	{
 		//create new work body
-		AbstractWorkBody *workBody = body->createWorkBody();
+		AbstractWorkBody *workBody = body->createWorkBody(*bodyStateStore);
 		body->setWorkBody(workBody);
 		body->setIsNew(false);
 		body->setNeedFullRefresh(false);
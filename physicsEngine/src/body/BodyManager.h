@@ -5,6 +5,7 @@
 
 #include "body/model/AbstractBody.h"
 #include "body/work/AbstractWorkBody.h"
+#include "body/work/BodyStateStore.h"
 
 namespace urchin
 {
@@ -33,6 +34,7 @@ namespace urchin
 			void applyWorkBodies();
 
 			const std::vector<AbstractWorkBody *> &getWorkBodies() const;
+			BodyStateStore *getBodyStateStore() const;
 
 		private:
 			void createNewWorkBody(AbstractBody *);
@@ -41,6 +43,7 @@ namespace urchin
 
 			std::vector<AbstractBody *> bodies;
 			std::vector<AbstractWorkBody *> workBodies;
+			BodyStateStore *bodyStateStore;
 
 			mutable std::mutex bodiesMutex;
 
@@ -14,6 +14,7 @@ namespace urchin
             bNeedFullRefresh(false),
 			workBody(nullptr),
 			transform(std::move(transform)),
+			transformDoubleBuffer(this->transform),
 			isManuallyMoved(false),
 			id(std::move(id)),
             originalShape(std::move(shape)),
@@ -21,6 +22,7 @@ namespace urchin
             friction(0.0f),
             rollingFriction(0.0f),
             ccdMotionThreshold(0.0f),
+            ccdMode(AbstractWorkBody::SWEPT_CCD),
             bIsStatic(true),
             bIsActive(false)
 	{
@@ -34,6 +36,7 @@ namespace urchin
             bNeedFullRefresh(false),
 			workBody(nullptr),
 			transform(abstractBody.getTransform()),
+			transformDoubleBuffer(this->transform),
 			isManuallyMoved(false),
 			id(abstractBody.getId()),
 			originalShape(std::shared_ptr<const CollisionShape3D>(abstractBody.getOriginalShape()->clone())),
@@ -41,11 +44,13 @@ namespace urchin
             friction(0.0f),
             rollingFriction(0.0f),
             ccdMotionThreshold(0.0f),
+            ccdMode(AbstractWorkBody::SWEPT_CCD),
             bIsStatic(true),
             bIsActive(false)
 	{
 		initialize(abstractBody.getRestitution(), abstractBody.getFriction(), abstractBody.getRollingFriction());
 		setCcdMotionThreshold(abstractBody.getCcdMotionThreshold());
+		setCcdMode(abstractBody.getCcdMode());
 	}
 
 	void AbstractBody::initialize(float restitution, float friction, float rollingFriction)
@@ -122,6 +127,7 @@ namespace urchin
 		workBody->setFriction(friction);
 		workBody->setRollingFriction(rollingFriction);
 		workBody->setCcdMotionThreshold(ccdMotionThreshold);
+		workBody->setCcdMode(ccdMode);
 	}
 
 	bool AbstractBody::applyFrom(const AbstractWorkBody *workBody)
@@ -137,6 +143,7 @@ namespace urchin
 
 			transform.setPosition(workBody->getPosition());
 			transform.setOrientation(workBody->getOrientation());
+			transformDoubleBuffer.publish(transform, false);
 		}
 
 		return fullRefreshRequested;
@@ -155,6 +162,8 @@ namespace urchin
 			this->transform = transform;
 		}
 
+		transformDoubleBuffer.publish(this->transform, true);
+
 		this->setNeedFullRefresh(true);
 		this->isManuallyMoved = true;
 	}
@@ -166,6 +175,16 @@ namespace urchin
 		return transform;
 	}
 
+	/**
+	 * Return the transform interpolated between the two last transforms computed by the physics thread. This method doesn't
+	 * lock the body: it can be called at render frequency to render smoothly bodies simulated at a lower frequency.
+	 * @param interpolationFactor Interpolation factor between the two last transforms (see PhysicsWorld::getInterpolationFactor)
+	 */
+	Transform<float> AbstractBody::getInterpolatedTransform(float interpolationFactor) const
+	{
+		return transformDoubleBuffer.interpolate(interpolationFactor);
+	}
+
 	bool AbstractBody::isManuallyMovedAndResetFlag()
 	{
 		if(isManuallyMoved)
@@ -304,6 +323,25 @@ namespace urchin
 		this->ccdMotionThreshold = ccdMotionThreshold;
 	}
 
+	AbstractWorkBody::CcdMode AbstractBody::getCcdMode() const
+	{
+		std::lock_guard<std::mutex> lock(bodyMutex);
+
+		return ccdMode;
+	}
+
+	/**
+	 * Define how the continuous collision detection is processed when the motion in one step is more than the threshold.
+	 * Speculative mode is cheaper for projectiles: contacts are added in narrow phase only and the body is not swept a
+	 * second time in integration. However, restitution is applied only once the body really touches another body.
+	 */
+	void AbstractBody::setCcdMode(AbstractWorkBody::CcdMode ccdMode)
+	{
+		std::lock_guard<std::mutex> lock(bodyMutex);
+
+		this->ccdMode = ccdMode;
+	}
+
 	/**
 	 * @return True when body is static (cannot be affected by physics world)
 	 */
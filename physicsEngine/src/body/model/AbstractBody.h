@@ -8,6 +8,8 @@
 #include "UrchinCommon.h"
 
 #include "body/work/AbstractWorkBody.h"
+#include "body/work/BodyStateStore.h"
+#include "body/model/TransformDoubleBuffer.h"
 #include "shape/CollisionShape3D.h"
 
 namespace urchin
@@ -29,7 +31,7 @@ namespace urchin
 			void setNeedFullRefresh(bool);
 			bool needFullRefresh() const;
 
-			virtual AbstractWorkBody *createWorkBody() const = 0;
+			virtual AbstractWorkBody *createWorkBody(BodyStateStore &) const = 0;
 			void setWorkBody(AbstractWorkBody *);
 			AbstractWorkBody *getWorkBody() const;
 
@@ -38,6 +40,7 @@ namespace urchin
 
 			void setTransform(const Transform<float> &);
 			Transform<float> getTransform() const;
+			Transform<float> getInterpolatedTransform(float) const;
 			bool isManuallyMovedAndResetFlag();
 
 			void setShape(const std::shared_ptr<const CollisionShape3D> &);
@@ -56,6 +59,8 @@ namespace urchin
 
 			float getCcdMotionThreshold() const;
 			void setCcdMotionThreshold(float);
+			AbstractWorkBody::CcdMode getCcdMode() const;
+			void setCcdMode(AbstractWorkBody::CcdMode);
 
 			bool isStatic() const;
 			bool isActive() const;
@@ -80,6 +85,7 @@ namespace urchin
 
 			//body representation data
 			Transform<float> transform;
+			TransformDoubleBuffer transformDoubleBuffer;
 			bool isManuallyMoved;
 
 			//body description data
@@ -90,6 +96,7 @@ namespace urchin
 			float friction;
 			float rollingFriction;
 			float ccdMotionThreshold;
+			AbstractWorkBody::CcdMode ccdMode;
 
 			//state flags
 			std::atomic_bool bIsStatic;
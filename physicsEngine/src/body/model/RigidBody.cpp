@@ -58,12 +58,12 @@ namespace urchin
 		this->localInertia = computeScaledShapeLocalInertia(mass);
 	}
 
-	AbstractWorkBody *RigidBody::createWorkBody() const
+	AbstractWorkBody *RigidBody::createWorkBody(BodyStateStore &bodyStateStore) const
 	{
 		const Transform<float> &transform = getTransform();
 		PhysicsTransform physicsTransform(transform.getPosition(), transform.getOrientation());
 
-        auto *workRigidBody = new WorkRigidBody(getId(), physicsTransform, getScaledShape());
+        auto *workRigidBody = new WorkRigidBody(getId(), physicsTransform, getScaledShape(), bodyStateStore);
         workRigidBody->setMassProperties(getMass(), getLocalInertia());
         workRigidBody->setLinearVelocity(getLinearVelocity());
         workRigidBody->setAngularVelocity(getAngularVelocity());
@@ -18,7 +18,7 @@ namespace urchin
 			RigidBody(const RigidBody &);
 			~RigidBody() override = default;
 
-			AbstractWorkBody *createWorkBody() const override;
+			AbstractWorkBody *createWorkBody(BodyStateStore &) const override;
 
 			void updateTo(AbstractWorkBody *) override;
 			bool applyFrom(const AbstractWorkBody *) override;
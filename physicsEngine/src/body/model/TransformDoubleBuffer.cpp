@@ -0,0 +1,75 @@
+#include "body/model/TransformDoubleBuffer.h"
+
+namespace urchin
+{
+
+	TransformDoubleBuffer::TransformDoubleBuffer(const Transform<float> &transform) :
+			lastBufferIndex(0)
+	{
+		for(auto &buffer : buffers)
+		{
+			buffer.sequence.store(0, std::memory_order_relaxed);
+			buffer.previousPosition = transform.getPosition();
+			buffer.previousOrientation = transform.getOrientation();
+			buffer.position = transform.getPosition();
+			buffer.orientation = transform.getOrientation();
+			buffer.scale = transform.getScale();
+		}
+	}
+
+	/**
+	 * Publish a new transform. The previously published transform becomes the previous transform of the interpolation.
+	 * @param resetPrevious Use the new transform as previous transform (no interpolation). Useful when body is teleported.
+	 */
+	void TransformDoubleBuffer::publish(const Transform<float> &transform, bool resetPrevious)
+	{
+		unsigned int bufferIndex = lastBufferIndex.load(std::memory_order_relaxed);
+		const PublishedTransforms &lastBuffer = buffers[bufferIndex];
+		PublishedTransforms &nextBuffer = buffers[1 - bufferIndex];
+
+		unsigned int sequence = nextBuffer.sequence.load(std::memory_order_relaxed);
+		nextBuffer.sequence.store(sequence + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		nextBuffer.previousPosition = resetPrevious ? transform.getPosition() : lastBuffer.position;
+		nextBuffer.previousOrientation = resetPrevious ? transform.getOrientation() : lastBuffer.orientation;
+		nextBuffer.position = transform.getPosition();
+		nextBuffer.orientation = transform.getOrientation();
+		nextBuffer.scale = transform.getScale();
+
+		nextBuffer.sequence.store(sequence + 2, std::memory_order_release);
+		lastBufferIndex.store(1 - bufferIndex, std::memory_order_release);
+	}
+
+	/**
+	 * @param interpolationFactor Interpolation factor between previous transform (0.0) and last transform (1.0)
+	 * @return Interpolated transform
+	 */
+	Transform<float> TransformDoubleBuffer::interpolate(float interpolationFactor) const
+	{
+		Point3<float> previousPosition, position;
+		Quaternion<float> previousOrientation, orientation;
+		float scale;
+
+		unsigned int sequenceStart, sequenceEnd;
+		do
+		{
+			const PublishedTransforms &buffer = buffers[lastBufferIndex.load(std::memory_order_acquire)];
+
+			sequenceStart = buffer.sequence.load(std::memory_order_acquire);
+			previousPosition = buffer.previousPosition;
+			previousOrientation = buffer.previousOrientation;
+			position = buffer.position;
+			orientation = buffer.orientation;
+			scale = buffer.scale;
+			std::atomic_thread_fence(std::memory_order_acquire);
+			sequenceEnd = buffer.sequence.load(std::memory_order_relaxed);
+		} while(sequenceStart != sequenceEnd || (sequenceStart % 2) != 0);
+
+		Point3<float> interpolatedPosition = previousPosition.translate(previousPosition.vector(position) * interpolationFactor);
+		Quaternion<float> interpolatedOrientation = previousOrientation.slerp(orientation, interpolationFactor);
+
+		return Transform<float>(interpolatedPosition, interpolatedOrientation, scale);
+	}
+
+}
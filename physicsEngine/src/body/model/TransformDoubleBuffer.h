@@ -0,0 +1,41 @@
+#ifndef URCHINENGINE_TRANSFORMDOUBLEBUFFER_H
+#define URCHINENGINE_TRANSFORMDOUBLEBUFFER_H
+
+#include <atomic>
+#include "UrchinCommon.h"
+
+namespace urchin
+{
+
+	/**
+	* Double buffer of the two last transforms of a body published by the physics thread. The writers must be serialized
+	* (body mutex) while the readers (e.g. render thread) interpolate the transforms without lock: a reader retries only
+	* when two transforms have been published during its read.
+	*/
+	class TransformDoubleBuffer
+	{
+		public:
+			explicit TransformDoubleBuffer(const Transform<float> &);
+
+			void publish(const Transform<float> &, bool);
+
+			Transform<float> interpolate(float) const;
+
+		private:
+			struct PublishedTransforms
+			{
+				std::atomic_uint sequence; //odd while transforms are written
+				Point3<float> previousPosition;
+				Quaternion<float> previousOrientation;
+				Point3<float> position;
+				Quaternion<float> orientation;
+				float scale;
+			};
+
+			PublishedTransforms buffers[2];
+			std::atomic_uint lastBufferIndex;
+	};
+
+}
+
+#endif
@@ -10,14 +10,15 @@ namespace urchin
 	uint_fast32_t AbstractWorkBody::nextObjectId = 0;
 	bool AbstractWorkBody::bDisableAllBodies = false;
 
-	AbstractWorkBody::AbstractWorkBody(std::string id, const PhysicsTransform &physicsTransform, std::shared_ptr<const CollisionShape3D> shape) :
-			physicsTransform(physicsTransform),
+	AbstractWorkBody::AbstractWorkBody(std::string id, std::shared_ptr<const CollisionShape3D> shape) :
 			shape(std::move(shape)),
 			id(std::move(id)),
 			restitution(0.0f),
 			friction(0.0f),
 			rollingFriction(0.0f),
 			ccdMotionThreshold(0.0f),
+			ccdMode(SWEPT_CCD),
+			isAABBoxCached(false),
 			bIsStatic(true),
 			bIsActive(false),
 			islandElementId(0),
@@ -26,34 +27,50 @@ namespace urchin
 
 	}
 
-	const PhysicsTransform &AbstractWorkBody::getPhysicsTransform() const
-	{
-		return physicsTransform;
-	}
-
-	void AbstractWorkBody::setPosition(const Point3<float> &position)
-	{
-		physicsTransform.setPosition(position);
-	}
-
-	const Point3<float> &AbstractWorkBody::getPosition() const
+	const CollisionShape3D *AbstractWorkBody::getShape() const
 	{
-		return physicsTransform.getPosition();
+		return shape.get();
 	}
 
-	void AbstractWorkBody::setOrientation(const Quaternion<float> &orientation)
+	/**
+	 * @return Box of the shape in world space. The box is computed again only when the transform of the body changed.
+	 * This method must be called by the physics thread.
+	 */
+	const AABBox<float> &AbstractWorkBody::getAABBox() const
 	{
-		physicsTransform.setOrientation(orientation);
+		if(!isAABBoxCached || !aabboxTransform.equals(getPhysicsTransform()))
+		{
+			cachedAABBox = shape->toAABBox(getPhysicsTransform());
+			aabboxTransform = getPhysicsTransform();
+			isAABBoxCached = true;
+		}
+		return cachedAABBox;
 	}
 
-	const Quaternion<float> &AbstractWorkBody::getOrientation() const
+	/**
+	 * Compute the convex object of the shape in world space when the transform of the body changed. Only worth for bodies
+	 * having a constant transform across the steps (static or sleeping bodies): the convex object is then reused by all
+	 * the collision tests of the body. This method must be called by the physics thread with the lock of the body.
+	 */
+	void AbstractWorkBody::refreshCachedConvexObject()
 	{
-		return physicsTransform.getOrientation();
+		if(shape->isConvex() && (!cachedConvexObject || !convexObjectTransform.equals(getPhysicsTransform())))
+		{
+			cachedConvexObject = shape->toConvexObject(getPhysicsTransform());
+			convexObjectTransform = getPhysicsTransform();
+		}
 	}
 
-	const CollisionShape3D *AbstractWorkBody::getShape() const
+	/**
+	 * @return Convex object of the shape in world space or null when the cached convex object is not up-to-date
+	 */
+	const CollisionConvexObject3D *AbstractWorkBody::getCachedConvexObject() const
 	{
-		return shape.get();
+		if(cachedConvexObject && convexObjectTransform.equals(getPhysicsTransform()))
+		{
+			return cachedConvexObject.get();
+		}
+		return nullptr;
 	}
 
 	const std::string &AbstractWorkBody::getId() const
@@ -126,6 +143,16 @@ namespace urchin
 		this->ccdMotionThreshold = ccdMotionThreshold;
 	}
 
+	AbstractWorkBody::CcdMode AbstractWorkBody::getCcdMode() const
+	{
+		return ccdMode;
+	}
+
+	void AbstractWorkBody::setCcdMode(CcdMode ccdMode)
+	{
+		this->ccdMode = ccdMode;
+	}
+
 	PairContainer *AbstractWorkBody::getPairContainer() const
 	{
 		return nullptr;
@@ -136,6 +163,11 @@ namespace urchin
         bDisableAllBodies = value;
 	}
 
+	bool AbstractWorkBody::areAllBodiesDisabled()
+	{
+		return bDisableAllBodies;
+	}
+
 	/**
 	 * @return True when body is static (cannot be affected by physics world)
 	 */
@@ -185,4 +217,12 @@ namespace urchin
 		return objectId;
 	}
 
+	/**
+	 * @return Lock of the body. When two bodies must be locked, they must be locked in the order of their object id to avoid dead lock.
+	 */
+	SpinLock &AbstractWorkBody::getLock() const
+	{
+		return bodyLock;
+	}
+
 }
@@ -22,18 +22,27 @@ namespace urchin
 	class AbstractWorkBody : public IslandElement
 	{
 		public:
-			AbstractWorkBody(std::string , const PhysicsTransform &, std::shared_ptr<const CollisionShape3D> );
+			enum CcdMode
+			{
+				SWEPT_CCD, //body is moved back to its first time of impact: one sweep in narrow phase and one in integration
+				SPECULATIVE_CCD //speculative contacts are added in narrow phase: solver prevents the body to close the gap in one step
+			};
+
+			AbstractWorkBody(std::string , std::shared_ptr<const CollisionShape3D> );
 			~AbstractWorkBody() override = default;
 
-			const PhysicsTransform &getPhysicsTransform() const;
+			virtual const PhysicsTransform &getPhysicsTransform() const = 0;
 
-			void setPosition(const Point3<float> &);
-			const Point3<float> &getPosition() const;
+			virtual void setPosition(const Point3<float> &) = 0;
+			virtual const Point3<float> &getPosition() const = 0;
 
-			void setOrientation(const Quaternion<float> &);
-			const Quaternion<float> &getOrientation() const;
+			virtual void setOrientation(const Quaternion<float> &) = 0;
+			virtual const Quaternion<float> &getOrientation() const = 0;
 
 			const CollisionShape3D *getShape() const;
+			const AABBox<float> &getAABBox() const;
+			void refreshCachedConvexObject();
+			const CollisionConvexObject3D *getCachedConvexObject() const;
 			const std::string &getId() const;
 			void setRestitution(float);
 			float getRestitution() const;
@@ -44,30 +53,41 @@ namespace urchin
 
 			float getCcdMotionThreshold() const;
 			void setCcdMotionThreshold(float);
+			CcdMode getCcdMode() const;
+			void setCcdMode(CcdMode);
 
             virtual PairContainer *getPairContainer() const;
 
 			static void disableAllBodies(bool);
+			static bool areAllBodiesDisabled();
 			bool isStatic() const;
             virtual void setIsStatic(bool);
 			bool isActive() const override;
-			void setIsActive(bool);
+			virtual void setIsActive(bool);
 			virtual bool isGhostBody() const = 0;
 
 			void setIslandElementId(unsigned int) override;
 			unsigned int getIslandElementId() const override;
 
 			uint_fast32_t getObjectId() const;
+			SpinLock &getLock() const;
 
 		private:
 			//work body representation data
-			PhysicsTransform physicsTransform;
 			std::shared_ptr<const CollisionShape3D> shape;
 			std::string id;
 			float restitution;
 			float friction;
 			float rollingFriction;
 			float ccdMotionThreshold;
+			CcdMode ccdMode;
+
+			//shape in world space: cache invalidated when the transform changes (a new work body is created when the shape changes)
+			mutable bool isAABBoxCached;
+			mutable PhysicsTransform aabboxTransform;
+			mutable AABBox<float> cachedAABBox;
+			PhysicsTransform convexObjectTransform;
+			std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> cachedConvexObject;
 
 			//state flags
 			static bool bDisableAllBodies;
@@ -80,6 +100,9 @@ namespace urchin
 			//technical object id
 			static uint_fast32_t nextObjectId;
 			uint_fast32_t objectId;
+
+			//lock for concurrent processing of the body (physics thread and ghost bodies processing threads)
+			mutable SpinLock bodyLock;
 	};
 
 }
@@ -0,0 +1,211 @@
+#include <mutex>
+
+#include "body/work/BodyStateStore.h"
+#include "body/work/WorkRigidBody.h"
+
+#define DEFAULT_BODIES_CAPACITY 64
+
+namespace urchin
+{
+
+	BodyStateStore::BodyStateStore()
+	{
+		reserve(DEFAULT_BODIES_CAPACITY);
+	}
+
+	/**
+	 * @return Dense index of the body state in the arrays
+	 */
+	unsigned int BodyStateStore::addBody(WorkRigidBody *body, const PhysicsTransform &physicsTransform)
+	{
+		if(bodies.size() == bodies.capacity())
+		{ //bodies read by other threads (ghost bodies processing) are locked while their state is moved in new arrays
+			for(auto existingBody : bodies)
+			{
+				existingBody->getLock().lock();
+			}
+
+			reserve(bodies.capacity() * 2);
+
+			for(auto existingBody : bodies)
+			{
+				existingBody->getLock().unlock();
+			}
+		}
+
+		bodies.push_back(body);
+		activeFlags.push_back(0);
+		transforms.push_back(physicsTransform);
+		linearVelocities.emplace_back(Vector3<float>(0.0f, 0.0f, 0.0f));
+		angularVelocities.emplace_back(Vector3<float>(0.0f, 0.0f, 0.0f));
+		totalMomentums.emplace_back(Vector3<float>(0.0f, 0.0f, 0.0f));
+		totalTorqueMomentums.emplace_back(Vector3<float>(0.0f, 0.0f, 0.0f));
+		masses.push_back(0.0f);
+		invMasses.push_back(0.0f);
+		invLocalInertias.emplace_back(Vector3<float>(0.0f, 0.0f, 0.0f));
+		invWorldInertias.emplace_back(Matrix3<float>(0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0));
+		linearDampings.push_back(0.0f);
+		angularDampings.push_back(0.0f);
+		linearFactors.emplace_back(Vector3<float>(0.0f, 0.0f, 0.0f));
+		angularFactors.emplace_back(Vector3<float>(0.0f, 0.0f, 0.0f));
+
+		return static_cast<unsigned int>(bodies.size() - 1);
+	}
+
+	/**
+	 * Remove the body state. The state of the last body is moved in the freed index to keep the arrays dense.
+	 */
+	void BodyStateStore::removeBody(unsigned int bodyIndex)
+	{
+		auto lastIndex = static_cast<unsigned int>(bodies.size() - 1);
+		if(bodyIndex != lastIndex)
+		{
+			WorkRigidBody *movedBody = bodies[lastIndex];
+			std::lock_guard<SpinLock> lock(movedBody->getLock());
+
+			moveBodyState(lastIndex, bodyIndex);
+			movedBody->stateIndex = bodyIndex;
+		}
+
+		bodies.pop_back();
+		activeFlags.pop_back();
+		transforms.pop_back();
+		linearVelocities.pop_back();
+		angularVelocities.pop_back();
+		totalMomentums.pop_back();
+		totalTorqueMomentums.pop_back();
+		masses.pop_back();
+		invMasses.pop_back();
+		invLocalInertias.pop_back();
+		invWorldInertias.pop_back();
+		linearDampings.pop_back();
+		angularDampings.pop_back();
+		linearFactors.pop_back();
+		angularFactors.pop_back();
+	}
+
+	unsigned int BodyStateStore::getNumberBodies() const
+	{
+		return static_cast<unsigned int>(bodies.size());
+	}
+
+	WorkRigidBody *BodyStateStore::getBody(unsigned int bodyIndex) const
+	{
+		return bodies[bodyIndex];
+	}
+
+	/**
+	 * @return Active flag of the bodies (see AbstractWorkBody::isActive). Flag is not impacted by AbstractWorkBody::disableAllBodies.
+	 */
+	std::vector<uint8_t> &BodyStateStore::getActiveFlags()
+	{
+		return activeFlags;
+	}
+
+	std::vector<PhysicsTransform> &BodyStateStore::getTransforms()
+	{
+		return transforms;
+	}
+
+	std::vector<Vector3<float>> &BodyStateStore::getLinearVelocities()
+	{
+		return linearVelocities;
+	}
+
+	std::vector<Vector3<float>> &BodyStateStore::getAngularVelocities()
+	{
+		return angularVelocities;
+	}
+
+	std::vector<Vector3<float>> &BodyStateStore::getTotalMomentums()
+	{
+		return totalMomentums;
+	}
+
+	std::vector<Vector3<float>> &BodyStateStore::getTotalTorqueMomentums()
+	{
+		return totalTorqueMomentums;
+	}
+
+	std::vector<float> &BodyStateStore::getMasses()
+	{
+		return masses;
+	}
+
+	std::vector<float> &BodyStateStore::getInvMasses()
+	{
+		return invMasses;
+	}
+
+	std::vector<Vector3<float>> &BodyStateStore::getInvLocalInertias()
+	{
+		return invLocalInertias;
+	}
+
+	std::vector<Matrix3<float>> &BodyStateStore::getInvWorldInertias()
+	{
+		return invWorldInertias;
+	}
+
+	std::vector<float> &BodyStateStore::getLinearDampings()
+	{
+		return linearDampings;
+	}
+
+	std::vector<float> &BodyStateStore::getAngularDampings()
+	{
+		return angularDampings;
+	}
+
+	std::vector<Vector3<float>> &BodyStateStore::getLinearFactors()
+	{
+		return linearFactors;
+	}
+
+	std::vector<Vector3<float>> &BodyStateStore::getAngularFactors()
+	{
+		return angularFactors;
+	}
+
+	/**
+	 * Reserve all the arrays with the same capacity: arrays are never reallocated outside this method.
+	 */
+	void BodyStateStore::reserve(std::size_t capacity)
+	{
+		bodies.reserve(capacity);
+		activeFlags.reserve(capacity);
+		transforms.reserve(capacity);
+		linearVelocities.reserve(capacity);
+		angularVelocities.reserve(capacity);
+		totalMomentums.reserve(capacity);
+		totalTorqueMomentums.reserve(capacity);
+		masses.reserve(capacity);
+		invMasses.reserve(capacity);
+		invLocalInertias.reserve(capacity);
+		invWorldInertias.reserve(capacity);
+		linearDampings.reserve(capacity);
+		angularDampings.reserve(capacity);
+		linearFactors.reserve(capacity);
+		angularFactors.reserve(capacity);
+	}
+
+	void BodyStateStore::moveBodyState(unsigned int fromIndex, unsigned int toIndex)
+	{
+		bodies[toIndex] = bodies[fromIndex];
+		activeFlags[toIndex] = activeFlags[fromIndex];
+		transforms[toIndex] = transforms[fromIndex];
+		linearVelocities[toIndex] = linearVelocities[fromIndex];
+		angularVelocities[toIndex] = angularVelocities[fromIndex];
+		totalMomentums[toIndex] = totalMomentums[fromIndex];
+		totalTorqueMomentums[toIndex] = totalTorqueMomentums[fromIndex];
+		masses[toIndex] = masses[fromIndex];
+		invMasses[toIndex] = invMasses[fromIndex];
+		invLocalInertias[toIndex] = invLocalInertias[fromIndex];
+		invWorldInertias[toIndex] = invWorldInertias[fromIndex];
+		linearDampings[toIndex] = linearDampings[fromIndex];
+		angularDampings[toIndex] = angularDampings[fromIndex];
+		linearFactors[toIndex] = linearFactors[fromIndex];
+		angularFactors[toIndex] = angularFactors[fromIndex];
+	}
+
+}
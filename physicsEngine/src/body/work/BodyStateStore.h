@@ -0,0 +1,70 @@
+#ifndef URCHINENGINE_BODYSTATESTORE_H
+#define URCHINENGINE_BODYSTATESTORE_H
+
+#include <vector>
+#include <cstdint>
+#include "UrchinCommon.h"
+
+#include "utils/math/PhysicsTransform.h"
+
+namespace urchin
+{
+
+	class WorkRigidBody;
+
+	/**
+	* Store of the work rigid bodies state organized as structure of arrays. Each work rigid body owns a dense index in
+	* the arrays and acts as a view on them: the integration steps iterate over contiguous arrays instead of browsing the
+	* scattered work bodies.
+	*/
+	class BodyStateStore
+	{
+		public:
+			BodyStateStore();
+
+			unsigned int addBody(WorkRigidBody *, const PhysicsTransform &);
+			void removeBody(unsigned int);
+
+			unsigned int getNumberBodies() const;
+			WorkRigidBody *getBody(unsigned int) const;
+
+			std::vector<uint8_t> &getActiveFlags();
+			std::vector<PhysicsTransform> &getTransforms();
+			std::vector<Vector3<float>> &getLinearVelocities();
+			std::vector<Vector3<float>> &getAngularVelocities();
+			std::vector<Vector3<float>> &getTotalMomentums();
+			std::vector<Vector3<float>> &getTotalTorqueMomentums();
+			std::vector<float> &getMasses();
+			std::vector<float> &getInvMasses();
+			std::vector<Vector3<float>> &getInvLocalInertias();
+			std::vector<Matrix3<float>> &getInvWorldInertias();
+			std::vector<float> &getLinearDampings();
+			std::vector<float> &getAngularDampings();
+			std::vector<Vector3<float>> &getLinearFactors();
+			std::vector<Vector3<float>> &getAngularFactors();
+
+		private:
+			void reserve(std::size_t);
+			void moveBodyState(unsigned int, unsigned int);
+
+			std::vector<WorkRigidBody *> bodies;
+
+			std::vector<uint8_t> activeFlags;
+			std::vector<PhysicsTransform> transforms;
+			std::vector<Vector3<float>> linearVelocities;
+			std::vector<Vector3<float>> angularVelocities;
+			std::vector<Vector3<float>> totalMomentums;
+			std::vector<Vector3<float>> totalTorqueMomentums;
+			std::vector<float> masses;
+			std::vector<float> invMasses;
+			std::vector<Vector3<float>> invLocalInertias;
+			std::vector<Matrix3<float>> invWorldInertias;
+			std::vector<float> linearDampings;
+			std::vector<float> angularDampings;
+			std::vector<Vector3<float>> linearFactors;
+			std::vector<Vector3<float>> angularFactors;
+	};
+
+}
+
+#endif
@@ -1,12 +1,13 @@
 #include "body/work/WorkGhostBody.h"
-#include "collision/broadphase/SyncVectorPairContainer.h"
+#include "collision/broadphase/SyncHashPairContainer.h"
 
 namespace urchin
 {
 
 	WorkGhostBody::WorkGhostBody(const std::string &id, const PhysicsTransform &physicsTransform, const std::shared_ptr<const CollisionShape3D> &shape) :
-			AbstractWorkBody(id, physicsTransform, shape),
-			pairContainer(new SyncVectorPairContainer())
+			AbstractWorkBody(id, shape),
+			physicsTransform(physicsTransform),
+			pairContainer(new SyncHashPairContainer(ConfigService::instance()->getUnsignedIntValue("broadPhase.ghostBodyPairPoolSize")))
 	{
 		setIsStatic(false); //can move and be affected by the physics world: not a static body
 		setIsActive(false); //default value: body is not active
@@ -27,6 +28,31 @@ namespace urchin
 		return dynamic_cast<const WorkGhostBody*>(workBody);
 	}
 
+	const PhysicsTransform &WorkGhostBody::getPhysicsTransform() const
+	{
+		return physicsTransform;
+	}
+
+	void WorkGhostBody::setPosition(const Point3<float> &position)
+	{
+		physicsTransform.setPosition(position);
+	}
+
+	const Point3<float> &WorkGhostBody::getPosition() const
+	{
+		return physicsTransform.getPosition();
+	}
+
+	void WorkGhostBody::setOrientation(const Quaternion<float> &orientation)
+	{
+		physicsTransform.setOrientation(orientation);
+	}
+
+	const Quaternion<float> &WorkGhostBody::getOrientation() const
+	{
+		return physicsTransform.getOrientation();
+	}
+
 	/**
 	 * @return Pair container used to collect colliding pairs on ghost body
 	 */
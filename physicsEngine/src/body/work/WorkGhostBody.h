@@ -20,11 +20,20 @@ namespace urchin
 			static WorkGhostBody *upCast(AbstractWorkBody *);
 			static const WorkGhostBody *upCast(const AbstractWorkBody *);
 
+			const PhysicsTransform &getPhysicsTransform() const override;
+
+			void setPosition(const Point3<float> &) override;
+			const Point3<float> &getPosition() const override;
+
+			void setOrientation(const Quaternion<float> &) override;
+			const Quaternion<float> &getOrientation() const override;
+
 			PairContainer *getPairContainer() const override;
 
 			bool isGhostBody() const override;
 
 		private:
+			PhysicsTransform physicsTransform;
 			PairContainer *pairContainer;
 
 	};
@@ -6,18 +6,20 @@
 namespace urchin
 {
 
-	WorkRigidBody::WorkRigidBody(const std::string &id, const PhysicsTransform &physicsTransform, const std::shared_ptr<const CollisionShape3D> &shape) :
-			AbstractWorkBody(id, physicsTransform, shape),
-			mass(0.0f),
-			invMass(0.0f),
-			invLocalInertia(Vector3<float>(0.0, 0.0, 0.0)),
-			invWorldInertia(Matrix3<float>(0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0)),
-			linearDamping(0.0),
-			angularDamping(0.0)
+	WorkRigidBody::WorkRigidBody(const std::string &id, const PhysicsTransform &physicsTransform, const std::shared_ptr<const CollisionShape3D> &shape,
+			BodyStateStore &bodyStateStore) :
+			AbstractWorkBody(id, shape),
+			bodyStateStore(bodyStateStore),
+			stateIndex(bodyStateStore.addBody(this, physicsTransform))
 	{
 
 	}
 
+	WorkRigidBody::~WorkRigidBody()
+	{
+		bodyStateStore.removeBody(stateIndex);
+	}
+
 	WorkRigidBody *WorkRigidBody::upCast(AbstractWorkBody *workBody)
 	{
 		return dynamic_cast<WorkRigidBody*>(workBody);
@@ -28,6 +30,39 @@ namespace urchin
 		return dynamic_cast<const WorkRigidBody*>(workBody);
 	}
 
+	/**
+	 * @return Index of the body state in the body state store. Index can change when another body is removed from the store.
+	 */
+	unsigned int WorkRigidBody::getStateIndex() const
+	{
+		return stateIndex;
+	}
+
+	const PhysicsTransform &WorkRigidBody::getPhysicsTransform() const
+	{
+		return bodyStateStore.getTransforms()[stateIndex];
+	}
+
+	void WorkRigidBody::setPosition(const Point3<float> &position)
+	{
+		bodyStateStore.getTransforms()[stateIndex].setPosition(position);
+	}
+
+	const Point3<float> &WorkRigidBody::getPosition() const
+	{
+		return bodyStateStore.getTransforms()[stateIndex].getPosition();
+	}
+
+	void WorkRigidBody::setOrientation(const Quaternion<float> &orientation)
+	{
+		bodyStateStore.getTransforms()[stateIndex].setOrientation(orientation);
+	}
+
+	const Quaternion<float> &WorkRigidBody::getOrientation() const
+	{
+		return bodyStateStore.getTransforms()[stateIndex].getOrientation();
+	}
+
 	/**
 	 * Refresh body active state. If forces are apply on body: active body
 	 */
@@ -35,8 +70,8 @@ namespace urchin
 	{
 		if(!isStatic() && !isActive())
 		{
-			if(totalMomentum.squareLength() > std::numeric_limits<float>::epsilon()
-					|| totalMomentum.squareLength() > std::numeric_limits<float>::epsilon())
+			if(getTotalMomentum().squareLength() > std::numeric_limits<float>::epsilon()
+					|| getTotalMomentum().squareLength() > std::numeric_limits<float>::epsilon())
 			{
 				setIsActive(true);
 			}
@@ -45,75 +80,75 @@ namespace urchin
 
 	void WorkRigidBody::setLinearVelocity(const Vector3<float> &linearVelocity)
 	{
-		this->linearVelocity = linearVelocity;
+		bodyStateStore.getLinearVelocities()[stateIndex] = linearVelocity;
 	}
 
 	const Vector3<float> &WorkRigidBody::getLinearVelocity() const
 	{
-		return linearVelocity;
+		return bodyStateStore.getLinearVelocities()[stateIndex];
 	}
 
 	void WorkRigidBody::setAngularVelocity(const Vector3<float> &angularVelocity)
 	{
-		this->angularVelocity = angularVelocity;
+		bodyStateStore.getAngularVelocities()[stateIndex] = angularVelocity;
 	}
 
 	const Vector3<float> &WorkRigidBody::getAngularVelocity() const
 	{
-		return angularVelocity;
+		return bodyStateStore.getAngularVelocities()[stateIndex];
 	}
 
 	const Vector3<float> &WorkRigidBody::getTotalMomentum() const
 	{
-		return totalMomentum;
+		return bodyStateStore.getTotalMomentums()[stateIndex];
 	}
 
 	void WorkRigidBody::setTotalMomentum(const Vector3<float> &totalMomentum)
 	{
-		this->totalMomentum = totalMomentum;
+		bodyStateStore.getTotalMomentums()[stateIndex] = totalMomentum;
 
 		refreshBodyActiveState();
 	}
 
 	void WorkRigidBody::applyCentralMomentum(const Vector3<float> &momentum)
 	{
-		totalMomentum += momentum * linearFactor;
+		bodyStateStore.getTotalMomentums()[stateIndex] += momentum * getLinearFactor();
 	}
 
 	void WorkRigidBody::applyMomentum(const Vector3<float> &momentum, const Point3<float> &momentumPoint)
 	{
 		//apply central force
-		totalMomentum += momentum * linearFactor;
+		bodyStateStore.getTotalMomentums()[stateIndex] += momentum * getLinearFactor();
 
 		//apply torque
-		totalTorqueMomentum += momentumPoint.toVector().crossProduct(momentum * linearFactor);
+		bodyStateStore.getTotalTorqueMomentums()[stateIndex] += momentumPoint.toVector().crossProduct(momentum * getLinearFactor());
 	}
 
 	void WorkRigidBody::resetMomentum()
 	{
-		totalMomentum.setValues(0.0, 0.0, 0.0);
+		bodyStateStore.getTotalMomentums()[stateIndex].setValues(0.0, 0.0, 0.0);
 	}
 
 	const Vector3<float> &WorkRigidBody::getTotalTorqueMomentum() const
 	{
-		return totalTorqueMomentum;
+		return bodyStateStore.getTotalTorqueMomentums()[stateIndex];
 	}
 
 	void WorkRigidBody::setTotalTorqueMomentum(const Vector3<float> &totalTorqueMomentum)
 	{
-		this->totalTorqueMomentum = totalTorqueMomentum;
+		bodyStateStore.getTotalTorqueMomentums()[stateIndex] = totalTorqueMomentum;
 
 		refreshBodyActiveState();
 	}
 
 	void WorkRigidBody::applyTorqueMomentum(const Vector3<float> &torqueMomentum)
 	{
-		totalTorqueMomentum += torqueMomentum * angularFactor;
+		bodyStateStore.getTotalTorqueMomentums()[stateIndex] += torqueMomentum * getAngularFactor();
 	}
 
 	void WorkRigidBody::resetTorqueMomentum()
 	{
-		totalTorqueMomentum.setValues(0.0, 0.0, 0.0);
+		bodyStateStore.getTotalTorqueMomentums()[stateIndex].setValues(0.0, 0.0, 0.0);
 	}
 
 	void WorkRigidBody::setMassProperties(float mass, const Vector3<float> &localInertia)
@@ -122,7 +157,7 @@ namespace urchin
 		{
             setIsStatic(true);
 			setIsActive(false);
-			this->invMass = 0.0f;
+			bodyStateStore.getInvMasses()[stateIndex] = 0.0f;
 		}else
 		{
 			if(isStatic()) //avoid wake up of body (isActive flag) when static flag is already correct
@@ -130,23 +165,24 @@ namespace urchin
 				setIsStatic(false);
 				setIsActive(true);
 			}
-			this->invMass = 1.0f / mass;
+			bodyStateStore.getInvMasses()[stateIndex] = 1.0f / mass;
 		}
-        this->mass = mass;
+        bodyStateStore.getMasses()[stateIndex] = mass;
 
-		this->invLocalInertia.X = MathAlgorithm::isZero(localInertia.X) ? 0.0 : 1.0/localInertia.X;
-		this->invLocalInertia.Y = MathAlgorithm::isZero(localInertia.Y) ? 0.0 : 1.0/localInertia.Y;
-		this->invLocalInertia.Z = MathAlgorithm::isZero(localInertia.Z) ? 0.0 : 1.0/localInertia.Z;
+		Vector3<float> &invLocalInertia = bodyStateStore.getInvLocalInertias()[stateIndex];
+		invLocalInertia.X = MathAlgorithm::isZero(localInertia.X) ? 0.0 : 1.0/localInertia.X;
+		invLocalInertia.Y = MathAlgorithm::isZero(localInertia.Y) ? 0.0 : 1.0/localInertia.Y;
+		invLocalInertia.Z = MathAlgorithm::isZero(localInertia.Z) ? 0.0 : 1.0/localInertia.Z;
 	}
 
 	float WorkRigidBody::getMass() const
 	{
-		return mass;
+		return bodyStateStore.getMasses()[stateIndex];
 	}
 
 	float WorkRigidBody::getInvMass() const
 	{
-		return invMass;
+		return bodyStateStore.getInvMasses()[stateIndex];
 	}
 
 	/**
@@ -156,21 +192,21 @@ namespace urchin
 	{
 		if(!isStatic())
 		{
-			invWorldInertia = InertiaCalculation::computeInverseWorldInertia(invLocalInertia, getPhysicsTransform());
+			bodyStateStore.getInvWorldInertias()[stateIndex] = InertiaCalculation::computeInverseWorldInertia(getInvLocalInertia(), getPhysicsTransform());
 		}else
 		{
-			invWorldInertia = Matrix3<float>(0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0);
+			bodyStateStore.getInvWorldInertias()[stateIndex] = Matrix3<float>(0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0);
 		}
 	}
 
 	const Vector3<float> &WorkRigidBody::getInvLocalInertia() const
 	{
-		return invLocalInertia;
+		return bodyStateStore.getInvLocalInertias()[stateIndex];
 	}
 
 	const Matrix3<float> &WorkRigidBody::getInvWorldInertia() const
 	{
-		return invWorldInertia;
+		return bodyStateStore.getInvWorldInertias()[stateIndex];
 	}
 
 	/**
@@ -179,18 +215,18 @@ namespace urchin
 	 */
 	void WorkRigidBody::setDamping(float linearDamping, float angularDamping)
 	{
-		this->linearDamping = linearDamping;
-		this->angularDamping = angularDamping;
+		bodyStateStore.getLinearDampings()[stateIndex] = linearDamping;
+		bodyStateStore.getAngularDampings()[stateIndex] = angularDamping;
 	}
 
 	float WorkRigidBody::getLinearDamping() const
 	{
-		return linearDamping;
+		return bodyStateStore.getLinearDampings()[stateIndex];
 	}
 
 	float WorkRigidBody::getAngularDamping() const
 	{
-		return angularDamping;
+		return bodyStateStore.getAngularDampings()[stateIndex];
 	}
 
 	/**
@@ -198,7 +234,7 @@ namespace urchin
 	 */
 	void WorkRigidBody::setLinearFactor(const Vector3<float> &linearFactor)
 	{
-		this->linearFactor = linearFactor;
+		bodyStateStore.getLinearFactors()[stateIndex] = linearFactor;
 	}
 
 	/**
@@ -206,7 +242,7 @@ namespace urchin
 	 */
 	const Vector3<float> &WorkRigidBody::getLinearFactor() const
 	{
-		return linearFactor;
+		return bodyStateStore.getLinearFactors()[stateIndex];
 	}
 
 	/**
@@ -214,7 +250,7 @@ namespace urchin
 	 */
 	void WorkRigidBody::setAngularFactor(const Vector3<float> &angularFactor)
 	{
-		this->angularFactor = angularFactor;
+		bodyStateStore.getAngularFactors()[stateIndex] = angularFactor;
 	}
 
 	/**
@@ -222,7 +258,7 @@ namespace urchin
 	 */
 	const Vector3<float> &WorkRigidBody::getAngularFactor() const
 	{
-		return angularFactor;
+		return bodyStateStore.getAngularFactors()[stateIndex];
 	}
 
     void WorkRigidBody::setIsStatic(bool bIsStatic)
@@ -235,6 +271,16 @@ namespace urchin
 	    }
     }
 
+	/**
+	 * @param bIsActive Indicate whether body is active. Flag is copied in the body state store for the integration steps.
+	 */
+	void WorkRigidBody::setIsActive(bool bIsActive)
+	{
+		AbstractWorkBody::setIsActive(bIsActive);
+
+		bodyStateStore.getActiveFlags()[stateIndex] = bIsActive ? 1 : 0;
+	}
+
 	bool WorkRigidBody::isGhostBody() const
 	{
 		return false;
@@ -243,7 +289,7 @@ namespace urchin
     void WorkRigidBody::makeBodyStatic()
     {
         AbstractWorkBody::setIsStatic(true);
-        AbstractWorkBody::setIsActive(false);
+        setIsActive(false);
         setLinearVelocity(Vector3<float>(0.0f, 0.0f, 0.0f));
         setAngularVelocity(Vector3<float>(0.0f, 0.0f, 0.0f));
     }
@@ -5,18 +5,35 @@
 #include "UrchinCommon.h"
 
 #include "body/work/AbstractWorkBody.h"
+#include "body/work/BodyStateStore.h"
 
 namespace urchin
 {
 
+	/**
+	* A work rigid body is a view on its state stored in the body state store.
+	*/
 	class WorkRigidBody : public AbstractWorkBody
 	{
 		public:
-			WorkRigidBody(const std::string &, const PhysicsTransform &, const std::shared_ptr<const CollisionShape3D> &);
+			friend class BodyStateStore;
+
+			WorkRigidBody(const std::string &, const PhysicsTransform &, const std::shared_ptr<const CollisionShape3D> &, BodyStateStore &);
+			~WorkRigidBody() override;
 
 			static WorkRigidBody *upCast(AbstractWorkBody *);
 			static const WorkRigidBody *upCast(const AbstractWorkBody *);
 
+			unsigned int getStateIndex() const;
+
+			const PhysicsTransform &getPhysicsTransform() const override;
+
+			void setPosition(const Point3<float> &) override;
+			const Point3<float> &getPosition() const override;
+
+			void setOrientation(const Quaternion<float> &) override;
+			const Quaternion<float> &getOrientation() const override;
+
 			void setLinearVelocity(const Vector3<float> &);
 			const Vector3<float> &getLinearVelocity() const;
 
@@ -51,30 +68,16 @@ namespace urchin
 			const Vector3<float> &getAngularFactor() const;
 
             void setIsStatic(bool) override;
+			void setIsActive(bool) override;
 			bool isGhostBody() const override;
 
 		private:
 			void refreshBodyActiveState();
 			void makeBodyStatic();
 
-			//work rigid body representation data
-			Vector3<float> linearVelocity;
-			Vector3<float> angularVelocity;
-
-			Vector3<float> totalMomentum;
-			Vector3<float> totalTorqueMomentum;
-
-			//work rigid body description data
-			float mass;
-			float invMass;
-			Vector3<float> invLocalInertia;
-			Matrix3<float> invWorldInertia;
-
-			float linearDamping;
-			float angularDamping;
-
-			Vector3<float> linearFactor;
-			Vector3<float> angularFactor;
+			//view on the body state
+			BodyStateStore &bodyStateStore;
+			unsigned int stateIndex;
 	};
 
 }
@@ -11,8 +11,8 @@ namespace urchin
 			broadPhaseManager(new BroadPhaseManager(bodyManager)),
 			narrowPhaseManager(new NarrowPhaseManager(bodyManager, broadPhaseManager)),
 			integrateVelocityManager(new IntegrateVelocityManager(bodyManager)),
-			constraintSolverManager(new ConstraintSolverManager()),
 			islandManager(new IslandManager(bodyManager)),
+			constraintSolverManager(new ConstraintSolverManager(islandManager)),
 			integrateTransformManager(new IntegrateTransformManager(bodyManager, broadPhaseManager, narrowPhaseManager))
 	{
 
@@ -61,11 +61,14 @@ namespace urchin
 		narrowPhaseManager->process(dt, overlappingPairs, manifoldResults);
 		notifyObservers(this, COLLISION_RESULT_UPDATED);
 
+		//islands: merge and split islands of bodies in contact
+		islandManager->refreshIslands(manifoldResults);
+
 		//constraints solver: solve collision constraints
 		constraintSolverManager->solveConstraints(dt, manifoldResults);
 
 		//update bodies state and integrate transformations
-		islandManager->refreshBodyActiveState(manifoldResults);
+		islandManager->refreshBodyActiveState();
 		integrateTransformManager->integrateTransform(dt);
 
 		//apply work bodies to bodies
@@ -42,8 +42,8 @@ namespace urchin
 			BroadPhaseManager *broadPhaseManager;
 			NarrowPhaseManager *narrowPhaseManager;
 			IntegrateVelocityManager *integrateVelocityManager;
-			ConstraintSolverManager *constraintSolverManager;
 			IslandManager *islandManager;
+			ConstraintSolverManager *constraintSolverManager;
 			IntegrateTransformManager *integrateTransformManager;
 
 			std::vector<ManifoldResult> manifoldResults;
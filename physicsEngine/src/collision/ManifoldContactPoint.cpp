@@ -10,6 +10,7 @@ namespace urchin
 			localPointOnObject1(Point3<float>()),
 			localPointOnObject2(Point3<float>()),
 			depth(0.0),
+			featureId(NO_FEATURE_ID),
 			bIsPredictive(false)
 	{
 
@@ -18,6 +19,7 @@ namespace urchin
 	/**
 	* @param normalFromObject2 Contact normal from object 2. The normal direction should be toward the object 1.
 	* @param depth Penetration depth (negative when collision exist)
+	* @param featureId Identifier of the shapes features in contact (see ManifoldContactPoint::getFeatureId)
 	*/
 	ManifoldContactPoint::ManifoldContactPoint(const Vector3<float> &normalFromObject2,
 			const Point3<float> &pointOnObject1,
@@ -25,6 +27,7 @@ namespace urchin
 			const Point3<float> &localPointOnObject1,
 			const Point3<float> &localPointOnObject2,
 			float depth,
+			unsigned int featureId,
 			bool bIsPredictive) :
 			normalFromObject2(normalFromObject2),
 			pointOnObject1(pointOnObject1),
@@ -32,6 +35,7 @@ namespace urchin
 			localPointOnObject1(localPointOnObject1),
 			localPointOnObject2(localPointOnObject2),
 			depth(depth),
+			featureId(featureId),
 			bIsPredictive(bIsPredictive)
 	{
 
@@ -85,6 +89,16 @@ namespace urchin
 		return depth;
 	}
 
+	/**
+	 * @return Identifier of the shapes features in contact. Identifier is stable across the frames as long as the same
+	 * features are in contact: it allows to retrieve the accumulated impulses of the previous frames. Value is
+	 * NO_FEATURE_ID when the features are unknown.
+	 */
+	unsigned int ManifoldContactPoint::getFeatureId() const
+	{
+		return featureId;
+	}
+
 	/**
 	 * @return True if contact point is predictive
 	 */
@@ -119,4 +133,9 @@ namespace urchin
 	{
 		return accumulatedSolvingData;
 	}
+
+	const AccumulatedSolvingData &ManifoldContactPoint::getAccumulatedSolvingData() const
+	{
+		return accumulatedSolvingData;
+	}
 }
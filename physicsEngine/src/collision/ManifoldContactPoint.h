@@ -5,6 +5,8 @@
 
 #include "constraintsolver/solvingdata/AccumulatedSolvingData.h"
 
+#define NO_FEATURE_ID 0
+
 namespace urchin
 {
 
@@ -12,7 +14,7 @@ namespace urchin
 	{
 		public:
 			ManifoldContactPoint();
-			ManifoldContactPoint(const Vector3<float> &, const Point3<float> &, const Point3<float> &, const Point3<float> &, const Point3<float> &, float, bool);
+			ManifoldContactPoint(const Vector3<float> &, const Point3<float> &, const Point3<float> &, const Point3<float> &, const Point3<float> &, float, unsigned int, bool);
 
 			const Vector3<float> &getNormalFromObject2() const;
 			const Point3<float> &getPointOnObject1() const;
@@ -20,18 +22,21 @@ namespace urchin
 			const Point3<float> &getLocalPointOnObject1() const;
 			const Point3<float> &getLocalPointOnObject2() const;
 			float getDepth() const;
+			unsigned int getFeatureId() const;
 			bool isPredictive() const;
 
 			void updatePoints(const Point3<float> &, const Point3<float> &);
 			void updateDepth(float);
 
 			AccumulatedSolvingData &getAccumulatedSolvingData();
+			const AccumulatedSolvingData &getAccumulatedSolvingData() const;
 
 		private:
 			Vector3<float> normalFromObject2;
 			Point3<float> pointOnObject1, pointOnObject2;
 			Point3<float> localPointOnObject1, localPointOnObject2;
 			float depth;
+			unsigned int featureId;
 			bool bIsPredictive;
 
 			AccumulatedSolvingData accumulatedSolvingData;
@@ -59,15 +59,16 @@ namespace urchin
 	 * @param normalFromObject2 Contact normal from object 2. The normal direction should be toward the object 1.
 	 * @param pointOnObject2 Contact point on object 2 in world coordinate
 	 * @param depth Penetration depth (negative when collision exist)
+	 * @param featureId Identifier of the shapes features in contact or NO_FEATURE_ID when unknown
 	 * @param isPredictive Is a predictive contact point
 	 */
-	void ManifoldResult::addContactPoint(const Vector3<float> &normalFromObject2, const Point3<float> &pointOnObject2, float depth, bool isPredictive)
+	void ManifoldResult::addContactPoint(const Vector3<float> &normalFromObject2, const Point3<float> &pointOnObject2, float depth, unsigned int featureId, bool isPredictive)
 	{
 		Point3<float> pointOnObject1 = pointOnObject2.translate(normalFromObject2 * depth);
 		Point3<float> localPointOnObject1 = body1->getPhysicsTransform().inverseTransform(pointOnObject1);
 		Point3<float> localPointOnObject2 = body2->getPhysicsTransform().inverseTransform(pointOnObject2);
 
-		addContactPoint(normalFromObject2, pointOnObject1, pointOnObject2, localPointOnObject1, localPointOnObject2, depth, isPredictive);
+		addContactPoint(normalFromObject2, pointOnObject1, pointOnObject2, localPointOnObject1, localPointOnObject2, depth, featureId, isPredictive);
 	}
 
 	/**
@@ -77,19 +78,25 @@ namespace urchin
 	 * @param localPointOnObject1 Contact point on object 1 in local coordinate
 	 * @param localPointOnObject2 Contact point on object 2 in local coordinate
 	 * @param depth Penetration depth (negative when collision exist)
+	 * @param featureId Identifier of the shapes features in contact or NO_FEATURE_ID when unknown
 	 * @param isPredictive Is a predictive contact point
 	 */
 	void ManifoldResult::addContactPoint(const Vector3<float> &normalFromObject2, const Point3<float> &pointOnObject1, const Point3<float> &pointOnObject2,
-			const Point3<float> &localPointOnObject1, const Point3<float> &localPointOnObject2, float depth, bool isPredictive)
+			const Point3<float> &localPointOnObject1, const Point3<float> &localPointOnObject2, float depth, unsigned int featureId, bool isPredictive)
 	{
         assert(isPredictive || depth <= contactBreakingThreshold);
 
-		//1. if similar point exist in manifold result: replace it
-		int nearestPointIndex = getNearestPointIndex(localPointOnObject2);
-		if(nearestPointIndex >= 0)
-		{ //replace existing point
-			contactPoints[nearestPointIndex] = ManifoldContactPoint(normalFromObject2, pointOnObject1, pointOnObject2,
-					localPointOnObject1, localPointOnObject2, depth, isPredictive);
+		//1. if point of same features or similar point exist in manifold result: replace it
+		int replacedPointIndex = getSameFeaturePointIndex(featureId);
+		if(replacedPointIndex < 0)
+		{
+			replacedPointIndex = getNearestPointIndex(localPointOnObject2);
+		}
+		if(replacedPointIndex >= 0)
+		{ //replace existing point: feature ID of existing point is kept to retrieve its accumulated impulses
+			unsigned int replacedFeatureId = contactPoints[replacedPointIndex].getFeatureId();
+			contactPoints[replacedPointIndex] = ManifoldContactPoint(normalFromObject2, pointOnObject1, pointOnObject2,
+					localPointOnObject1, localPointOnObject2, depth, replacedFeatureId == NO_FEATURE_ID ? featureId : replacedFeatureId, isPredictive);
 			return;
 		}
 
@@ -104,7 +111,7 @@ namespace urchin
 			++nbContactPoint;
 		}
 		contactPoints[insertionIndex] = ManifoldContactPoint(normalFromObject2, pointOnObject1, pointOnObject2,
-				localPointOnObject1, localPointOnObject2, depth, isPredictive);
+				localPointOnObject1, localPointOnObject2, depth, featureId, isPredictive);
 	}
 
 	void ManifoldResult::refreshContactPoints()
@@ -138,6 +145,25 @@ namespace urchin
 		}
 	}
 
+	/**
+	 * @return Index of the point having the same features in contact. If no point found: '-1' is returned.
+	 */
+	int ManifoldResult::getSameFeaturePointIndex(unsigned int featureId) const
+	{
+		if(featureId != NO_FEATURE_ID)
+		{
+			for(unsigned int i=0; i<nbContactPoint; ++i)
+			{
+				if(contactPoints[i].getFeatureId() == featureId)
+				{
+					return static_cast<int>(i);
+				}
+			}
+		}
+
+		return -1;
+	}
+
 	/**
 	 * @param localPointOnObject2 Local point of object 2 used for comparison
 	 * @return Nearest point index to point given in parameter. If all points are too far: '-1' is returned.
@@ -30,11 +30,12 @@ namespace urchin
 			ManifoldContactPoint &getManifoldContactPoint(unsigned int);
 			const ManifoldContactPoint &getManifoldContactPoint(unsigned int) const;
 
-			void addContactPoint(const Vector3<float> &, const Point3<float> &, float, bool);
-			void addContactPoint(const Vector3<float> &, const Point3<float> &, const Point3<float> &, const Point3<float> &, const Point3<float> &, float, bool);
+			void addContactPoint(const Vector3<float> &, const Point3<float> &, float, unsigned int, bool);
+			void addContactPoint(const Vector3<float> &, const Point3<float> &, const Point3<float> &, const Point3<float> &, const Point3<float> &, float, unsigned int, bool);
 			void refreshContactPoints();
 
 		private:
+			int getSameFeaturePointIndex(unsigned int) const;
 			int getNearestPointIndex(const Point3<float> &) const;
 			unsigned int computeBestInsertionIndex(const Point3<float> &) const;
 			unsigned int getDeepestPointIndex() const;
@@ -21,8 +21,10 @@ namespace urchin
 			virtual void updateBodies() = 0;
 
 			virtual const std::vector<OverlappingPair *> &getOverlappingPairs() const = 0;
+			virtual void computeActiveOverlappingPairs(std::vector<OverlappingPair *> &) const = 0;
 
 			virtual std::vector<AbstractWorkBody *> rayTest(const Ray<float> &) const = 0;
+			virtual void rayBatchTest(const std::vector<Ray<float>> &, std::vector<std::size_t> &, std::vector<AbstractWorkBody *> &) const = 0;
 			virtual std::vector<AbstractWorkBody *> bodyTest(AbstractWorkBody *, const PhysicsTransform &, const PhysicsTransform &) const = 0;
 	};
 
@@ -80,6 +80,10 @@ namespace urchin
         bodiesToRemove.clear();
 	}
 
+	/**
+	 * @return Overlapping pairs having at least one active body. Pairs of sleeping islands are not returned: their
+	 * contacts don't change until one body of the island wakes up.
+	 */
 	const std::vector<OverlappingPair *> &BroadPhaseManager::computeOverlappingPairs()
 	{
 		ScopeProfiler profiler("physics", "coOverlapPair");
@@ -87,7 +91,10 @@ namespace urchin
 		synchronizeBodies();
 
 		broadPhaseAlgorithm->updateBodies();
-		return broadPhaseAlgorithm->getOverlappingPairs();
+
+		activeOverlappingPairs.clear();
+		broadPhaseAlgorithm->computeActiveOverlappingPairs(activeOverlappingPairs);
+		return activeOverlappingPairs;
 	}
 
 	std::vector<AbstractWorkBody *> BroadPhaseManager::rayTest(const Ray<float> &ray) const
@@ -95,6 +102,15 @@ namespace urchin
 		return broadPhaseAlgorithm->rayTest(ray);
 	}
 
+	/**
+	 * @param bodiesOffsets [out] Bodies of ray 'i' are stored between indices bodiesOffsets[i] (inclusive) and bodiesOffsets[i+1] (exclusive)
+	 * @param bodiesAABBoxHitRays [out] Bodies AABBox hit by the rays, grouped by ray
+	 */
+	void BroadPhaseManager::rayBatchTest(const std::vector<Ray<float>> &rays, std::vector<std::size_t> &bodiesOffsets, std::vector<AbstractWorkBody *> &bodiesAABBoxHitRays) const
+	{
+		broadPhaseAlgorithm->rayBatchTest(rays, bodiesOffsets, bodiesAABBoxHitRays);
+	}
+
 	std::vector<AbstractWorkBody *> BroadPhaseManager::bodyTest(AbstractWorkBody *body, const PhysicsTransform &from, const PhysicsTransform &to) const
 	{
 		return broadPhaseAlgorithm->bodyTest(body, from, to);
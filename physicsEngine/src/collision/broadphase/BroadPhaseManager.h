@@ -30,6 +30,7 @@ namespace urchin
 			const std::vector<OverlappingPair *> &computeOverlappingPairs();
 
 			std::vector<AbstractWorkBody *> rayTest(const Ray<float> &) const;
+			void rayBatchTest(const std::vector<Ray<float>> &, std::vector<std::size_t> &, std::vector<AbstractWorkBody *> &) const;
 			std::vector<AbstractWorkBody *> bodyTest(AbstractWorkBody *, const PhysicsTransform &, const PhysicsTransform &) const;
 
 		private:
@@ -42,6 +43,8 @@ namespace urchin
 			std::mutex mutex;
             std::vector<AbstractWorkBody *> bodiesToAdd;
 			std::vector<AbstractWorkBody *> bodiesToRemove;
+
+			std::vector<OverlappingPair *> activeOverlappingPairs;
 	};
 
 }
@@ -0,0 +1,211 @@
+#include <limits>
+
+#include "HashPairContainer.h"
+
+#define INITIAL_SLOTS_SIZE 64
+#define EMPTY_SLOT std::numeric_limits<uint32_t>::max()
+
+namespace urchin
+{
+
+	/**
+	 * @param pairPoolSize Number of pairs which can be stored in the pool. When more pairs are added, a classical allocation (new/delete) is performed.
+	 */
+	HashPairContainer::HashPairContainer(unsigned int pairPoolSize) :
+			slots(INITIAL_SLOTS_SIZE, PairSlot{0, EMPTY_SLOT}),
+			pairPool(new FixedSizePool<OverlappingPair>("pairPool", sizeof(OverlappingPair), pairPoolSize))
+	{
+
+	}
+
+	HashPairContainer::~HashPairContainer()
+	{
+		for (auto &overlappingPair : overlappingPairs)
+		{
+			pairPool->free(overlappingPair);
+		}
+
+		delete pairPool;
+	}
+
+	void HashPairContainer::addOverlappingPair(AbstractWorkBody *body1, AbstractWorkBody *body2)
+	{
+		uint_fast64_t bodiesId = OverlappingPair::computeBodiesId(body1, body2);
+
+		if(findSlot(bodiesId) == slots.size())
+		{ //pair doesn't exist: we create it
+			if((overlappingPairs.size() + 1) * 2 > slots.size())
+			{ //keep load factor below 0.5
+				growSlots();
+			}
+
+			void *memPtr = pairPool->allocate(sizeof(OverlappingPair));
+			auto *overlappingPair = new(memPtr) OverlappingPair(body1, body2, bodiesId);
+			overlappingPairs.push_back(overlappingPair);
+			insertSlot(bodiesId, (uint32_t)(overlappingPairs.size() - 1));
+			bodiesPairs[body1].push_back(overlappingPair);
+			bodiesPairs[body2].push_back(overlappingPair);
+		}
+	}
+
+	void HashPairContainer::removeOverlappingPair(AbstractWorkBody *body1, AbstractWorkBody *body2)
+	{
+		std::size_t slotIndex = findSlot(OverlappingPair::computeBodiesId(body1, body2));
+		if(slotIndex != slots.size())
+		{
+			removePair(slots[slotIndex].pairIndex);
+		}
+	}
+
+	void HashPairContainer::removeOverlappingPairs(AbstractWorkBody *body)
+	{
+		auto itBodyPairs = bodiesPairs.find(body);
+		if(itBodyPairs != bodiesPairs.end())
+		{
+			std::vector<OverlappingPair *> bodyPairs = std::move(itBodyPairs->second);
+			bodiesPairs.erase(itBodyPairs);
+
+			for(const auto &bodyPair : bodyPairs)
+			{
+				removePair(slots[findSlot(bodyPair->getBodiesId())].pairIndex);
+			}
+		}
+	}
+
+	const std::vector<OverlappingPair *> &HashPairContainer::getOverlappingPairs() const
+	{
+		return overlappingPairs;
+	}
+
+	/**
+	 * @return Overlapping pairs of the body
+	 */
+	const std::vector<OverlappingPair *> &HashPairContainer::getBodyOverlappingPairs(const AbstractWorkBody *body) const
+	{
+		static const std::vector<OverlappingPair *> noOverlappingPairs;
+
+		auto itBodyPairs = bodiesPairs.find(body);
+		if(itBodyPairs != bodiesPairs.end())
+		{
+			return itBodyPairs->second;
+		}
+		return noOverlappingPairs;
+	}
+
+	std::vector<OverlappingPair> HashPairContainer::retrieveCopyOverlappingPairs() const
+	{
+        throw std::runtime_error("Not implemented: use 'getOverlappingPairs' method");
+	}
+
+	std::size_t HashPairContainer::computeHash(uint_fast64_t bodiesId) const
+	{ //Fibonacci hashing: spread the bodies id bits before applying the mask
+		auto hash = (std::size_t)((bodiesId * 11400714819323198485ull) >> 32u);
+		return hash & (slots.size() - 1);
+	}
+
+	/**
+	 * @return Slot index of the bodies id or slots size when not found
+	 */
+	std::size_t HashPairContainer::findSlot(uint_fast64_t bodiesId) const
+	{
+		std::size_t slotIndex = computeHash(bodiesId);
+		while(slots[slotIndex].pairIndex != EMPTY_SLOT)
+		{
+			if(slots[slotIndex].bodiesId == bodiesId)
+			{
+				return slotIndex;
+			}
+			slotIndex = (slotIndex + 1) & (slots.size() - 1);
+		}
+		return slots.size();
+	}
+
+	void HashPairContainer::insertSlot(uint_fast64_t bodiesId, uint32_t pairIndex)
+	{
+		std::size_t slotIndex = computeHash(bodiesId);
+		while(slots[slotIndex].pairIndex != EMPTY_SLOT)
+		{
+			slotIndex = (slotIndex + 1) & (slots.size() - 1);
+		}
+		slots[slotIndex].bodiesId = bodiesId;
+		slots[slotIndex].pairIndex = pairIndex;
+	}
+
+	/**
+	 * Remove the slot and shift back the following slots of the cluster to avoid the usage of tombstones
+	 */
+	void HashPairContainer::removeSlot(std::size_t slotIndex)
+	{
+		std::size_t mask = slots.size() - 1;
+		std::size_t emptySlotIndex = slotIndex;
+		std::size_t nextSlotIndex = slotIndex;
+		while(true)
+		{
+			nextSlotIndex = (nextSlotIndex + 1) & mask;
+			if(slots[nextSlotIndex].pairIndex == EMPTY_SLOT)
+			{
+				break;
+			}
+
+			std::size_t idealSlotIndex = computeHash(slots[nextSlotIndex].bodiesId);
+			if(((nextSlotIndex - idealSlotIndex) & mask) >= ((nextSlotIndex - emptySlotIndex) & mask))
+			{ //slot can be moved to the empty slot without being placed before its ideal slot
+				slots[emptySlotIndex] = slots[nextSlotIndex];
+				emptySlotIndex = nextSlotIndex;
+			}
+		}
+		slots[emptySlotIndex].pairIndex = EMPTY_SLOT;
+	}
+
+	/**
+	 * Remove the pair from the hash table and replace it by the last pair in the vector of pairs
+	 */
+	void HashPairContainer::removePair(std::size_t pairIndex)
+	{
+		OverlappingPair *pair = overlappingPairs[pairIndex];
+		removeSlot(findSlot(pair->getBodiesId()));
+		removeBodyPair(pair->getBody1(), pair);
+		removeBodyPair(pair->getBody2(), pair);
+
+		if(pairIndex != overlappingPairs.size() - 1)
+		{
+			OverlappingPair *lastPair = overlappingPairs.back();
+			overlappingPairs[pairIndex] = lastPair;
+			slots[findSlot(lastPair->getBodiesId())].pairIndex = (uint32_t)pairIndex;
+		}
+		overlappingPairs.pop_back();
+
+		pairPool->free(pair);
+	}
+
+	void HashPairContainer::growSlots()
+	{
+		slots.assign(slots.size() * 2, PairSlot{0, EMPTY_SLOT});
+		for(std::size_t i = 0; i < overlappingPairs.size(); ++i)
+		{
+			insertSlot(overlappingPairs[i]->getBodiesId(), (uint32_t)i);
+		}
+	}
+
+	/**
+	 * Remove the pair from the pairs of the body. Pairs of a body are few: a linear search is performed. Entry of the body
+	 * is kept to reuse its memory for the next pairs of the body.
+	 */
+	void HashPairContainer::removeBodyPair(const AbstractWorkBody *body, const OverlappingPair *pair)
+	{
+		auto itBodyPairs = bodiesPairs.find(body);
+		if(itBodyPairs != bodiesPairs.end())
+		{
+			std::vector<OverlappingPair *> &bodyPairs = itBodyPairs->second;
+			for(std::size_t i = 0; i < bodyPairs.size(); ++i)
+			{
+				if(bodyPairs[i] == pair)
+				{
+					bodyPairs[i] = bodyPairs.back();
+					bodyPairs.pop_back();
+					break;
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,59 @@
+#ifndef URCHINENGINE_HASHPAIRCONTAINER_H
+#define URCHINENGINE_HASHPAIRCONTAINER_H
+
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+#include "collision/OverlappingPair.h"
+#include "utils/pool/FixedSizePool.h"
+#include "PairContainer.h"
+
+namespace urchin
+{
+
+	/**
+	* Overlapping pair manager using an open addressing hash table (linear probing) keyed on bodies id. Pairs are allocated in a pool
+	* and stored contiguously in a vector to keep high performance when looping over them. Pairs of each body are indexed to
+	* remove the pairs of a body without looping over all the pairs.
+	*/
+	class HashPairContainer : public PairContainer
+	{
+		public:
+			explicit HashPairContainer(unsigned int);
+			~HashPairContainer() override;
+
+            void addOverlappingPair(AbstractWorkBody *, AbstractWorkBody *) override;
+            void removeOverlappingPair(AbstractWorkBody *, AbstractWorkBody *) override;
+            void removeOverlappingPairs(AbstractWorkBody *) override;
+
+            const std::vector<OverlappingPair *> &getOverlappingPairs() const override;
+            const std::vector<OverlappingPair *> &getBodyOverlappingPairs(const AbstractWorkBody *) const;
+            std::vector<OverlappingPair> retrieveCopyOverlappingPairs() const override;
+
+		protected:
+			std::vector<OverlappingPair *> overlappingPairs;
+
+		private:
+			struct PairSlot
+			{
+				uint_fast64_t bodiesId;
+				uint32_t pairIndex;
+			};
+
+			std::size_t computeHash(uint_fast64_t) const;
+			std::size_t findSlot(uint_fast64_t) const;
+			void insertSlot(uint_fast64_t, uint32_t);
+			void removeSlot(std::size_t);
+			void removePair(std::size_t);
+			void growSlots();
+			void removeBodyPair(const AbstractWorkBody *, const OverlappingPair *);
+
+			std::vector<PairSlot> slots;
+			std::unordered_map<const AbstractWorkBody *, std::vector<OverlappingPair *>> bodiesPairs;
+			FixedSizePool<OverlappingPair> *pairPool;
+	};
+
+}
+
+#endif
@@ -1,35 +1,41 @@
-#include "SyncVectorPairContainer.h"
+#include "SyncHashPairContainer.h"
 
 namespace urchin
 {
 
-    void SyncVectorPairContainer::addOverlappingPair(AbstractWorkBody *body1, AbstractWorkBody *body2)
+    SyncHashPairContainer::SyncHashPairContainer(unsigned int pairPoolSize) :
+            HashPairContainer(pairPoolSize)
+    {
+
+    }
+
+    void SyncHashPairContainer::addOverlappingPair(AbstractWorkBody *body1, AbstractWorkBody *body2)
     {
         std::lock_guard<std::mutex> lock(pairMutex);
 
-        VectorPairContainer::addOverlappingPair(body1, body2);
+        HashPairContainer::addOverlappingPair(body1, body2);
     }
 
-    void SyncVectorPairContainer::removeOverlappingPair(AbstractWorkBody *body1, AbstractWorkBody *body2)
+    void SyncHashPairContainer::removeOverlappingPair(AbstractWorkBody *body1, AbstractWorkBody *body2)
     {
         std::lock_guard<std::mutex> lock(pairMutex);
 
-        VectorPairContainer::removeOverlappingPair(body1, body2);
+        HashPairContainer::removeOverlappingPair(body1, body2);
     }
 
-    void SyncVectorPairContainer::removeOverlappingPairs(AbstractWorkBody *body)
+    void SyncHashPairContainer::removeOverlappingPairs(AbstractWorkBody *body)
     {
         std::lock_guard<std::mutex> lock(pairMutex);
 
-        VectorPairContainer::removeOverlappingPairs(body);
+        HashPairContainer::removeOverlappingPairs(body);
     }
 
-    const std::vector<OverlappingPair *> &SyncVectorPairContainer::getOverlappingPairs() const
+    const std::vector<OverlappingPair *> &SyncHashPairContainer::getOverlappingPairs() const
     {
         throw std::runtime_error("Cannot retrieve overlapping pairs reference on a thread safe container: use 'retrieveCopyOverlappingPairs' method");
     }
 
-    std::vector<OverlappingPair> SyncVectorPairContainer::retrieveCopyOverlappingPairs() const
+    std::vector<OverlappingPair> SyncHashPairContainer::retrieveCopyOverlappingPairs() const
     {
         //This method can be called by several threads and therefore must return a real copy of overlapping pairs.
         // - Returning a reference to a class attribute will not work as vector methods (e.g.: clear()) could be called by two different threads later
@@ -1,9 +1,9 @@
-#ifndef URCHINENGINE_SYNCVECTORPAIRCONTAINER_H
-#define URCHINENGINE_SYNCVECTORPAIRCONTAINER_H
+#ifndef URCHINENGINE_SYNCHASHPAIRCONTAINER_H
+#define URCHINENGINE_SYNCHASHPAIRCONTAINER_H
 
 #include <mutex>
 
-#include "collision/broadphase/VectorPairContainer.h"
+#include "collision/broadphase/HashPairContainer.h"
 
 namespace urchin
 {
@@ -11,10 +11,11 @@ namespace urchin
     /**
      * Thread safe pair container. Pair can be added/removed by physics thread while pairs are read from another thread.
      */
-    class SyncVectorPairContainer : public VectorPairContainer
+    class SyncHashPairContainer : public HashPairContainer
     {
         public:
-            ~SyncVectorPairContainer() override = default;
+            explicit SyncHashPairContainer(unsigned int);
+            ~SyncHashPairContainer() override = default;
 
             void addOverlappingPair(AbstractWorkBody *, AbstractWorkBody *) override;
             void removeOverlappingPair(AbstractWorkBody *, AbstractWorkBody *) override;
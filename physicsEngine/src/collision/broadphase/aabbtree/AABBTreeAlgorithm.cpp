@@ -35,6 +35,11 @@ namespace urchin
 		return tree->getOverlappingPairs();
 	}
 
+	void AABBTreeAlgorithm::computeActiveOverlappingPairs(std::vector<OverlappingPair *> &activeOverlappingPairs) const
+	{
+		tree->computeActiveOverlappingPairs(activeOverlappingPairs);
+	}
+
 	std::vector<AbstractWorkBody *> AABBTreeAlgorithm::rayTest(const Ray<float> &ray) const
 	{
 		std::vector<AbstractWorkBody *> bodiesAABBoxHitRay;
@@ -45,6 +50,36 @@ namespace urchin
 		return bodiesAABBoxHitRay;
 	}
 
+	/**
+	 * @param bodiesOffsets [out] Bodies of ray 'i' are stored between indices bodiesOffsets[i] (inclusive) and bodiesOffsets[i+1] (exclusive)
+	 * @param bodiesAABBoxHitRays [out] Bodies AABBox hit by the rays, grouped by ray
+	 */
+	void AABBTreeAlgorithm::rayBatchTest(const std::vector<Ray<float>> &rays, std::vector<std::size_t> &bodiesOffsets, std::vector<AbstractWorkBody *> &bodiesAABBoxHitRays) const
+	{
+		std::vector<std::pair<uint32_t, AbstractWorkBody *>> rayIndexBodiesAABBoxHitRays;
+		rayIndexBodiesAABBoxHitRays.reserve(rays.size() * 2);
+
+		tree->rayBatchQuery(rays, rayIndexBodiesAABBoxHitRays);
+
+		//group bodies by ray (counting sort)
+		bodiesOffsets.assign(rays.size() + 1, 0);
+		for(const auto &rayIndexBody : rayIndexBodiesAABBoxHitRays)
+		{
+			bodiesOffsets[rayIndexBody.first + 1]++;
+		}
+		for(std::size_t i = 1; i < bodiesOffsets.size(); ++i)
+		{
+			bodiesOffsets[i] += bodiesOffsets[i - 1];
+		}
+
+		bodiesAABBoxHitRays.resize(rayIndexBodiesAABBoxHitRays.size());
+		std::vector<std::size_t> insertPositions(bodiesOffsets.begin(), bodiesOffsets.end() - 1);
+		for(const auto &rayIndexBody : rayIndexBodiesAABBoxHitRays)
+		{
+			bodiesAABBoxHitRays[insertPositions[rayIndexBody.first]++] = rayIndexBody.second;
+		}
+	}
+
 	std::vector<AbstractWorkBody *> AABBTreeAlgorithm::bodyTest(AbstractWorkBody *body, const PhysicsTransform &from, const PhysicsTransform &to) const
 	{
 		std::vector<AbstractWorkBody *> bodiesAABBoxHitBody;
@@ -22,8 +22,10 @@ namespace urchin
 			void updateBodies() override;
 
 			const std::vector<OverlappingPair *> &getOverlappingPairs() const override;
+			void computeActiveOverlappingPairs(std::vector<OverlappingPair *> &) const override;
 
 			std::vector<AbstractWorkBody *> rayTest(const Ray<float> &) const override;
+			void rayBatchTest(const std::vector<Ray<float>> &, std::vector<std::size_t> &, std::vector<AbstractWorkBody *> &) const override;
 			std::vector<AbstractWorkBody *> bodyTest(AbstractWorkBody *, const PhysicsTransform &, const PhysicsTransform &) const override;
 
 		private:
@@ -22,7 +22,7 @@ namespace urchin
 
 	AABBox<float> BodyAABBNodeData::retrieveObjectAABBox() const
 	{
-		return getNodeObject()->getShape()->toAABBox(getNodeObject()->getPhysicsTransform());
+		return getNodeObject()->getAABBox();
 	}
 
     bool BodyAABBNodeData::isObjectMoving() const
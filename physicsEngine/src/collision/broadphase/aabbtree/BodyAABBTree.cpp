@@ -1,13 +1,15 @@
 #include <limits>
+#include <algorithm>
 
 #include "BodyAABBTree.h"
-#include "collision/broadphase/VectorPairContainer.h"
 
 namespace urchin
 {
     BodyAABBTree::BodyAABBTree() :
-            AABBTree<AbstractWorkBody *>(ConfigService::instance()->getFloatValue("broadPhase.aabbTreeFatMargin")),
-            defaultPairContainer(new VectorPairContainer()),
+            staticTree(new AABBTree<AbstractWorkBody *>(ConfigService::instance()->getFloatValue("broadPhase.aabbTreeFatMargin"))),
+            dynamicTree(new AABBTree<AbstractWorkBody *>(ConfigService::instance()->getFloatValue("broadPhase.aabbTreeFatMargin"))),
+            staticTreeModified(false),
+            defaultPairContainer(new HashPairContainer(ConfigService::instance()->getUnsignedIntValue("broadPhase.pairPoolSize"))),
             inInitializationPhase(true),
             minYBoundary(std::numeric_limits<float>::max())
     {
@@ -16,46 +18,95 @@ namespace urchin
 
     BodyAABBTree::~BodyAABBTree()
     {
+        delete staticTree;
+        delete dynamicTree;
         delete defaultPairContainer;
     }
 
+    /**
+     * Add body in the static or dynamic tree depending on its static state at the time it is added.
+     * A body changing from static to dynamic is re-added by the body manager (full refresh on mass change).
+     */
     void BodyAABBTree::addBody(AbstractWorkBody *body, PairContainer *alternativePairContainer)
     {
         auto *nodeData = new BodyAABBNodeData(body, alternativePairContainer);
-        AABBTree::addObject(nodeData);
-    }
 
-    void BodyAABBTree::postAddObjectCallback(AABBNode<AbstractWorkBody *> *newNode)
-    {
-        computeOverlappingPairsFor(newNode);
+        if(body->isStatic())
+        {
+            staticTree->addObject(nodeData);
+            staticTreeModified = true;
+
+            computeOverlappingPairsFor(staticTree->getNode(body), dynamicTree);
+        }else
+        {
+            dynamicTree->addObject(nodeData);
+            dynamicBodies.push_back(body);
+
+            const AABBNode<AbstractWorkBody *> *leafNode = dynamicTree->getNode(body);
+            computeOverlappingPairsFor(leafNode, dynamicTree);
+            computeOverlappingPairsFor(leafNode, staticTree);
+        }
     }
 
     void BodyAABBTree::removeBody(AbstractWorkBody *body)
     {
-        auto *nodeData = AABBTree::getNodeData(body);
-        AABBTree::removeObject(nodeData);
-    }
+        BodyAABBNodeData *nodeData = getNodeData(body);
+        if(nodeData)
+        {
+            removeOverlappingPairs(nodeData);
 
-    void BodyAABBTree::preRemoveObjectCallback(AABBNode<AbstractWorkBody *> *nodeToDelete)
-    {
-        auto *bodyNodeToDelete = dynamic_cast<BodyAABBNodeData *>(nodeToDelete->getNodeData());
-        removeOverlappingPairs(bodyNodeToDelete);
+            if(dynamicTree->getNode(body))
+            {
+                dynamicTree->removeObject(body);
+                dynamicBodies.erase(std::find(dynamicBodies.begin(), dynamicBodies.end(), body));
+            }else
+            {
+                staticTree->removeObject(body);
+                staticTreeModified = true;
+            }
+        }
     }
 
     void BodyAABBTree::updateBodies()
     {
-        if(inInitializationPhase)
+        if(inInitializationPhase && (staticTree->getRootNode() || dynamicTree->getRootNode()))
         {
             computeWorldBoundary();
             inInitializationPhase = false;
         }
 
-        AABBTree::updateObjects();
+        if(staticTreeModified)
+        {
+            staticTree->rebuild();
+            staticTreeModified = false;
+        }
+
+        for(auto body : dynamicBodies)
+        {
+            if(body->isActive())
+            {
+                controlBoundaries(body);
+
+                if(dynamicTree->updateObject(body))
+                {
+                    removeOverlappingPairs(getNodeData(body));
+
+                    const AABBNode<AbstractWorkBody *> *leafNode = dynamicTree->getNode(body);
+                    computeOverlappingPairsFor(leafNode, dynamicTree);
+                    computeOverlappingPairsFor(leafNode, staticTree);
+                }
+            }
+        }
     }
 
-    void BodyAABBTree::preUpdateObjectCallback(AABBNode<AbstractWorkBody *> *nodeToUpdate)
+    BodyAABBNodeData *BodyAABBTree::getNodeData(AbstractWorkBody *body) const
     {
-        controlBoundaries(nodeToUpdate);
+        AABBNodeData<AbstractWorkBody *> *nodeData = dynamicTree->getNodeData(body);
+        if(!nodeData)
+        {
+            nodeData = staticTree->getNodeData(body);
+        }
+        return dynamic_cast<BodyAABBNodeData *>(nodeData);
     }
 
     const std::vector<OverlappingPair *> &BodyAABBTree::getOverlappingPairs() const
@@ -63,29 +114,71 @@ namespace urchin
         return defaultPairContainer->getOverlappingPairs();
     }
 
-    void BodyAABBTree::computeOverlappingPairsFor(AABBNode<AbstractWorkBody *> *leafNode)
+    /**
+     * Pairs are retrieved from the active bodies: pairs of two sleeping bodies are not browsed.
+     * @param activeOverlappingPairs [out] Overlapping pairs having at least one active body
+     */
+    void BodyAABBTree::computeActiveOverlappingPairs(std::vector<OverlappingPair *> &activeOverlappingPairs) const
     {
-        browseNodes.clear();
-        browseNodes.push_back(AABBTree::getRootNode());
-
-        for(std::size_t i=0; i<browseNodes.size(); ++i)
-        { //tree traversal: pre-order (iterative)
-            const AABBNode<AbstractWorkBody *> *currentNode = browseNodes[i];
-
-            if(leafNode!=currentNode && leafNode->getAABBox().collideWithAABBox(currentNode->getAABBox()))
+        for(auto body : dynamicBodies)
+        {
+            if(body->isActive())
             {
-                if (currentNode->isLeaf())
-                {
-                    createOverlappingPair(dynamic_cast<BodyAABBNodeData *>(leafNode->getNodeData()), dynamic_cast<BodyAABBNodeData *>(currentNode->getNodeData()));
-                }else
+                for(auto overlappingPair : defaultPairContainer->getBodyOverlappingPairs(body))
                 {
-                    browseNodes.push_back(currentNode->getRightChild());
-                    browseNodes.push_back(currentNode->getLeftChild());
+                    AbstractWorkBody *otherBody = overlappingPair->getBody1() == body ? overlappingPair->getBody2() : overlappingPair->getBody1();
+                    if(!otherBody->isActive() || overlappingPair->getBody1() == body)
+                    { //pair of two active bodies is added once
+                        activeOverlappingPairs.push_back(overlappingPair);
+                    }
                 }
             }
         }
     }
 
+    /**
+     * @param bodiesAABBoxHitRay [out] Bodies AABBox hit by the ray
+     */
+    void BodyAABBTree::rayQuery(const Ray<float> &ray, std::vector<AbstractWorkBody *> &bodiesAABBoxHitRay) const
+    {
+        dynamicTree->rayQuery(ray, bodiesAABBoxHitRay);
+        staticTree->rayQuery(ray, bodiesAABBoxHitRay);
+    }
+
+    /**
+     * @param rayIndexBodiesAABBoxHitRays [out] Pairs of ray index and body AABBox hit by this ray
+     */
+    void BodyAABBTree::rayBatchQuery(const std::vector<Ray<float>> &rays, std::vector<std::pair<uint32_t, AbstractWorkBody *>> &rayIndexBodiesAABBoxHitRays) const
+    {
+        dynamicTree->rayBatchQuery(rays, rayIndexBodiesAABBoxHitRays);
+        staticTree->rayBatchQuery(rays, rayIndexBodiesAABBoxHitRays);
+    }
+
+    /**
+     * @param bodiesAABBoxHitEnlargedRay [out] Bodies AABBox hit by the enlarged ray
+     */
+    void BodyAABBTree::enlargedRayQuery(const Ray<float> &ray, float enlargeNodeBoxHalfSize, AbstractWorkBody *bodyToExclude,
+                                        std::vector<AbstractWorkBody *> &bodiesAABBoxHitEnlargedRay) const
+    {
+        dynamicTree->enlargedRayQuery(ray, enlargeNodeBoxHalfSize, bodyToExclude, bodiesAABBoxHitEnlargedRay);
+        staticTree->enlargedRayQuery(ray, enlargeNodeBoxHalfSize, bodyToExclude, bodiesAABBoxHitEnlargedRay);
+    }
+
+    void BodyAABBTree::computeOverlappingPairsFor(const AABBNode<AbstractWorkBody *> *leafNode, const AABBTree<AbstractWorkBody *> *tree)
+    {
+        pairedBodies.clear();
+        tree->aabboxQuery(leafNode->getAABBox(), pairedBodies);
+
+        auto *leafNodeData = dynamic_cast<BodyAABBNodeData *>(leafNode->getNodeData());
+        for(auto pairedBody : pairedBodies)
+        {
+            if(pairedBody!=leafNodeData->getNodeObject())
+            {
+                createOverlappingPair(leafNodeData, dynamic_cast<BodyAABBNodeData *>(tree->getNodeData(pairedBody)));
+            }
+        }
+    }
+
     void BodyAABBTree::createOverlappingPair(BodyAABBNodeData *nodeData1, BodyAABBNodeData *nodeData2)
     {
         if(!nodeData1->hasAlternativePairContainer() && !nodeData2->hasAlternativePairContainer())
@@ -107,7 +200,7 @@ namespace urchin
         }
     }
 
-    void BodyAABBTree::removeOverlappingPairs(const BodyAABBNodeData *nodeData)
+    void BodyAABBTree::removeOverlappingPairs(BodyAABBNodeData *nodeData)
     {
         if(!nodeData->hasAlternativePairContainer())
         {
@@ -123,6 +216,7 @@ namespace urchin
         for(auto &ownerPairContainer : nodeData->getOwnerPairContainers())
         {
             ownerPairContainer->removeOverlappingPairs(nodeData->getNodeObject());
+            nodeData->removeOwnerPairContainer(ownerPairContainer);
         }
     }
 
@@ -132,7 +226,7 @@ namespace urchin
         for (const auto &overlappingPair : overlappingPairs)
         {
             AbstractWorkBody *otherPairBody = overlappingPair.getBody1() == body ? overlappingPair.getBody2() : overlappingPair.getBody1();
-            auto *otherNodeData = dynamic_cast<BodyAABBNodeData *>(BodyAABBTree::getNodeData(otherPairBody));
+            BodyAABBNodeData *otherNodeData = getNodeData(otherPairBody);
 
             otherNodeData->removeOwnerPairContainer(alternativePairContainer);
         }
@@ -140,26 +234,27 @@ namespace urchin
 
     void BodyAABBTree::computeWorldBoundary()
     {
-        float maxYBoundary = -std::numeric_limits<float>::max();
-        for(auto &objectNode : objectsNode)
+        AABBox<float> worldAABBox = AABBox<float>::initMergeableAABBox();
+        if(staticTree->getRootNode())
         {
-            const AABBox<float> &nodeAABBox = objectNode.second->getAABBox();
-            minYBoundary = std::min(nodeAABBox.getMin().Y, minYBoundary);
-            maxYBoundary = std::max(nodeAABBox.getMax().Y, maxYBoundary);
+            worldAABBox = worldAABBox.merge(staticTree->getRootNode()->getAABBox());
+        }
+        if(dynamicTree->getRootNode())
+        {
+            worldAABBox = worldAABBox.merge(dynamicTree->getRootNode()->getAABBox());
         }
 
-        float worldHeight = maxYBoundary - minYBoundary;
+        minYBoundary = worldAABBox.getMin().Y;
+        float worldHeight = worldAABBox.getMax().Y - minYBoundary;
         minYBoundary -= worldHeight * BOUNDARIES_MARGIN_PERCENTAGE;
     }
 
-    void BodyAABBTree::controlBoundaries(AABBNode<AbstractWorkBody *> *leafNode)
+    void BodyAABBTree::controlBoundaries(AbstractWorkBody *body)
     {
-        const AABBox<float> &bodyAABBox = leafNode->getNodeData()->retrieveObjectAABBox();
+        const AABBox<float> &bodyAABBox = body->getAABBox();
 
         if(bodyAABBox.getMax().Y < minYBoundary)
         {
-            AbstractWorkBody *body = leafNode->getNodeData()->getNodeObject();
-
             std::stringstream logStream;
             logStream<<"Body "<<body->getId()<<" is below the limit of "<<std::to_string(minYBoundary)<<": "<<body->getPosition();
             Logger::logger().log(Logger::CriticalityLevel::WARNING, logStream.str());
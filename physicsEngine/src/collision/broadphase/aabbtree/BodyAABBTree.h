@@ -6,39 +6,51 @@
 #include "body/work/AbstractWorkBody.h"
 #include "collision/OverlappingPair.h"
 #include "collision/broadphase/PairContainer.h"
+#include "collision/broadphase/HashPairContainer.h"
 #include "collision/broadphase/BroadPhaseAlgorithm.h"
 #include "collision/broadphase/aabbtree/BodyAABBNodeData.h"
 
 namespace urchin
 {
 
-    class BodyAABBTree : public AABBTree<AbstractWorkBody *>
+    /**
+    * Bodies are dispatched in two trees: a static tree only rebuilt when static bodies are added/removed and a dynamic tree
+    * updated when bodies move. Overlapping pairs are only computed for dynamic-dynamic and dynamic-static bodies.
+    */
+    class BodyAABBTree
     {
         public:
             BodyAABBTree();
-            ~BodyAABBTree() override;
+            ~BodyAABBTree();
 
             void addBody(AbstractWorkBody *, PairContainer *);
-            void postAddObjectCallback(AABBNode<AbstractWorkBody *> *) override;
-
             void removeBody(AbstractWorkBody *);
-            void preRemoveObjectCallback(AABBNode<AbstractWorkBody *> *) override;
-
             void updateBodies();
-            void preUpdateObjectCallback(AABBNode<AbstractWorkBody *> *) override;
 
+            BodyAABBNodeData *getNodeData(AbstractWorkBody *) const;
             const std::vector<OverlappingPair *> &getOverlappingPairs() const;
+            void computeActiveOverlappingPairs(std::vector<OverlappingPair *> &) const;
+
+            void rayQuery(const Ray<float> &, std::vector<AbstractWorkBody *> &) const;
+            void rayBatchQuery(const std::vector<Ray<float>> &, std::vector<std::pair<uint32_t, AbstractWorkBody *>> &) const;
+            void enlargedRayQuery(const Ray<float> &, float, AbstractWorkBody *, std::vector<AbstractWorkBody *> &) const;
 
         private:
-            void computeOverlappingPairsFor(AABBNode<AbstractWorkBody *> *);
+            void computeOverlappingPairsFor(const AABBNode<AbstractWorkBody *> *, const AABBTree<AbstractWorkBody *> *);
             void createOverlappingPair(BodyAABBNodeData *, BodyAABBNodeData *);
-            void removeOverlappingPairs(const BodyAABBNodeData *);
+            void removeOverlappingPairs(BodyAABBNodeData *);
             void removeAlternativePairContainerReferences(const AbstractWorkBody *, PairContainer *);
 
             void computeWorldBoundary();
-            void controlBoundaries(AABBNode<AbstractWorkBody *> *);
+            void controlBoundaries(AbstractWorkBody *);
+
+            AABBTree<AbstractWorkBody *> *staticTree;
+            AABBTree<AbstractWorkBody *> *dynamicTree;
+            bool staticTreeModified;
+            std::vector<AbstractWorkBody *> dynamicBodies;
+            std::vector<AbstractWorkBody *> pairedBodies;
 
-            PairContainer *defaultPairContainer;
+            HashPairContainer *defaultPairContainer;
 
             bool inInitializationPhase;
             float minYBoundary;
@@ -1,32 +1,80 @@
 #include <cassert>
+#include <numeric>
 
 #include "collision/constraintsolver/ConstraintSolverManager.h"
 
+#define MIN_CONTACT_POINTS_BY_THREAD 32
+
 namespace urchin
 {
 
-	ConstraintSolverManager::ConstraintSolverManager() :
+	ConstraintSolverManager::ConstraintSolverManager(const IslandManager *islandManager) :
+			islandManager(islandManager),
+			islandsThreadPool(nullptr),
+			constraintSolvingPoolSize(ConfigService::instance()->getUnsignedIntValue("constraintSolver.constraintSolvingPoolSize")),
 			constraintSolverIteration(ConfigService::instance()->getUnsignedIntValue("constraintSolver.constraintSolverIteration")),
 			biasFactor(ConfigService::instance()->getFloatValue("constraintSolver.biasFactor")),
 			useWarmStarting(ConfigService::instance()->getBoolValue("constraintSolver.useWarmStarting")),
+			warmStartingFactor(ConfigService::instance()->getFloatValue("constraintSolver.warmStartingFactor")),
 			restitutionVelocityThreshold(ConfigService::instance()->getFloatValue("constraintSolver.restitutionVelocityThreshold"))
 	{
-		unsigned int constraintSolvingPoolSize = ConfigService::instance()->getUnsignedIntValue("constraintSolver.constraintSolvingPoolSize");
-		constraintSolvingPool = new FixedSizePool<ConstraintSolving>("constraintSolvingPool", sizeof(ConstraintSolving), constraintSolvingPoolSize);
+		threadsConstraintSolvingPool.push_back(new FixedSizePool<ConstraintSolving>("constraintSolvingPool", sizeof(ConstraintSolving), constraintSolvingPoolSize));
+		threadsConstraintsSolving.resize(1);
+		threadsIslandIndices.resize(1);
+
+		setNumThreads(ConfigService::instance()->getUnsignedIntValue("constraintSolver.numThreads"));
 	}
 
 	ConstraintSolverManager::~ConstraintSolverManager()
 	{
-		for (auto &constraintSolving : constraintsSolving)
+		delete islandsThreadPool;
+
+		for(auto &constraintSolvingPool : threadsConstraintSolvingPool)
 		{
-			constraintSolvingPool->free(constraintSolving);
+			delete constraintSolvingPool;
+		}
+	}
+
+	/**
+	 * Define the number of threads used to solve the islands. The physics thread is included in this number.
+	 * @param numThreads Number of threads. A value of 1 disables the parallel solving and a value of 0 uses the number of hardware threads.
+	 */
+	void ConstraintSolverManager::setNumThreads(unsigned int numThreads)
+	{
+		if(numThreads == 0)
+		{
+			numThreads = std::max(1u, std::thread::hardware_concurrency());
+		}
+
+		if(numThreads != getNumThreads())
+		{
+			delete islandsThreadPool;
+			islandsThreadPool = (numThreads > 1) ? new ThreadPool(numThreads) : nullptr;
+
+			while(threadsConstraintSolvingPool.size() > numThreads)
+			{
+				delete threadsConstraintSolvingPool.back();
+				threadsConstraintSolvingPool.pop_back();
+			}
+			while(threadsConstraintSolvingPool.size() < numThreads)
+			{ //each thread has its own pool: no synchronization required on allocations
+				std::string poolName = "constraintSolvingPool" + std::to_string(threadsConstraintSolvingPool.size());
+				threadsConstraintSolvingPool.push_back(new FixedSizePool<ConstraintSolving>(poolName, sizeof(ConstraintSolving), constraintSolvingPoolSize));
+			}
+
+			threadsConstraintsSolving.resize(numThreads);
+			threadsIslandIndices.resize(numThreads);
 		}
+	}
 
-		delete constraintSolvingPool;
+	unsigned int ConstraintSolverManager::getNumThreads() const
+	{
+		return islandsThreadPool ? islandsThreadPool->getNumThreads() : 1;
 	}
 
 	/**
-	 * Solve constraints
+	 * Solve constraints. Constraints are grouped by islands (bodies in contact) and islands are solved independently:
+	 * islands don't share any non-static body so they can be solved in parallel.
 	 * @param dt Delta of time (sec.) between two simulation steps
 	 * @param manifoldResults Constraints to solve
 	 */
@@ -34,63 +82,187 @@ namespace urchin
 	{
 		ScopeProfiler profiler("physics", "solveConstraint");
 
-		//setup step to solve constraints
-		setupConstraints(manifoldResults, dt);
+		buildIslands(manifoldResults);
+
+		unsigned int totalContactPoints = std::accumulate(islandsNumContactPoints.begin(), islandsNumContactPoints.end(), 0u);
+		if(islandsThreadPool && islandsManifoldResults.size() > 1 && totalContactPoints >= MIN_CONTACT_POINTS_BY_THREAD * 2)
+		{
+			auto numThreadsNeeded = std::min(islandsThreadPool->getNumThreads(), totalContactPoints / MIN_CONTACT_POINTS_BY_THREAD);
+			dispatchIslands(numThreadsNeeded);
 
-		//iterative constraint solver
-		for(unsigned int i=0; i<constraintSolverIteration; ++i)
+			islandsThreadPool->parallelFor(numThreadsNeeded, [&](unsigned int threadIndex, std::size_t, std::size_t) {
+				solveIslands(dt, threadIndex);
+			}, numThreadsNeeded);
+		}else
 		{
-			solveConstraints();
+			dispatchIslands(1);
+			solveIslands(dt, 0);
+		}
+
+		if(useWarmStarting)
+		{
+			storeAccumulatedImpulses();
 		}
 	}
 
-	void ConstraintSolverManager::setupConstraints(std::vector<ManifoldResult> &manifoldResults, float dt)
-	{ //See http://en.wikipedia.org/wiki/Collision_response for formulas
+	/**
+	 * Group the manifold results by the islands of the island manager. Static bodies don't link the islands because their
+	 * velocities are never updated.
+	 */
+	void ConstraintSolverManager::buildIslands(std::vector<ManifoldResult> &manifoldResults)
+	{
+		constexpr unsigned int ISLAND_NOT_ADDED = std::numeric_limits<unsigned int>::max();
 
-		//clear constraints solving
-		for (auto &constraintSolving : constraintsSolving)
+		for(auto &islandManifoldResults : islandsManifoldResults)
+		{
+			islandManifoldResults.clear();
+		}
+		islandsNumContactPoints.clear();
+
+		//1. number the islands having contact points and dispatch manifold results in their islands
+		unsigned int numIslands = 0;
+		islandIds.clear();
+		for(auto &manifoldResult : manifoldResults)
+		{
+			AbstractWorkBody *nonStaticBody = manifoldResult.getBody1()->isStatic() ? manifoldResult.getBody2() : manifoldResult.getBody1();
+			if(!nonStaticBody->isStatic())
+			{
+				unsigned int islandId = islandManager->getIslandId(nonStaticBody);
+				if(islandId >= islandIndexes.size())
+				{
+					islandIndexes.resize(islandId + 1, ISLAND_NOT_ADDED);
+				}
+
+				if(islandIndexes[islandId] == ISLAND_NOT_ADDED)
+				{
+					islandIndexes[islandId] = numIslands++;
+					islandIds.push_back(islandId);
+					if(islandsManifoldResults.size() < numIslands)
+					{
+						islandsManifoldResults.resize(numIslands);
+					}
+					islandsNumContactPoints.push_back(0);
+				}
+
+				unsigned int islandIndex = islandIndexes[islandId];
+				islandsManifoldResults[islandIndex].push_back(&manifoldResult);
+				islandsNumContactPoints[islandIndex] += manifoldResult.getNumContactPoints();
+			}
+		}
+		islandsManifoldResults.resize(numIslands);
+
+		//2. reset island indexes for next step
+		for(unsigned int islandId : islandIds)
+		{
+			islandIndexes[islandId] = ISLAND_NOT_ADDED;
+		}
+	}
+
+	/**
+	 * Dispatch the islands between the threads: biggest islands are dispatched first on the less loaded thread.
+	 */
+	void ConstraintSolverManager::dispatchIslands(unsigned int numThreads)
+	{
+		std::vector<unsigned int> islandIndices(islandsManifoldResults.size());
+		std::iota(islandIndices.begin(), islandIndices.end(), 0);
+		if(numThreads > 1)
+		{
+			std::sort(islandIndices.begin(), islandIndices.end(), [&](unsigned int islandIndex1, unsigned int islandIndex2) {
+				return islandsNumContactPoints[islandIndex1] > islandsNumContactPoints[islandIndex2];
+			});
+		}
+
+		std::vector<unsigned int> threadsLoad(numThreads, 0);
+		for(auto &threadIslandIndices : threadsIslandIndices)
+		{
+			threadIslandIndices.clear();
+		}
+		for(unsigned int islandIndex : islandIndices)
+		{
+			auto lessLoadedThreadIt = std::min_element(threadsLoad.begin(), threadsLoad.end());
+			*lessLoadedThreadIt += islandsNumContactPoints[islandIndex];
+			threadsIslandIndices[std::distance(threadsLoad.begin(), lessLoadedThreadIt)].push_back(islandIndex);
+		}
+	}
+
+	/**
+	 * Solve the islands dispatched on a thread. Each island has its own constraints allocated in the pool of the thread.
+	 */
+	void ConstraintSolverManager::solveIslands(float dt, unsigned int threadIndex)
+	{
+		for(unsigned int islandIndex : threadsIslandIndices[threadIndex])
 		{
-			constraintSolvingPool->free(constraintSolving);
+			//setup step to solve constraints
+			setupConstraints(islandsManifoldResults[islandIndex], dt, threadIndex);
+
+			//iterative constraint solver
+			for(unsigned int i=0; i<constraintSolverIteration; ++i)
+			{
+				solveConstraints(threadsConstraintsSolving[threadIndex]);
+			}
+
+			clearConstraints(threadIndex);
 		}
-		constraintsSolving.clear();
+	}
+
+	void ConstraintSolverManager::setupConstraints(const std::vector<ManifoldResult *> &manifoldResults, float dt, unsigned int threadIndex)
+	{ //See http://en.wikipedia.org/wiki/Collision_response for formulas
+		std::vector<ConstraintSolving *> &constraintsSolving = threadsConstraintsSolving[threadIndex];
+		FixedSizePool<ConstraintSolving> *constraintSolvingPool = threadsConstraintSolvingPool[threadIndex];
 
 		//setup constraints solving
 		for (auto &manifoldResult : manifoldResults)
 		{
-			for(unsigned int j=0; j< manifoldResult.getNumContactPoints(); ++j)
+			for(unsigned int j=0; j< manifoldResult->getNumContactPoints(); ++j)
 			{
-				ManifoldContactPoint &contact = manifoldResult.getManifoldContactPoint(j);
-				if(contact.getDepth() > 0.0 && !contact.isPredictive())
+				ManifoldContactPoint &contact = manifoldResult->getManifoldContactPoint(j);
+				if(!isConstraintRequired(contact))
 				{
 					continue;
 				}
 
-				WorkRigidBody *body1 = WorkRigidBody::upCast(manifoldResult.getBody1());
-				WorkRigidBody *body2 = WorkRigidBody::upCast(manifoldResult.getBody2());
+				WorkRigidBody *body1 = WorkRigidBody::upCast(manifoldResult->getBody1());
+				WorkRigidBody *body2 = WorkRigidBody::upCast(manifoldResult->getBody2());
 				void *memPtr = constraintSolvingPool->allocate(sizeof(ConstraintSolving));
 				auto *constraintSolving = new(memPtr) ConstraintSolving(body1, body2, contact);
 
-				const CommonSolvingData &commonSolvingData = fillCommonSolvingData(manifoldResult, contact);
+				const CommonSolvingData &commonSolvingData = fillCommonSolvingData(*manifoldResult, contact);
 				constraintSolving->setCommonData(commonSolvingData);
 
 				const ImpulseSolvingData &impulseSolvingData = fillImpulseSolvingData(commonSolvingData, dt);
 				constraintSolving->setImpulseData(impulseSolvingData);
 
 				if(useWarmStarting)
-				{
-					const Vector3<float> normalImpulseVector = contact.getAccumulatedSolvingData().accNormalImpulse * commonSolvingData.contactNormal;
-					applyImpulse(constraintSolving->getBody1(), constraintSolving->getBody2(), commonSolvingData, normalImpulseVector);
-
-					const Vector3<float> tangentImpulseVector = contact.getAccumulatedSolvingData().accTangentImpulse * commonSolvingData.contactTangent;
-					applyImpulse(constraintSolving->getBody1(), constraintSolving->getBody2(), commonSolvingData, tangentImpulseVector);
+				{ //cache is only read while islands are solved: no synchronization required between threads
+					warmStartCache.retrieveAccumulatedData(*manifoldResult, contact);
 				}
 
 				constraintsSolving.push_back(constraintSolving);
 			}
 		}
+
+		//apply impulses of previous step once all constraints are setup: restitution biases are computed on the velocities of the step
+		if(useWarmStarting)
+		{
+			for(auto &constraintSolving : constraintsSolving)
+			{
+				const CommonSolvingData &commonSolvingData = constraintSolving->getCommonData();
+				AccumulatedSolvingData &accumulatedSolvingData = constraintSolving->getAccumulatedData();
+
+				//impulses of previous step contain the depth correction: they are reduced to avoid to correct the depth twice
+				accumulatedSolvingData.accNormalImpulse *= warmStartingFactor;
+				accumulatedSolvingData.accTangentImpulse *= warmStartingFactor;
+
+				const Vector3<float> normalImpulseVector = accumulatedSolvingData.accNormalImpulse * commonSolvingData.contactNormal;
+				applyImpulse(constraintSolving->getBody1(), constraintSolving->getBody2(), commonSolvingData, normalImpulseVector);
+
+				const Vector3<float> tangentImpulseVector = accumulatedSolvingData.accTangentImpulse * commonSolvingData.contactTangent;
+				applyImpulse(constraintSolving->getBody1(), constraintSolving->getBody2(), commonSolvingData, tangentImpulseVector);
+			}
+		}
 	}
 
-	void ConstraintSolverManager::solveConstraints()
+	void ConstraintSolverManager::solveConstraints(const std::vector<ConstraintSolving *> &constraintsSolving)
 	{
 		//solve tangent constraint first because non-penetration is more important than friction
 		for (auto &constraintSolving : constraintsSolving)
@@ -105,6 +277,56 @@ namespace urchin
 		}
 	}
 
+	void ConstraintSolverManager::clearConstraints(unsigned int threadIndex)
+	{
+		for (auto &constraintSolving : threadsConstraintsSolving[threadIndex])
+		{
+			threadsConstraintSolvingPool[threadIndex]->free(constraintSolving);
+		}
+		threadsConstraintsSolving[threadIndex].clear();
+	}
+
+	/**
+	 * Store the accumulated impulses of the step in the warm start cache. Manifold results are copies of the ones of the
+	 * collision algorithms: the accumulated impulses are lost after the step when they are not stored in the cache.
+	 */
+	void ConstraintSolverManager::storeAccumulatedImpulses()
+	{
+		for(const auto &islandManifoldResults : islandsManifoldResults)
+		{
+			for(const auto &manifoldResult : islandManifoldResults)
+			{
+				for(unsigned int j=0; j<manifoldResult->getNumContactPoints(); ++j)
+				{
+					const ManifoldContactPoint &contact = manifoldResult->getManifoldContactPoint(j);
+					if(isConstraintRequired(contact))
+					{
+						warmStartCache.storeAccumulatedData(*manifoldResult, contact);
+					}
+				}
+			}
+		}
+
+		warmStartCache.removeUnusedEntries();
+	}
+
+	/**
+	 * @return True if the contact point must be solved: bodies are in contact or the contact point is predictive
+	 */
+	bool ConstraintSolverManager::isConstraintRequired(const ManifoldContactPoint &contact) const
+	{
+		return contact.getDepth() <= 0.0 || contact.isPredictive();
+	}
+
+	/**
+	 * @return True if the contact point is a speculative contact: bodies are not in contact yet and the moving body (body 1)
+	 * uses the speculative continuous collision detection mode
+	 */
+	bool ConstraintSolverManager::isSpeculativeContact(const AbstractWorkBody *body1, const ManifoldContactPoint &contact) const
+	{
+		return contact.isPredictive() && contact.getDepth() > 0.0f && body1->getCcdMode() == AbstractWorkBody::SPECULATIVE_CCD;
+	}
+
 	CommonSolvingData ConstraintSolverManager::fillCommonSolvingData(const ManifoldResult &manifoldResult, const ManifoldContactPoint &contact)
 	{
 		CommonSolvingData commonSolvingData;
@@ -119,6 +341,12 @@ namespace urchin
 		commonSolvingData.invInertia2 = body2->getInvWorldInertia();
 		commonSolvingData.r1 = body1->getPosition().vector(contact.getPointOnObject2());
 		commonSolvingData.r2 = body2->getPosition().vector(contact.getPointOnObject2());
+		commonSolvingData.isSpeculative = isSpeculativeContact(body1, contact);
+		if(commonSolvingData.isSpeculative)
+		{ //closest points of distant bodies are not stable features: speculative contact only limits the linear approach of bodies
+			commonSolvingData.r1 = contact.getNormalFromObject2() * commonSolvingData.r1.dotProduct(contact.getNormalFromObject2());
+			commonSolvingData.r2 = contact.getNormalFromObject2() * commonSolvingData.r2.dotProduct(contact.getNormalFromObject2());
+		}
 
 		commonSolvingData.depth = contact.getDepth();
 		commonSolvingData.contactNormal = contact.getNormalFromObject2();
@@ -157,16 +385,21 @@ namespace urchin
 
 		//bias
 		float invDeltaTime = dt > 0.0f ? 1.0f / dt : 0.0f;
-		float restitution = std::max(commonData.body1->getRestitution(), commonData.body2->getRestitution());
-
-		float normalRelativeVelocity = computeRelativeVelocity(commonData).dotProduct(commonData.contactNormal);
-		float depthBias = biasFactor * invDeltaTime * commonData.depth;
-		float restitutionBias = 0.0f;
-		if(normalRelativeVelocity > restitutionVelocityThreshold)
+		if(commonData.isSpeculative)
+		{ //speculative contact: bodies can close the gap in one step but no more
+			impulseSolvingData.bias = invDeltaTime * commonData.depth;
+		}else
 		{
-			restitutionBias =  -restitution * normalRelativeVelocity;
+			float restitution = std::max(commonData.body1->getRestitution(), commonData.body2->getRestitution());
+			float normalRelativeVelocity = computeRelativeVelocity(commonData).dotProduct(commonData.contactNormal);
+			float depthBias = biasFactor * invDeltaTime * commonData.depth;
+			float restitutionBias = 0.0f;
+			if(normalRelativeVelocity > restitutionVelocityThreshold)
+			{
+				restitutionBias =  -restitution * normalRelativeVelocity;
+			}
+			impulseSolvingData.bias = std::min(depthBias, restitutionBias);
 		}
-		impulseSolvingData.bias = std::min(depthBias, restitutionBias);
 
 		return impulseSolvingData;
 	}
@@ -216,13 +449,22 @@ namespace urchin
 		applyImpulse(constraintSolving->getBody1(), constraintSolving->getBody2(), commonSolvingData, tangentImpulseVector);
 	}
 
+	/**
+	 * Apply impulse on non-static bodies. Static bodies are not updated because they can be shared by islands solved in parallel.
+	 */
 	void ConstraintSolverManager::applyImpulse(WorkRigidBody *body1, WorkRigidBody *body2, const CommonSolvingData &commonData, const Vector3<float> &impulseVector)
 	{
-		body1->setLinearVelocity(body1->getLinearVelocity() - (impulseVector * body1->getInvMass() * body1->getLinearFactor()));
-		body1->setAngularVelocity(body1->getAngularVelocity() - (commonData.invInertia1 * commonData.r1.crossProduct(impulseVector * body1->getLinearFactor()) * body1->getAngularFactor()));
+		if(!body1->isStatic())
+		{
+			body1->setLinearVelocity(body1->getLinearVelocity() - (impulseVector * body1->getInvMass() * body1->getLinearFactor()));
+			body1->setAngularVelocity(body1->getAngularVelocity() - (commonData.invInertia1 * commonData.r1.crossProduct(impulseVector * body1->getLinearFactor()) * body1->getAngularFactor()));
+		}
 
-		body2->setLinearVelocity(body2->getLinearVelocity() + (impulseVector * body2->getInvMass() * body2->getLinearFactor()));
-		body2->setAngularVelocity(body2->getAngularVelocity() + (commonData.invInertia2 * commonData.r2.crossProduct(impulseVector * body2->getLinearFactor()) * body2->getAngularFactor()));
+		if(!body2->isStatic())
+		{
+			body2->setLinearVelocity(body2->getLinearVelocity() + (impulseVector * body2->getInvMass() * body2->getLinearFactor()));
+			body2->setAngularVelocity(body2->getAngularVelocity() + (commonData.invInertia2 * commonData.r2.crossProduct(impulseVector * body2->getLinearFactor()) * body2->getAngularFactor()));
+		}
 	}
 
 	/**
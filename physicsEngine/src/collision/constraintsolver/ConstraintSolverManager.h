@@ -6,10 +6,12 @@
 #include "UrchinCommon.h"
 
 #include "collision/constraintsolver/ConstraintSolving.h"
+#include "collision/constraintsolver/WarmStartCache.h"
 #include "collision/constraintsolver/solvingdata/CommonSolvingData.h"
 #include "collision/constraintsolver/solvingdata/ImpulseSolvingData.h"
 #include "body/BodyManager.h"
 #include "collision/ManifoldResult.h"
+#include "collision/island/IslandManager.h"
 #include "utils/pool/FixedSizePool.h"
 #include "body/work/WorkRigidBody.h"
 
@@ -19,14 +21,25 @@ namespace urchin
 	class ConstraintSolverManager
 	{
 		public:
-			ConstraintSolverManager();
+			explicit ConstraintSolverManager(const IslandManager *);
 			~ConstraintSolverManager();
 
+			void setNumThreads(unsigned int);
+			unsigned int getNumThreads() const;
+
 			void solveConstraints(float, std::vector<ManifoldResult> &);
 
 		private:
-			void setupConstraints(std::vector<ManifoldResult> &, float);
-			void solveConstraints();
+			void buildIslands(std::vector<ManifoldResult> &);
+			void dispatchIslands(unsigned int);
+			void solveIslands(float, unsigned int);
+
+			void setupConstraints(const std::vector<ManifoldResult *> &, float, unsigned int);
+			void solveConstraints(const std::vector<ConstraintSolving *> &);
+			void clearConstraints(unsigned int);
+			void storeAccumulatedImpulses();
+			bool isConstraintRequired(const ManifoldContactPoint &) const;
+			bool isSpeculativeContact(const AbstractWorkBody *, const ManifoldContactPoint &) const;
 
 			CommonSolvingData fillCommonSolvingData(const ManifoldResult &, const ManifoldContactPoint &);
 			ImpulseSolvingData fillImpulseSolvingData(const CommonSolvingData &, float) const;
@@ -40,12 +53,23 @@ namespace urchin
 
 			void logCommonData(const std::string &, const CommonSolvingData &) const;
 
-			std::vector<ConstraintSolving *> constraintsSolving;
-			FixedSizePool<ConstraintSolving> *constraintSolvingPool;
+			const IslandManager *islandManager;
+			std::vector<unsigned int> islandIndexes;
+			std::vector<unsigned int> islandIds;
+			std::vector<std::vector<ManifoldResult *>> islandsManifoldResults;
+			std::vector<unsigned int> islandsNumContactPoints;
+			WarmStartCache warmStartCache;
+
+			ThreadPool *islandsThreadPool;
+			std::vector<std::vector<unsigned int>> threadsIslandIndices;
+			std::vector<std::vector<ConstraintSolving *>> threadsConstraintsSolving;
+			std::vector<FixedSizePool<ConstraintSolving> *> threadsConstraintSolvingPool;
+			const unsigned int constraintSolvingPoolSize;
 
 			const unsigned int constraintSolverIteration;
 			const float biasFactor;
 			const bool useWarmStarting;
+			const float warmStartingFactor;
 			const float restitutionVelocityThreshold;
 	};
 
@@ -0,0 +1,89 @@
+#include <functional>
+
+#include "collision/constraintsolver/WarmStartCache.h"
+
+namespace urchin
+{
+
+	WarmStartCache::WarmStartCache() :
+			stepId(0)
+	{
+
+	}
+
+	/**
+	 * @param contact [out] Contact point updated with the accumulated data of the previous frame
+	 * @return True if accumulated data of the contact point exist in the cache
+	 */
+	bool WarmStartCache::retrieveAccumulatedData(const ManifoldResult &manifoldResult, ManifoldContactPoint &contact) const
+	{
+		if(contact.getFeatureId() == NO_FEATURE_ID)
+		{
+			return false;
+		}
+
+		auto itFind = cacheEntries.find(computeContactKey(manifoldResult, contact));
+		if(itFind == cacheEntries.end())
+		{
+			return false;
+		}
+
+		contact.getAccumulatedSolvingData() = itFind->second.accumulatedSolvingData;
+		return true;
+	}
+
+	void WarmStartCache::storeAccumulatedData(const ManifoldResult &manifoldResult, const ManifoldContactPoint &contact)
+	{
+		if(contact.getFeatureId() != NO_FEATURE_ID)
+		{
+			CacheEntry &cacheEntry = cacheEntries[computeContactKey(manifoldResult, contact)];
+			cacheEntry.accumulatedSolvingData = contact.getAccumulatedSolvingData();
+			cacheEntry.lastStepId = stepId;
+		}
+	}
+
+	/**
+	 * Remove the entries of the contact points not stored since the last call: features are not in contact anymore.
+	 */
+	void WarmStartCache::removeUnusedEntries()
+	{
+		for(auto it = cacheEntries.begin(); it != cacheEntries.end();)
+		{
+			if(it->second.lastStepId != stepId)
+			{
+				it = cacheEntries.erase(it);
+			}else
+			{
+				++it;
+			}
+		}
+
+		stepId++;
+	}
+
+	std::size_t WarmStartCache::getSize() const
+	{
+		return cacheEntries.size();
+	}
+
+	/**
+	 * Bodies are not sorted: bodies order defines the contact normal direction.
+	 */
+	WarmStartCache::ContactKey WarmStartCache::computeContactKey(const ManifoldResult &manifoldResult, const ManifoldContactPoint &contact) const
+	{
+		auto objectId1 = static_cast<uint64_t>(manifoldResult.getBody1()->getObjectId());
+		auto objectId2 = static_cast<uint64_t>(manifoldResult.getBody2()->getObjectId());
+		return {(objectId1 << 32u) | objectId2, contact.getFeatureId()};
+	}
+
+	bool WarmStartCache::ContactKey::operator==(const ContactKey &other) const
+	{
+		return bodiesKey == other.bodiesKey && featureId == other.featureId;
+	}
+
+	std::size_t WarmStartCache::ContactKeyHash::operator()(const ContactKey &contactKey) const
+	{
+		return std::hash<uint64_t>()(contactKey.bodiesKey ^ (static_cast<uint64_t>(contactKey.featureId) * 0x9e3779b97f4a7c15ull));
+	}
+
+}
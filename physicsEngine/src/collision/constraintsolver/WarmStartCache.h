@@ -0,0 +1,58 @@
+#ifndef URCHINENGINE_WARMSTARTCACHE_H
+#define URCHINENGINE_WARMSTARTCACHE_H
+
+#include <unordered_map>
+#include <cstdint>
+#include "UrchinCommon.h"
+
+#include "collision/ManifoldResult.h"
+#include "collision/ManifoldContactPoint.h"
+#include "collision/constraintsolver/solvingdata/AccumulatedSolvingData.h"
+
+namespace urchin
+{
+
+	/**
+	* Cache of the accumulated impulses of the contact points. Contact points are identified by their bodies and their
+	* features: impulses of a frame are applied at the beginning of the next frame (warm starting) to converge faster.
+	*/
+	class WarmStartCache
+	{
+		public:
+			WarmStartCache();
+
+			bool retrieveAccumulatedData(const ManifoldResult &, ManifoldContactPoint &) const;
+			void storeAccumulatedData(const ManifoldResult &, const ManifoldContactPoint &);
+			void removeUnusedEntries();
+
+			std::size_t getSize() const;
+
+		private:
+			struct ContactKey
+			{
+				bool operator==(const ContactKey &) const;
+
+				uint64_t bodiesKey;
+				unsigned int featureId;
+			};
+
+			struct ContactKeyHash
+			{
+				std::size_t operator()(const ContactKey &) const;
+			};
+
+			struct CacheEntry
+			{
+				AccumulatedSolvingData accumulatedSolvingData;
+				unsigned int lastStepId;
+			};
+
+			ContactKey computeContactKey(const ManifoldResult &, const ManifoldContactPoint &) const;
+
+			std::unordered_map<ContactKey, CacheEntry, ContactKeyHash> cacheEntries;
+			unsigned int stepId;
+	};
+
+}
+
+#endif
@@ -6,7 +6,8 @@ namespace urchin
 	CommonSolvingData::CommonSolvingData() :
 			body1(nullptr),
 			body2(nullptr),
-			depth(0.0)
+			depth(0.0),
+			isSpeculative(false)
 	{
 
 	}
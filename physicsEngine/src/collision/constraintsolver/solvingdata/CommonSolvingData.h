@@ -25,6 +25,7 @@ namespace urchin
 		Vector3<float> r1, r2; //vector from center of mass of body to contact point
 
 		float depth; //penetration depth (negative when collision exist)
+		bool isSpeculative; //bodies are not in contact yet: depth is the distance which can be closed during the step
 	};
 
 }
@@ -1,5 +1,3 @@
-#include <memory>
-
 #include "collision/integration/IntegrateTransformManager.h"
 #include "shape/CollisionSphereShape.h"
 #include "object/TemporalObject.h"
@@ -23,24 +21,35 @@ namespace urchin
 	 */
 	void IntegrateTransformManager::integrateTransform(float dt)
 	{
-		for (auto abstractBody : bodyManager->getWorkBodies())
+		if(AbstractWorkBody::areAllBodiesDisabled())
+		{
+			return;
+		}
+
+		BodyStateStore *bodyStateStore = bodyManager->getBodyStateStore();
+		const unsigned int nbBodies = bodyStateStore->getNumberBodies();
+		const uint8_t *activeFlags = bodyStateStore->getActiveFlags().data();
+		const Vector3<float> *linearVelocities = bodyStateStore->getLinearVelocities().data();
+		const Vector3<float> *angularVelocities = bodyStateStore->getAngularVelocities().data();
+		PhysicsTransform *transforms = bodyStateStore->getTransforms().data();
+
+		for(unsigned int i=0; i<nbBodies; ++i)
 		{
-			WorkRigidBody *body = WorkRigidBody::upCast(abstractBody);
-			if(body && body->isActive())
+			if(activeFlags[i])
 			{
-				const PhysicsTransform &currentTransform = body->getPhysicsTransform();
-				PhysicsTransform newTransform = body->getPhysicsTransform().integrate(body->getLinearVelocity(), body->getAngularVelocity(), dt);
+				const PhysicsTransform &currentTransform = transforms[i];
+				PhysicsTransform newTransform = currentTransform.integrate(linearVelocities[i], angularVelocities[i], dt);
 
+				WorkRigidBody *body = bodyStateStore->getBody(i);
 				float ccdMotionThreshold = body->getCcdMotionThreshold();
 				float motion = currentTransform.getPosition().vector(newTransform.getPosition()).length();
 
-				if(motion > ccdMotionThreshold)
-				{
+				if(motion > ccdMotionThreshold && body->getCcdMode() == AbstractWorkBody::SWEPT_CCD)
+				{ //bodies in speculative mode are not swept: their speculative contacts added in narrow phase prevent them from crossing other bodies
 					handleContinuousCollision(body, currentTransform, newTransform, dt);
 				}else
 				{
-					body->setPosition(newTransform.getPosition());
-					body->setOrientation(newTransform.getOrientation());
+					transforms[i] = newTransform;
 				}
 			}
 		}
@@ -53,8 +62,8 @@ namespace urchin
 		std::vector<AbstractWorkBody *> bodiesAABBoxHitBody = broadPhaseManager->bodyTest(body, from, to);
 		if(!bodiesAABBoxHitBody.empty())
 		{
-			auto bodyEncompassedSphereShape = std::make_shared<CollisionSphereShape>(body->getShape()->getMinDistanceToCenter());
-			TemporalObject temporalObject(bodyEncompassedSphereShape.get(), from, to);
+			CollisionSphereShape bodyEncompassedSphereShape(body->getShape()->getMinDistanceToCenter());
+			TemporalObject temporalObject(&bodyEncompassedSphereShape, from, to);
 			ccd_set ccdResults = narrowPhaseManager->continuousCollisionTest(temporalObject, bodiesAABBoxHitBody);
 
 			if(!ccdResults.empty())
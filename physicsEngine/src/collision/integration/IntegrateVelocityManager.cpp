@@ -22,22 +22,38 @@ namespace urchin
 		applyRollingFrictionResistanceForce(dt, overlappingPairs);
 
 		//integrate velocities and apply damping
-		for (auto abstractBody : bodyManager->getWorkBodies())
+		if(AbstractWorkBody::areAllBodiesDisabled())
 		{
-			WorkRigidBody *body = WorkRigidBody::upCast(abstractBody);
-			if(body && body->isActive())
+			return;
+		}
+
+		BodyStateStore *bodyStateStore = bodyManager->getBodyStateStore();
+		const unsigned int nbBodies = bodyStateStore->getNumberBodies();
+		const uint8_t *activeFlags = bodyStateStore->getActiveFlags().data();
+		const float *invMasses = bodyStateStore->getInvMasses().data();
+		const Matrix3<float> *invWorldInertias = bodyStateStore->getInvWorldInertias().data();
+		const float *linearDampings = bodyStateStore->getLinearDampings().data();
+		const float *angularDampings = bodyStateStore->getAngularDampings().data();
+		Vector3<float> *linearVelocities = bodyStateStore->getLinearVelocities().data();
+		Vector3<float> *angularVelocities = bodyStateStore->getAngularVelocities().data();
+		Vector3<float> *totalMomentums = bodyStateStore->getTotalMomentums().data();
+		Vector3<float> *totalTorqueMomentums = bodyStateStore->getTotalTorqueMomentums().data();
+
+		for(unsigned int i=0; i<nbBodies; ++i)
+		{
+			if(activeFlags[i])
 			{
 				//integrate velocity
-				body->setLinearVelocity(body->getLinearVelocity() + (body->getTotalMomentum() * body->getInvMass()));
-				body->setAngularVelocity(body->getAngularVelocity() + (body->getTotalTorqueMomentum() * body->getInvWorldInertia()));
+				linearVelocities[i] += totalMomentums[i] * invMasses[i];
+				angularVelocities[i] += totalTorqueMomentums[i] * invWorldInertias[i];
 
 				//apply damping
-				body->setLinearVelocity(body->getLinearVelocity() * powf(1.0f - body->getLinearDamping(), dt));
-				body->setAngularVelocity(body->getAngularVelocity() * powf(1.0f - body->getAngularDamping(), dt));
+				linearVelocities[i] *= powf(1.0f - linearDampings[i], dt);
+				angularVelocities[i] *= powf(1.0f - angularDampings[i], dt);
 
 				//reset momentum
-				body->resetMomentum();
-				body->resetTorqueMomentum();
+				totalMomentums[i].setValues(0.0f, 0.0f, 0.0f);
+				totalTorqueMomentums[i].setValues(0.0f, 0.0f, 0.0f);
 			}
 		}
 	}
@@ -47,12 +63,23 @@ namespace urchin
 	 */
 	void IntegrateVelocityManager::applyGravityForce(const Vector3<float> &gravity, float dt)
 	{
-		for (auto abstractBody : bodyManager->getWorkBodies())
+		if(AbstractWorkBody::areAllBodiesDisabled())
+		{
+			return;
+		}
+
+		BodyStateStore *bodyStateStore = bodyManager->getBodyStateStore();
+		const unsigned int nbBodies = bodyStateStore->getNumberBodies();
+		const uint8_t *activeFlags = bodyStateStore->getActiveFlags().data();
+		const float *masses = bodyStateStore->getMasses().data();
+		const Vector3<float> *linearFactors = bodyStateStore->getLinearFactors().data();
+		Vector3<float> *totalMomentums = bodyStateStore->getTotalMomentums().data();
+
+		for(unsigned int i=0; i<nbBodies; ++i)
 		{
-			WorkRigidBody *body = WorkRigidBody::upCast(abstractBody);
-			if(body && body->isActive())
+			if(activeFlags[i])
 			{
-				body->applyCentralMomentum(gravity * body->getMass() * dt);
+				totalMomentums[i] += (gravity * masses[i] * dt) * linearFactors[i];
 			}
 		}
 	}
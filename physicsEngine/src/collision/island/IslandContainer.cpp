@@ -21,6 +21,7 @@ namespace urchin
 
 		islandElementsLink.clear();
 		islandElementsLink.resize(islandElements.size());
+		freeElementIds.clear();
 
 		for(std::size_t i=0; i<islandElements.size(); ++i)
 		{
@@ -29,9 +30,58 @@ namespace urchin
 			islandElementsLink[i].element = islandElements[i];
 			islandElementsLink[i].linkedToStaticElement = !islandElements[i]->isActive();
 			islandElementsLink[i].islandIdRef = i;
+			islandElementsLink[i].nextElementRef = i;
 		}
 	}
 
+	/**
+	 * Add an element in its own island. The ID of a removed element is reused.
+	 */
+	void IslandContainer::addElement(IslandElement *element)
+	{
+		assert(!containerSorted);
+
+		unsigned int elementId;
+		if(freeElementIds.empty())
+		{
+			elementId = islandElementsLink.size();
+			islandElementsLink.emplace_back(IslandElementLink());
+		}else
+		{
+			elementId = freeElementIds.back();
+			freeElementIds.pop_back();
+		}
+
+		element->setIslandElementId(elementId);
+
+		islandElementsLink[elementId].element = element;
+		islandElementsLink[elementId].linkedToStaticElement = false;
+		islandElementsLink[elementId].islandIdRef = elementId;
+		islandElementsLink[elementId].nextElementRef = elementId;
+		islandElementsLink[elementId].islandSize = 1;
+	}
+
+	/**
+	 * Remove an element. Island of the element is split: the others elements of the island are in their own island.
+	 */
+	void IslandContainer::removeElement(IslandElement *element)
+	{
+		assert(!containerSorted);
+		assert(hasElement(element));
+
+		unsigned int elementId = element->getIslandElementId();
+		splitIsland(findIslandId(elementId));
+
+		islandElementsLink[elementId].element = nullptr;
+		freeElementIds.push_back(elementId);
+	}
+
+	bool IslandContainer::hasElement(const IslandElement *element) const
+	{
+		unsigned int elementId = element->getIslandElementId();
+		return elementId < islandElementsLink.size() && islandElementsLink[elementId].element == element;
+	}
+
 	void IslandContainer::mergeIsland(IslandElement *element1, IslandElement *element2)
 	{
 	    assert(!containerSorted);
@@ -44,7 +94,38 @@ namespace urchin
 			return;
 		}
 
+		if(islandElementsLink[islandId1].islandSize > islandElementsLink[islandId2].islandSize)
+		{ //smallest island is attached to the biggest one to keep short references chains
+			std::swap(islandId1, islandId2);
+		}
+
 		islandElementsLink[islandId1].islandIdRef = islandId2;
+		islandElementsLink[islandId2].islandSize += islandElementsLink[islandId1].islandSize;
+		islandElementsLink[islandId2].linkedToStaticElement = islandElementsLink[islandId2].linkedToStaticElement || islandElementsLink[islandId1].linkedToStaticElement;
+
+		//join the circular lists of elements of the two islands
+		std::swap(islandElementsLink[islandId1].nextElementRef, islandElementsLink[islandId2].nextElementRef);
+	}
+
+	/**
+	 * Split the island: each element of the island is placed in its own island.
+	 */
+	void IslandContainer::splitIsland(unsigned int islandId)
+	{
+		assert(!containerSorted);
+
+		unsigned int elementId = islandId;
+		do
+		{
+			unsigned int nextElementId = islandElementsLink[elementId].nextElementRef;
+
+			islandElementsLink[elementId].islandIdRef = elementId;
+			islandElementsLink[elementId].nextElementRef = elementId;
+			islandElementsLink[elementId].islandSize = 1;
+			islandElementsLink[elementId].linkedToStaticElement = false;
+
+			elementId = nextElementId;
+		} while(elementId != islandId);
 	}
 
 	void IslandContainer::linkToStaticElement(IslandElement *element)
@@ -53,6 +134,34 @@ namespace urchin
 		islandElementsLink[islandId].linkedToStaticElement = true;
 	}
 
+	bool IslandContainer::isLinkedToStaticElement(unsigned int islandId) const
+	{
+		return islandElementsLink[islandId].linkedToStaticElement;
+	}
+
+	void IslandContainer::resetStaticElementLink(unsigned int islandId)
+	{
+		islandElementsLink[islandId].linkedToStaticElement = false;
+	}
+
+	unsigned int IslandContainer::findIslandId(const IslandElement *element) const
+	{
+		return findIslandId(element->getIslandElementId());
+	}
+
+	/**
+	 * @param islandElements [out] Elements of the island
+	 */
+	void IslandContainer::retrieveIslandElements(unsigned int islandId, std::vector<IslandElement *> &islandElements) const
+	{
+		unsigned int elementId = islandId;
+		do
+		{
+			islandElements.push_back(islandElementsLink[elementId].element);
+			elementId = islandElementsLink[elementId].nextElementRef;
+		} while(elementId != islandId);
+	}
+
 	/**
 	 * Sorts the islands by ID and returns them.
 	 * Once the islands sorted, the container is not usable anymore and need to be reset.
@@ -12,6 +12,7 @@ namespace urchin
 	* Island container. An island is a set of elements/bodies which are in contact.
 	* The island are useful to made sleep elements/bodies. If all elements/bodies of an island doesn't
 	* move: there is no need to execute collision detection checks on these island elements/bodies.
+	* The container can be rebuilt from scratch (reset) or kept across the steps (add/remove elements, merge and split islands).
 	*/
 	class IslandContainer
 	{
@@ -19,8 +20,18 @@ namespace urchin
 			IslandContainer();
 
 			void reset(const std::vector<IslandElement *> &);
+			void addElement(IslandElement *);
+			void removeElement(IslandElement *);
+			bool hasElement(const IslandElement *) const;
+
 			void mergeIsland(IslandElement *, IslandElement *);
+			void splitIsland(unsigned int);
 			void linkToStaticElement(IslandElement *);
+			bool isLinkedToStaticElement(unsigned int) const;
+			void resetStaticElementLink(unsigned int);
+
+			unsigned int findIslandId(const IslandElement *) const;
+			void retrieveIslandElements(unsigned int, std::vector<IslandElement *> &) const;
 
 			const std::vector<IslandElementLink> &retrieveSortedIslandElements();
 			unsigned int getSize() const;
@@ -29,6 +40,7 @@ namespace urchin
 			unsigned int findIslandId(unsigned int) const;
 
 			std::vector<IslandElementLink> islandElementsLink;
+			std::vector<unsigned int> freeElementIds;
 
 			bool containerSorted;
 	};
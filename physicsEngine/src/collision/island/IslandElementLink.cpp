@@ -6,6 +6,8 @@ namespace urchin
 	IslandElementLink::IslandElementLink() :
 		element(nullptr),
 		islandIdRef(0),
+		nextElementRef(0),
+		islandSize(1),
 		linkedToStaticElement(false)
 	{
 
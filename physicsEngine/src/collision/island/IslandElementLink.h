@@ -16,6 +16,8 @@ namespace urchin
 		IslandElement *element; //reference to the element
 
 		unsigned int islandIdRef; //reference to the next island element. If it references itself: it's the island id.
+		unsigned int nextElementRef; //reference to the next element of the same island (circular list of the island elements)
+		unsigned int islandSize; //number of elements in the island. Only up to date on the island id element.
 		bool linkedToStaticElement; //true if 'element' is linked to a static element.
 	};
 
@@ -1,3 +1,5 @@
+#include <algorithm>
+
 #include "collision/island/IslandManager.h"
 
 namespace urchin
@@ -6,57 +8,177 @@ namespace urchin
     //Debug parameters
     bool DEBUG_PRINT_ISLANDS = false;
 
-	IslandManager::IslandManager(const BodyManager *bodyManager) :
+	IslandManager::IslandManager(BodyManager *bodyManager) :
 		bodyManager(bodyManager),
+		stepId(0),
 		squaredLinearSleepingThreshold(ConfigService::instance()->getFloatValue("island.linearSleepingThreshold") * ConfigService::instance()->getFloatValue("island.linearSleepingThreshold")),
 		squaredAngularSleepingThreshold(ConfigService::instance()->getFloatValue("island.angularSleepingThreshold") * ConfigService::instance()->getFloatValue("island.angularSleepingThreshold"))
 	{
+		bodyManager->addObserver(this, BodyManager::ADD_WORK_BODY);
+		bodyManager->addObserver(this, BodyManager::REMOVE_WORK_BODY);
+	}
+
+	void IslandManager::notify(Observable *observable, int notificationType)
+	{
+		if(auto *bodyManager = dynamic_cast<BodyManager *>(observable))
+		{
+			if(notificationType==BodyManager::ADD_WORK_BODY)
+			{
+				addBody(bodyManager->getLastUpdatedWorkBody());
+			}else if(notificationType==BodyManager::REMOVE_WORK_BODY)
+			{
+				removeBody(bodyManager->getLastUpdatedWorkBody());
+			}
+		}
+	}
+
+	/**
+	 * Static bodies are also added in the container: a body can become static (out of world boundaries) and it stays in
+	 * its own island. Ghost bodies are not added: they are never solved and islands only contain rigid bodies.
+	 */
+	void IslandManager::addBody(AbstractWorkBody *body)
+	{
+		if(WorkRigidBody::upCast(body))
+		{
+			islandContainer.addElement(body);
+		}
+	}
+
+	void IslandManager::removeBody(AbstractWorkBody *body)
+	{
+		if(!islandContainer.hasElement(body))
+		{
+			return;
+		}
+
+		islandElements.clear();
+		islandContainer.retrieveIslandElements(islandContainer.findIslandId(body), islandElements);
+		islandContainer.removeElement(body);
+
+		for(std::size_t i = islandContacts.size(); i-- > 0;)
+		{
+			if(islandContacts[i].body1 == body || islandContacts[i].body2 == body)
+			{
+				removeContact(i);
+			}
+		}
+
+		//others elements of the island are split by the container: they must be merged again with their contacts
+		dirtyIslandElements.erase(std::remove(dirtyIslandElements.begin(), dirtyIslandElements.end(), body), dirtyIslandElements.end());
+		for(auto islandElement : islandElements)
+		{
+			if(islandElement != body)
+			{
+				dirtyIslandElements.push_back(islandElement);
+			}
+		}
+	}
+
+	/**
+	 * Refresh the islands with the contacts of the step: islands of bodies having a new contact are merged and islands
+	 * of bodies having lost a contact are split. Contacts between sleeping bodies are not computed by the narrow phase:
+	 * they are kept until one of their bodies wakes up.
+	 * @param manifoldResults Collision constraints of the step
+	 */
+	void IslandManager::refreshIslands(const std::vector<ManifoldResult> &manifoldResults)
+	{
+		ScopeProfiler profiler("physics", "refreshIslands");
+
+		stepId++;
+
+		staticLinkedBodies.clear();
+		for(const auto &manifoldResult : manifoldResults)
+		{
+			if(manifoldResult.getNumContactPoints() > 0)
+			{
+				AbstractWorkBody *body1 = manifoldResult.getBody1();
+				AbstractWorkBody *body2 = manifoldResult.getBody2();
+
+				if(!islandContainer.hasElement(body1) || !islandContainer.hasElement(body2))
+				{ //ghost bodies are not part of the islands
+					continue;
+				}
 
+				if(!body1->isStatic() && !body2->isStatic())
+				{
+					addContact(body1, body2);
+				}else if(!body1->isStatic() && body2->isStatic())
+				{
+					staticLinkedBodies.push_back(body1);
+				}else if(!body2->isStatic() && body1->isStatic())
+				{
+					staticLinkedBodies.push_back(body2);
+				}
+			}
+		}
+
+		removeLostContacts();
+		splitDirtyIslands();
+
+		for(auto staticLinkedBody : staticLinkedBodies)
+		{
+			islandContainer.linkToStaticElement(staticLinkedBody);
+		}
 	}
 
 	/**
-	 * Refresh body active state. If all bodies of an island can sleep, we set their status to inactive.
-	 * If one body of the island cannot sleep, we set their status to active.
-	 * @param overlappingPairs Overlapping pairs of broad phase used to determine the islands
+	 * Refresh body active state of the islands having at least one active body. If all bodies of an island can sleep,
+	 * we set their status to inactive. If one body of the island cannot sleep, we set their status to active.
 	 */
-	void IslandManager::refreshBodyActiveState(const std::vector<ManifoldResult> &manifoldResults)
+	void IslandManager::refreshBodyActiveState()
 	{
 		ScopeProfiler profiler("physics", "refreshBodyStat");
 
-		buildIslands(manifoldResults);
-		const std::vector<IslandElementLink> &islandElementsLink = islandContainer.retrieveSortedIslandElements();
+		if(AbstractWorkBody::areAllBodiesDisabled())
+		{
+			return;
+		}
 
-		if(DEBUG_PRINT_ISLANDS)
-        {
-		    printIslands(islandElementsLink);
-        }
+		BodyStateStore *bodyStateStore = bodyManager->getBodyStateStore();
+		const std::vector<uint8_t> &activeFlags = bodyStateStore->getActiveFlags();
+		islandIds.clear();
+		for(unsigned int i=0; i<bodyStateStore->getNumberBodies(); ++i)
+		{
+			if(activeFlags[i])
+			{
+				islandIds.push_back(islandContainer.findIslandId(bodyStateStore->getBody(i)));
+			}
+		}
+		std::sort(islandIds.begin(), islandIds.end());
+		islandIds.erase(std::unique(islandIds.begin(), islandIds.end()), islandIds.end());
 
-		unsigned int i=0;
-		while(islandElementsLink.size()>i)
+		for(unsigned int islandId : islandIds)
 		{ //loop on islands
-			unsigned int startElementIndex = i;
-			unsigned int nbElements = computeNumberElements(islandElementsLink, startElementIndex);
+			islandElements.clear();
+			islandContainer.retrieveIslandElements(islandId, islandElements);
+
+			bool islandLinkedToStaticElement = islandContainer.isLinkedToStaticElement(islandId);
+			islandContainer.resetStaticElementLink(islandId);
 
-			bool islandLinkedToStaticElement = false;
 			bool islandBodiesCanSleep = true;
-			for(unsigned int j=0; j<nbElements; ++j)
+			for(auto islandElement : islandElements)
 			{ //loop on elements of the island
-				auto *body = dynamic_cast<WorkRigidBody *>(islandElementsLink[startElementIndex+j].element);
+				auto *body = static_cast<WorkRigidBody *>(islandElement);
 				if(isBodyMoving(body))
 				{
 					islandBodiesCanSleep = false;
 					break;
 				}
 
-				islandLinkedToStaticElement = islandLinkedToStaticElement || islandElementsLink[startElementIndex+j].linkedToStaticElement;
+				islandLinkedToStaticElement = islandLinkedToStaticElement || !body->isActive(); //sleeping and static bodies are considered as static elements
 			}
 			islandBodiesCanSleep = islandBodiesCanSleep && islandLinkedToStaticElement; //one element of the island must be in contact with a static element to sleep the island
 
-			for(unsigned int j=0; j<nbElements; ++j)
+			if(DEBUG_PRINT_ISLANDS)
+			{
+				printIsland(islandElements);
+			}
+
+			for(auto islandElement : islandElements)
 			{ //loop on elements of the island
-				auto *body = dynamic_cast<WorkRigidBody *>(islandElementsLink[startElementIndex+j].element);
+				auto *body = static_cast<WorkRigidBody *>(islandElement);
 				bool bodyActiveState = !islandBodiesCanSleep;
-				if(body->isActive()!=bodyActiveState)
+				if(!body->isStatic() && body->isActive()!=bodyActiveState)
 				{
 					body->setIsActive(bodyActiveState);
 
@@ -67,59 +189,109 @@ namespace urchin
 					}
 				}
 			}
+		}
+	}
+
+	/**
+	 * @return Island ID of the body. Two bodies in contact have the same island ID.
+	 */
+	unsigned int IslandManager::getIslandId(const AbstractWorkBody *body) const
+	{
+		return islandContainer.findIslandId(body);
+	}
+
+	void IslandManager::addContact(AbstractWorkBody *body1, AbstractWorkBody *body2)
+	{
+		auto itFind = islandContactIndexes.find(computeContactKey(body1, body2));
+		if(itFind != islandContactIndexes.end())
+		{
+			islandContacts[itFind->second].lastStepId = stepId;
+		}else
+		{
+			islandContactIndexes[computeContactKey(body1, body2)] = islandContacts.size();
+			islandContacts.push_back({body1, body2, stepId});
 
-			i += nbElements;
+			islandContainer.mergeIsland(body1, body2);
 		}
 	}
 
-	void IslandManager::buildIslands(const std::vector<ManifoldResult> &manifoldResults)
+	void IslandManager::removeContact(std::size_t contactIndex)
 	{
-		//1. create an island for each body
-		islandElements.clear();
-		for (auto body : bodyManager->getWorkBodies())
+		islandContactIndexes.erase(computeContactKey(islandContacts[contactIndex].body1, islandContacts[contactIndex].body2));
+
+		if(contactIndex != islandContacts.size() - 1)
 		{
-			if(!body->isStatic())
-			{
-				islandElements.push_back(body);
-			}
+			islandContacts[contactIndex] = islandContacts.back();
+			islandContactIndexes[computeContactKey(islandContacts[contactIndex].body1, islandContacts[contactIndex].body2)] = contactIndex;
 		}
-		islandContainer.reset(islandElements);
+		islandContacts.pop_back();
+	}
 
-		//2. merge islands for bodies in contact
-		for(const auto &manifoldResult : manifoldResults)
+	/**
+	 * Remove the contacts not detected anymore. A contact is lost when one of its bodies is active (narrow phase has
+	 * processed it) and it has not been detected in this step.
+	 */
+	void IslandManager::removeLostContacts()
+	{
+		for(std::size_t i = islandContacts.size(); i-- > 0;)
 		{
-			if(manifoldResult.getNumContactPoints() > 0)
+			const IslandContact &islandContact = islandContacts[i];
+			if(islandContact.lastStepId != stepId && (islandContact.body1->isActive() || islandContact.body2->isActive()))
 			{
-				AbstractWorkBody *body1 = manifoldResult.getBody1();
-				AbstractWorkBody *body2 = manifoldResult.getBody2();
-
-				if(!body1->isStatic() && !body2->isStatic())
-				{
-					islandContainer.mergeIsland(body1, body2);
-				}else if(!body1->isStatic() && body2->isStatic())
-				{
-					islandContainer.linkToStaticElement(body1);
-				}else if(!body2->isStatic() && body1->isStatic())
-				{
-					islandContainer.linkToStaticElement(body2);
-				}
+				dirtyIslandElements.push_back(islandContact.body1);
+				removeContact(i);
 			}
 		}
 	}
 
 	/**
-	 * @return Number of element for island starting at 'startElementIndex'
+	 * Split the islands having lost a contact and merge again their elements with the remaining contacts.
 	 */
-	unsigned int IslandManager::computeNumberElements(const std::vector<IslandElementLink> &islandElementsLink, unsigned int startElementIndex) const
+	void IslandManager::splitDirtyIslands()
 	{
-		unsigned int islandId = islandElementsLink[startElementIndex].islandIdRef;
-		unsigned int endElementIndex;
+		if(dirtyIslandElements.empty())
+		{
+			return;
+		}
 
-		for(endElementIndex = startElementIndex; islandElementsLink.size()>endElementIndex && islandId==islandElementsLink[endElementIndex].islandIdRef; ++endElementIndex)
+		splitIslandElements.clear();
+		splitIslandElementFlags.resize(islandContainer.getSize(), false);
+		for(auto dirtyIslandElement : dirtyIslandElements)
 		{
+			if(!splitIslandElementFlags[dirtyIslandElement->getIslandElementId()])
+			{
+				std::size_t firstSplitElementIndex = splitIslandElements.size();
+				unsigned int islandId = islandContainer.findIslandId(dirtyIslandElement);
+				islandContainer.retrieveIslandElements(islandId, splitIslandElements);
+				for(std::size_t i = firstSplitElementIndex; i < splitIslandElements.size(); ++i)
+				{
+					splitIslandElementFlags[splitIslandElements[i]->getIslandElementId()] = true;
+				}
+
+				islandContainer.splitIsland(islandId);
+			}
 		}
+		dirtyIslandElements.clear();
 
-		return endElementIndex - startElementIndex;
+		for(const auto &islandContact : islandContacts)
+		{
+			if(splitIslandElementFlags[islandContact.body1->getIslandElementId()])
+			{ //contact bodies belong to the same island: both bodies have been split
+				islandContainer.mergeIsland(islandContact.body1, islandContact.body2);
+			}
+		}
+
+		for(auto splitIslandElement : splitIslandElements)
+		{
+			splitIslandElementFlags[splitIslandElement->getIslandElementId()] = false;
+		}
+	}
+
+	uint64_t IslandManager::computeContactKey(const AbstractWorkBody *body1, const AbstractWorkBody *body2) const
+	{
+		auto objectId1 = static_cast<uint64_t>(body1->getObjectId());
+		auto objectId2 = static_cast<uint64_t>(body2->getObjectId());
+		return (std::min(objectId1, objectId2) << 32u) | std::max(objectId1, objectId2);
 	}
 
 	bool IslandManager::isBodyMoving(const WorkRigidBody *body) const
@@ -128,25 +300,14 @@ namespace urchin
 				 && body->getAngularVelocity().squareLength() < squaredAngularSleepingThreshold);
 	}
 
-    void IslandManager::printIslands(const std::vector<IslandElementLink> &islandElementsLink)
+    void IslandManager::printIsland(const std::vector<IslandElement *> &islandElements)
     {
-        unsigned int islandId = 0;
-        unsigned int i=0;
-        while(islandElementsLink.size()>i)
-        { //loop on islands
-            unsigned int startElementIndex = i;
-            unsigned int nbElements = computeNumberElements(islandElementsLink, startElementIndex);
-
-            std::cout<<"Island "<<islandId<<":"<<std::endl;
-
-            for(unsigned int j=0; j<nbElements; ++j)
-            { //loop on elements of the island
-                auto *body = dynamic_cast<WorkRigidBody *>(islandElementsLink[startElementIndex+j].element);
-                std::cout<<"  - Body: "<<body->getId()<<" (moving: "<<isBodyMoving(body)<<", active: "<<body->isActive()<<")"<<std::endl;
-            }
-
-            i += nbElements;
-            islandId++;
+        std::cout<<"Island:"<<std::endl;
+
+        for(auto islandElement : islandElements)
+        { //loop on elements of the island
+            auto *body = static_cast<WorkRigidBody *>(islandElement);
+            std::cout<<"  - Body: "<<body->getId()<<" (moving: "<<isBodyMoving(body)<<", active: "<<body->isActive()<<")"<<std::endl;
         }
 
         std::cout<<std::endl;
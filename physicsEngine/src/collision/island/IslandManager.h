@@ -2,6 +2,9 @@
 #define URCHINENGINE_ISLANDMANAGER_H
 
 #include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include "UrchinCommon.h"
 
 #include "collision/island/IslandContainer.h"
 #include "collision/ManifoldResult.h"
@@ -11,23 +14,56 @@
 namespace urchin
 {
 
-	class IslandManager
+	/**
+	* Manager of the islands. Islands are kept across the steps: they are merged when a contact appears between two
+	* bodies and split when a contact disappears. Islands of sleeping bodies are not processed.
+	*/
+	class IslandManager : public Observer
 	{
 		public:
-			explicit IslandManager(const BodyManager *);
+			explicit IslandManager(BodyManager *);
 
-			void refreshBodyActiveState(const std::vector<ManifoldResult> &);
+			void notify(Observable *, int) override;
+
+			void refreshIslands(const std::vector<ManifoldResult> &);
+			void refreshBodyActiveState();
+
+			unsigned int getIslandId(const AbstractWorkBody *) const;
 
 		private:
-			void buildIslands(const std::vector<ManifoldResult> &);
-			unsigned int computeNumberElements(const std::vector<IslandElementLink> &, unsigned int) const;
+			struct IslandContact
+			{
+				AbstractWorkBody *body1;
+				AbstractWorkBody *body2;
+				unsigned int lastStepId; //last step where the contact has been detected
+			};
+
+			void addBody(AbstractWorkBody *);
+			void removeBody(AbstractWorkBody *);
+
+			void addContact(AbstractWorkBody *, AbstractWorkBody *);
+			void removeContact(std::size_t);
+			void removeLostContacts();
+			void splitDirtyIslands();
+
+			uint64_t computeContactKey(const AbstractWorkBody *, const AbstractWorkBody *) const;
 			bool isBodyMoving(const WorkRigidBody *) const;
 
-            void printIslands(const std::vector<IslandElementLink> &);
+            void printIsland(const std::vector<IslandElement *> &);
 
-			const BodyManager *bodyManager;
-			std::vector<IslandElement *> islandElements;
+			BodyManager *bodyManager;
 			IslandContainer islandContainer;
+			unsigned int stepId;
+
+			std::vector<IslandContact> islandContacts;
+			std::unordered_map<uint64_t, std::size_t> islandContactIndexes;
+
+			std::vector<AbstractWorkBody *> staticLinkedBodies;
+			std::vector<IslandElement *> dirtyIslandElements;
+			std::vector<IslandElement *> splitIslandElements;
+			std::vector<bool> splitIslandElementFlags;
+			std::vector<unsigned int> islandIds;
+			std::vector<IslandElement *> islandElements;
 
 			const float squaredLinearSleepingThreshold;
 			const float squaredAngularSleepingThreshold;
@@ -5,7 +5,19 @@ namespace urchin
 
 	CollisionObjectWrapper::CollisionObjectWrapper(const CollisionShape3D &shape, const PhysicsTransform &shapeWorldTransform) :
 					shape(shape),
-					shapeWorldTransform(shapeWorldTransform)
+					shapeWorldTransform(shapeWorldTransform),
+					cachedConvexObject(nullptr)
+	{
+
+	}
+
+	/**
+	 * @param cachedConvexObject Convex object of the shape in world space (can be null)
+	 */
+	CollisionObjectWrapper::CollisionObjectWrapper(const CollisionShape3D &shape, const PhysicsTransform &shapeWorldTransform, const CollisionConvexObject3D *cachedConvexObject) :
+					shape(shape),
+					shapeWorldTransform(shapeWorldTransform),
+					cachedConvexObject(cachedConvexObject)
 	{
 
 	}
@@ -20,4 +32,9 @@ namespace urchin
 		return shapeWorldTransform;
 	}
 
+	const CollisionConvexObject3D *CollisionObjectWrapper::getCachedConvexObject() const
+	{
+		return cachedConvexObject;
+	}
+
 }
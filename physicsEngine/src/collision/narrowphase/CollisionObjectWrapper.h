@@ -4,6 +4,7 @@
 #include "UrchinCommon.h"
 
 #include "shape/CollisionShape3D.h"
+#include "object/CollisionConvexObject3D.h"
 #include "utils/math/PhysicsTransform.h"
 
 namespace urchin
@@ -16,13 +17,16 @@ namespace urchin
 	{
 		public:
 			CollisionObjectWrapper(const CollisionShape3D &, const PhysicsTransform &);
+			CollisionObjectWrapper(const CollisionShape3D &, const PhysicsTransform &, const CollisionConvexObject3D *);
 
 			const CollisionShape3D &getShape() const;
 			const PhysicsTransform &getShapeWorldTransform() const;
+			const CollisionConvexObject3D *getCachedConvexObject() const;
 
 		private:
 			const CollisionShape3D &shape;
 			const PhysicsTransform &shapeWorldTransform;
+			const CollisionConvexObject3D *cachedConvexObject;
 	};
 
 }
@@ -5,6 +5,12 @@
 #include "shape/CollisionConcaveShape.h"
 #include "body/work/WorkRigidBody.h"
 #include "object/TemporalObject.h"
+#include "object/pool/CollisionConvexObjectPool.h"
+#include "collision/narrowphase/algorithm/utils/AlgorithmResultAllocator.h"
+#include "utils/property/EagerPropertyLoader.h"
+
+#define MIN_PAIRS_BY_THREAD 16
+#define MIN_RAYS_BY_THREAD 64
 
 namespace urchin
 {
@@ -13,16 +19,52 @@ namespace urchin
 			bodyManager(bodyManager),
 			broadPhaseManager(broadPhaseManager),
 			collisionAlgorithmSelector(new CollisionAlgorithmSelector()),
-			bodiesMutex(LockById::getInstance("narrowPhaseBodyIds"))
+			pairsThreadPool(nullptr)
 	{
-
+		setNumThreads(ConfigService::instance()->getUnsignedIntValue("narrowPhase.numThreads"));
 	}
 
 	NarrowPhaseManager::~NarrowPhaseManager()
 	{
+		delete pairsThreadPool;
 		delete collisionAlgorithmSelector;
 	}
 
+	/**
+	 * Define the number of threads used to process the overlapping pairs. The physics thread is included in this number.
+	 * @param numThreads Number of threads. A value of 1 disables the parallel processing and a value of 0 uses the number of hardware threads.
+	 */
+	void NarrowPhaseManager::setNumThreads(unsigned int numThreads)
+	{
+		if(numThreads == 0)
+		{
+			numThreads = std::max(1u, std::thread::hardware_concurrency());
+		}
+
+		if(numThreads != getNumThreads())
+		{
+			delete pairsThreadPool;
+			pairsThreadPool = nullptr;
+
+			if(numThreads > 1)
+			{
+				//singletons are not thread-safe: initialize them before their first use in worker threads
+				EagerPropertyLoader::instance();
+				CollisionConvexObjectPool::instance();
+				AlgorithmResultAllocator::instance();
+				Check::instance();
+
+				pairsThreadPool = new ThreadPool(numThreads);
+			}
+			threadsManifoldResults.resize(numThreads);
+		}
+	}
+
+	unsigned int NarrowPhaseManager::getNumThreads() const
+	{
+		return pairsThreadPool ? pairsThreadPool->getNumThreads() : 1;
+	}
+
 	/**
 	 * @param dt Delta of time (sec.) between two simulation steps
 	 * @param overlappingPairs Pairs of bodies potentially colliding
@@ -47,7 +89,7 @@ namespace urchin
 
         for(auto &overlappingPair : overlappingPairs)
         {
-            processOverlappingPair(&overlappingPair, manifoldResults);
+            processOverlappingPair(&overlappingPair, manifoldResults, nullptr, false);
         }
 	}
 
@@ -55,34 +97,167 @@ namespace urchin
 	{
 		ScopeProfiler profiler("physics", "procOverlapPair");
 
+		refreshCachedConvexObjects(overlappingPairs);
+
+		if(pairsThreadPool && overlappingPairs.size() >= MIN_PAIRS_BY_THREAD * 2)
+		{
+			processOverlappingPairsInParallel(overlappingPairs, manifoldResults);
+		}else
+		{
+			for(const auto &overlappingPair : overlappingPairs)
+			{
+				processOverlappingPair(overlappingPair, manifoldResults, pairsThreadPool, true);
+			}
+		}
+	}
+
+	/**
+	 * Refresh the convex objects of the bodies not moving (static or sleeping bodies) before processing the pairs: the
+	 * convex object is computed again only when the body has been moved and it is shared by all pairs of the body.
+	 */
+	void NarrowPhaseManager::refreshCachedConvexObjects(const std::vector<OverlappingPair *> &overlappingPairs)
+	{
 		for(const auto &overlappingPair : overlappingPairs)
 		{
-            processOverlappingPair(overlappingPair, manifoldResults);
+			AbstractWorkBody *body1 = overlappingPair->getBody1();
+			AbstractWorkBody *body2 = overlappingPair->getBody2();
+			if(body1->isActive() != body2->isActive())
+			{ //pairs of two sleeping bodies are not processed
+				AbstractWorkBody *notMovingBody = body1->isActive() ? body2 : body1;
+				std::lock_guard<SpinLock> lock(notMovingBody->getLock());
+				notMovingBody->refreshCachedConvexObject();
+			}
 		}
 	}
 
-	void NarrowPhaseManager::processOverlappingPair(OverlappingPair *overlappingPair, std::vector<ManifoldResult> &manifoldResults)
-    {
-        AbstractWorkBody *body1 = overlappingPair->getBody1();
-        AbstractWorkBody *body2 = overlappingPair->getBody2();
+	/**
+	 * Split the overlapping pairs in contiguous ranges processed by the threads of the pool. Each thread stores its collision
+	 * constraints in its own buffer and the buffers are merged in threads order once all the pairs are processed.
+	 */
+	void NarrowPhaseManager::processOverlappingPairsInParallel(const std::vector<OverlappingPair *> &overlappingPairs, std::vector<ManifoldResult> &manifoldResults)
+	{
+		parallelOverlappingPairs.clear();
+		serialOverlappingPairs.clear();
+		for(const auto &overlappingPair : overlappingPairs)
+		{
+			if(isParallelizable(overlappingPair))
+			{
+				parallelOverlappingPairs.push_back(overlappingPair);
+			}else
+			{
+				serialOverlappingPairs.push_back(overlappingPair);
+			}
+		}
 
-        if(body1->isActive() || body2->isActive())
-        {
-            ScopeLockById lockBody1(bodiesMutex, body1->getObjectId());
-            ScopeLockById lockBody2(bodiesMutex, body2->getObjectId());
+		auto numThreadsNeeded = static_cast<unsigned int>(parallelOverlappingPairs.size() / MIN_PAIRS_BY_THREAD);
+		pairsThreadPool->parallelFor(parallelOverlappingPairs.size(), [&](unsigned int threadIndex, std::size_t beginIndex, std::size_t endIndex) {
+			std::vector<ManifoldResult> &threadManifoldResults = threadsManifoldResults[threadIndex];
+			for(std::size_t i = beginIndex; i < endIndex; ++i)
+			{
+				processOverlappingPair(parallelOverlappingPairs[i], threadManifoldResults, nullptr, true);
+			}
+		}, numThreadsNeeded);
 
-            std::shared_ptr<CollisionAlgorithm> collisionAlgorithm = retrieveCollisionAlgorithm(overlappingPair);
+		for(auto &threadManifoldResults : threadsManifoldResults)
+		{
+			for(auto &threadManifoldResult : threadManifoldResults)
+			{
+				manifoldResults.push_back(std::move(threadManifoldResult));
+			}
+			threadManifoldResults.clear();
+		}
 
-            CollisionObjectWrapper collisionObject1(*body1->getShape(), body1->getPhysicsTransform());
-            CollisionObjectWrapper collisionObject2(*body2->getShape(), body2->getPhysicsTransform());
-            collisionAlgorithm->processCollisionAlgorithm(collisionObject1, collisionObject2, true);
+		for(const auto &overlappingPair : serialOverlappingPairs)
+		{
+			processOverlappingPair(overlappingPair, manifoldResults, pairsThreadPool, true);
+		}
+	}
 
-            if(collisionAlgorithm->getConstManifoldResult().getNumContactPoints()!=0)
-            {
-                manifoldResults.push_back(collisionAlgorithm->getConstManifoldResult());
-            }
-        }
-    }
+	/**
+	 * Pairs involving a concave shape are not processed in parallel: the concave algorithm uses caches of the shapes
+	 * (last AABBox of the other shape, triangles of the heightfield) which are not thread-safe.
+	 * Pairs of compound shapes are processed by the physics thread: their children pairs are processed in parallel by the pool.
+	 */
+	bool NarrowPhaseManager::isParallelizable(const OverlappingPair *overlappingPair) const
+	{
+		const CollisionShape3D *shape1 = overlappingPair->getBody1()->getShape();
+		const CollisionShape3D *shape2 = overlappingPair->getBody2()->getShape();
+		return !shape1->isConcave() && !shape2->isConcave()
+				&& !(shape1->getShapeType() == CollisionShape3D::COMPOUND_SHAPE && shape2->getShapeType() == CollisionShape3D::COMPOUND_SHAPE);
+	}
+
+	/**
+	 * @param threadPool Thread pool usable by the collision algorithm to process its sub-tests in parallel. Must be null
+	 * when the pair is processed by a thread of the pool or by another thread than the physics thread.
+	 * @param useCachedConvexObjects Use the cached convex objects of the bodies. Must be false when the pair is processed by
+	 * another thread than the physics thread: cached convex objects can be refreshed by the physics thread at any time.
+	 */
+	void NarrowPhaseManager::processOverlappingPair(OverlappingPair *overlappingPair, std::vector<ManifoldResult> &manifoldResults, ThreadPool *threadPool,
+			bool useCachedConvexObjects)
+	{
+		AbstractWorkBody *body1 = overlappingPair->getBody1();
+		AbstractWorkBody *body2 = overlappingPair->getBody2();
+
+		if(body1->isActive() || body2->isActive())
+		{ //bodies are always locked in same order to avoid dead lock between threads
+			bool body1First = body1->getObjectId() < body2->getObjectId();
+			std::unique_lock<SpinLock> lockFirstBody = lockBody(body1First ? body1 : body2);
+			std::unique_lock<SpinLock> lockSecondBody = lockBody(body1First ? body2 : body1);
+
+			PhysicsTransform transform1 = body1->getPhysicsTransform();
+			PhysicsTransform transform2 = body2->getPhysicsTransform();
+			const CollisionConvexObject3D *cachedConvexObject1 = useCachedConvexObjects ? body1->getCachedConvexObject() : nullptr;
+			const CollisionConvexObject3D *cachedConvexObject2 = useCachedConvexObjects ? body2->getCachedConvexObject() : nullptr;
+
+			unlockSnapshottedBody(lockSecondBody, body1First ? body2 : body1);
+			unlockSnapshottedBody(lockFirstBody, body1First ? body1 : body2);
+
+			std::shared_ptr<CollisionAlgorithm> collisionAlgorithm = retrieveCollisionAlgorithm(overlappingPair);
+
+			CollisionObjectWrapper collisionObject1(*body1->getShape(), transform1, cachedConvexObject1);
+			CollisionObjectWrapper collisionObject2(*body2->getShape(), transform2, cachedConvexObject2);
+			collisionAlgorithm->setupThreadPool(threadPool);
+			collisionAlgorithm->processCollisionAlgorithm(collisionObject1, collisionObject2, true);
+
+			if(collisionAlgorithm->getConstManifoldResult().getNumContactPoints()!=0)
+			{
+				manifoldResults.push_back(collisionAlgorithm->getConstManifoldResult());
+			}
+		}
+	}
+
+	/**
+	 * Static bodies with a convex shape are not locked: they are not moved by the simulation and their shape has no cache
+	 * modified by the collision algorithms. Other bodies are locked to take a snapshot of their transform.
+	 */
+	std::unique_lock<SpinLock> NarrowPhaseManager::lockBody(const AbstractWorkBody *body) const
+	{
+		if(body->isStatic() && !isShapeCacheModified(body))
+		{
+			return std::unique_lock<SpinLock>();
+		}
+		return std::unique_lock<SpinLock>(body->getLock());
+	}
+
+	/**
+	 * Unlock the body once its transform is snapshotted. Bodies having a shape cache modified by the collision algorithms
+	 * stay locked until the end of the collision algorithm.
+	 */
+	void NarrowPhaseManager::unlockSnapshottedBody(std::unique_lock<SpinLock> &lock, const AbstractWorkBody *body) const
+	{
+		if(lock.owns_lock() && !isShapeCacheModified(body))
+		{
+			lock.unlock();
+		}
+	}
+
+	/**
+	 * @return True when the collision algorithms modify the caches of the body shape (AABBox of compound shape, triangles of concave shape)
+	 */
+	bool NarrowPhaseManager::isShapeCacheModified(const AbstractWorkBody *body) const
+	{
+		return body->getShape()->isConcave() || body->getShape()->isCompound();
+	}
 
 	std::shared_ptr<CollisionAlgorithm> NarrowPhaseManager::retrieveCollisionAlgorithm(OverlappingPair *overlappingPair)
 	{
@@ -104,22 +279,32 @@ namespace urchin
 	{
 		ScopeProfiler profiler("physics", "proPrediContact");
 
-		for (auto workBody : bodyManager->getWorkBodies())
-		{
-			WorkRigidBody *body = WorkRigidBody::upCast(workBody);
-			if(body && body->isActive())
+		BodyStateStore *bodyStateStore = bodyManager->getBodyStateStore();
+		const std::vector<uint8_t> &activeFlags = bodyStateStore->getActiveFlags();
+		for(unsigned int i=0; i<bodyStateStore->getNumberBodies(); ++i)
+		{ //sleeping bodies are skipped without browsing all the work bodies
+			WorkRigidBody *body = bodyStateStore->getBody(i);
+			if(activeFlags[i] && body->isActive())
 			{
-                ScopeLockById lockBody(bodiesMutex, body->getObjectId());
-
-				const PhysicsTransform &currentTransform = body->getPhysicsTransform();
-				PhysicsTransform newTransform = body->getPhysicsTransform().integrate(body->getLinearVelocity(), body->getAngularVelocity(), dt);
+				PhysicsTransform currentTransform, newTransform;
+				{ //body is not locked during continuous collision test: bodies hit are locked one by one
+					std::lock_guard<SpinLock> lockBody(body->getLock());
+					currentTransform = body->getPhysicsTransform();
+					newTransform = currentTransform.integrate(body->getLinearVelocity(), body->getAngularVelocity(), dt);
+				}
 
 				float ccdMotionThreshold = body->getCcdMotionThreshold();
 				float motion = currentTransform.getPosition().vector(newTransform.getPosition()).length();
 
 				if(motion > ccdMotionThreshold)
 				{
-					handleContinuousCollision(body, currentTransform, newTransform, manifoldResults);
+					if(body->getCcdMode() == AbstractWorkBody::SPECULATIVE_CCD)
+					{
+						handleSpeculativeContacts(body, currentTransform, newTransform, manifoldResults);
+					}else
+					{
+						handleContinuousCollision(body, currentTransform, newTransform, manifoldResults);
+					}
 				}
 			}
 		}
@@ -161,82 +346,193 @@ namespace urchin
 				const Vector3<float> &normalFromObject2 = firstCCDResult->getNormalFromObject2();
 
 				ManifoldResult manifoldResult(body, firstCCDResult->getBody2());
-				manifoldResult.addContactPoint(normalFromObject2, hitPointOnObject2, depth, true);
+				manifoldResult.addContactPoint(normalFromObject2, hitPointOnObject2, depth, NO_FEATURE_ID, true);
 
 				manifoldResults.push_back(manifoldResult);
 			}
 		}
 	}
 
-	ccd_set NarrowPhaseManager::continuousCollisionTest(const TemporalObject &temporalObject1, const std::vector<AbstractWorkBody *> &bodiesAABBoxHit) const
+	/**
+	 * Add speculative contacts between the body and the bodies hit by its motion. Contrary to continuous collision (time of
+	 * impact), the closest points are computed at the current position of the bodies. The contact depth is the distance
+	 * between the bodies: constraint solver allows the body to close this distance but not more.
+	 */
+	void NarrowPhaseManager::handleSpeculativeContacts(AbstractWorkBody *body, const PhysicsTransform &from, const PhysicsTransform &to, std::vector<ManifoldResult> &manifoldResults)
 	{
-		ccd_set continuousCollisionResults;
+		std::vector<AbstractWorkBody *> bodiesAABBoxHitBody = broadPhaseManager->bodyTest(body, from, to);
+		Vector3<float> motion = from.getPosition().vector(to.getPosition());
 
-		for(auto bodyAABBoxHit : bodiesAABBoxHit)
+		for(auto bodyAABBoxHit : bodiesAABBoxHitBody)
 		{
-			ScopeLockById lockBody(bodiesMutex, bodyAABBoxHit->getObjectId());
+			ManifoldResult manifoldResult(body, bodyAABBoxHit);
 
-			const CollisionShape3D *bodyShape = bodyAABBoxHit->getShape();
+			const CollisionShape3D *bodyShape = body->getShape();
 			if(bodyShape->isCompound())
 			{
 				const auto *compoundShape = dynamic_cast<const CollisionCompoundShape *>(bodyShape);
-				const std::vector<std::shared_ptr<const LocalizedCollisionShape>> &localizedShapes = compoundShape->getLocalizedShapes();
-				for(const auto &localizedShape : localizedShapes)
+				for(const auto &localizedShape : compoundShape->getLocalizedShapes())
 				{
-					PhysicsTransform fromToObject2 = bodyAABBoxHit->getPhysicsTransform() * localizedShape->transform;
-					TemporalObject temporalObject2(localizedShape->shape.get(), fromToObject2, fromToObject2);
-
-					continuousCollisionTest(temporalObject1, temporalObject2, bodyAABBoxHit, continuousCollisionResults);
+					speculativeContactTest(*localizedShape->shape, from * localizedShape->transform, motion, bodyAABBoxHit, manifoldResult);
 				}
 			}else if(bodyShape->isConvex())
-            {
-                const PhysicsTransform &fromToObject2 = bodyAABBoxHit->getPhysicsTransform();
-                TemporalObject temporalObject2(bodyShape, fromToObject2, fromToObject2);
+			{
+				speculativeContactTest(*bodyShape, from, motion, bodyAABBoxHit, manifoldResult);
+			}else
+			{
+				throw std::invalid_argument("Unknown shape type category: " + std::to_string(bodyShape->getShapeType()));
+			}
 
-                continuousCollisionTest(temporalObject1, temporalObject2, bodyAABBoxHit, continuousCollisionResults);
-            }else if(bodyShape->isConcave())
-            {
-                const auto *concaveShape = dynamic_cast<const CollisionConcaveShape *>(bodyShape);
+			if(manifoldResult.getNumContactPoints() != 0)
+			{
+				manifoldResults.push_back(manifoldResult);
+			}
+		}
+	}
 
-                PhysicsTransform inverseTransformObject2 = bodyAABBoxHit->getPhysicsTransform().inverse();
-                AABBox<float> fromAABBoxLocalToObject1 = temporalObject1.getShape()->toAABBox(inverseTransformObject2 * temporalObject1.getFrom());
-                AABBox<float> toAABBoxLocalToObject1 = temporalObject1.getShape()->toAABBox(inverseTransformObject2 * temporalObject1.getTo());
+	/**
+	 * @param motion Motion of the convex shape during the step
+	 * @param manifoldResult [OUT] Speculative contacts are added in the manifold result
+	 */
+	void NarrowPhaseManager::speculativeContactTest(const CollisionShape3D &convexShape, const PhysicsTransform &convexTransform, const Vector3<float> &motion,
+			AbstractWorkBody *bodyAABBoxHit, ManifoldResult &manifoldResult) const
+	{
+		std::lock_guard<SpinLock> lockBody(bodyAABBoxHit->getLock());
 
-                if(temporalObject1.isRay())
-                {
-                    LineSegment3D<float> ray(fromAABBoxLocalToObject1.getMin(), toAABBoxLocalToObject1.getMin());
-                    const std::vector<CollisionTriangleShape> &triangles = concaveShape->findTrianglesHitByRay(ray);
+		const CollisionShape3D *bodyShape = bodyAABBoxHit->getShape();
+		const PhysicsTransform &transformObject2 = bodyAABBoxHit->getPhysicsTransform();
+		if(bodyShape->isCompound())
+		{
+			const auto *compoundShape = dynamic_cast<const CollisionCompoundShape *>(bodyShape);
+			for(const auto &localizedShape : compoundShape->getLocalizedShapes())
+			{
+				speculativeContactTest(convexShape, convexTransform, motion, *localizedShape->shape, transformObject2 * localizedShape->transform, manifoldResult);
+			}
+		}else if(bodyShape->isConvex())
+		{
+			speculativeContactTest(convexShape, convexTransform, motion, *bodyShape, transformObject2, manifoldResult);
+		}else if(bodyShape->isConcave())
+		{
+			const auto *concaveShape = dynamic_cast<const CollisionConcaveShape *>(bodyShape);
+
+			PhysicsTransform inverseTransformObject2 = transformObject2.inverse();
+			AABBox<float> fromAABBoxLocalToObject1 = convexShape.toAABBox(inverseTransformObject2 * convexTransform);
+			PhysicsTransform convexToTransform(convexTransform.getPosition().translate(motion), convexTransform.getOrientation());
+			AABBox<float> toAABBoxLocalToObject1 = convexShape.toAABBox(inverseTransformObject2 * convexToTransform);
+
+			FunctionTriangleVisitor triangleVisitor([&](const CollisionTriangleShape &triangle) {
+				speculativeContactTest(convexShape, convexTransform, motion, triangle, transformObject2, manifoldResult);
+			});
+			concaveShape->findTrianglesInAABBox(fromAABBoxLocalToObject1.merge(toAABBoxLocalToObject1), triangleVisitor);
+		}else
+		{
+			throw std::invalid_argument("Unknown shape type category: " + std::to_string(bodyShape->getShapeType()));
+		}
+	}
 
-                    trianglesContinuousCollisionTest(triangles, temporalObject1, bodyAABBoxHit, continuousCollisionResults);
-                }else
-                {
-                    AABBox<float> temporalAABBoxLocalToObject1 = fromAABBoxLocalToObject1.merge(toAABBoxLocalToObject1);
-                    const std::vector<CollisionTriangleShape> &triangles = concaveShape->findTrianglesInAABBox(temporalAABBoxLocalToObject1);
+	/**
+	 * Add a speculative contact when the motion of the first shape along the contact normal is greater than the distance
+	 * between the shapes. Shapes already in contact are ignored: their contact points are computed by the collision algorithms.
+	 * @param manifoldResult [OUT] Speculative contact is added in the manifold result
+	 */
+	void NarrowPhaseManager::speculativeContactTest(const CollisionShape3D &convexShape1, const PhysicsTransform &transform1, const Vector3<float> &motion,
+			const CollisionShape3D &convexShape2, const PhysicsTransform &transform2, ManifoldResult &manifoldResult) const
+	{
+		std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> convexObject1 = convexShape1.toConvexObject(transform1);
+		std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> convexObject2 = convexShape2.toConvexObject(transform2);
 
-                    trianglesContinuousCollisionTest(triangles, temporalObject1, bodyAABBoxHit, continuousCollisionResults);
-                }
-			}else
+		std::unique_ptr<GJKResult<double>, AlgorithmResultDeleter> gjkResultWithoutMargin = gjkAlgorithm.processGJK(*convexObject1, *convexObject2, false);
+		if(gjkResultWithoutMargin->isValidResult() && !gjkResultWithoutMargin->isCollide())
+		{
+			Vector3<double> vectorBA = gjkResultWithoutMargin->getClosestPointB().vector(gjkResultWithoutMargin->getClosestPointA());
+			auto vectorBALength = (float)vectorBA.length();
+			float distance = vectorBALength - (convexObject1->getOuterMargin() + convexObject2->getOuterMargin());
+			if(vectorBALength > 0.0f && distance > 0.0f)
 			{
-                throw std::invalid_argument("Unknown shape type category: " + std::to_string(bodyShape->getShapeType()));
+				Vector3<float> normalFromObject2 = vectorBA.normalize().cast<float>();
+				if(motion.dotProduct(-normalFromObject2) > distance)
+				{ //shape 1 goes through the shape 2 during the step
+					Point3<float> pointOnObject2 = gjkResultWithoutMargin->getClosestPointB().cast<float>().translate(normalFromObject2 * convexObject2->getOuterMargin());
+					manifoldResult.addContactPoint(normalFromObject2, pointOnObject2, distance, NO_FEATURE_ID, true);
+				}
 			}
 		}
+	}
+
+	ccd_set NarrowPhaseManager::continuousCollisionTest(const TemporalObject &temporalObject1, const std::vector<AbstractWorkBody *> &bodiesAABBoxHit) const
+	{
+		ccd_set continuousCollisionResults;
+
+		for(auto bodyAABBoxHit : bodiesAABBoxHit)
+		{
+			continuousCollisionTest(temporalObject1, bodyAABBoxHit, continuousCollisionResults);
+		}
 
 		return continuousCollisionResults;
 	}
 
+	/**
+	 * @param continuousCollisionResults [OUT] In case of collision detected: continuous collision result will be updated with collision details
+	 */
+	void NarrowPhaseManager::continuousCollisionTest(const TemporalObject &temporalObject1, AbstractWorkBody *bodyAABBoxHit, ccd_set &continuousCollisionResults) const
+	{
+		std::lock_guard<SpinLock> lockBody(bodyAABBoxHit->getLock());
+
+		const CollisionShape3D *bodyShape = bodyAABBoxHit->getShape();
+		if(bodyShape->isCompound())
+		{
+			const auto *compoundShape = dynamic_cast<const CollisionCompoundShape *>(bodyShape);
+			const std::vector<std::shared_ptr<const LocalizedCollisionShape>> &localizedShapes = compoundShape->getLocalizedShapes();
+			for(const auto &localizedShape : localizedShapes)
+			{
+				PhysicsTransform fromToObject2 = bodyAABBoxHit->getPhysicsTransform() * localizedShape->transform;
+				TemporalObject temporalObject2(localizedShape->shape.get(), fromToObject2, fromToObject2);
+
+				continuousCollisionTest(temporalObject1, temporalObject2, bodyAABBoxHit, continuousCollisionResults);
+			}
+		}else if(bodyShape->isConvex())
+        {
+            const PhysicsTransform &fromToObject2 = bodyAABBoxHit->getPhysicsTransform();
+            TemporalObject temporalObject2(bodyShape, fromToObject2, fromToObject2);
+
+            continuousCollisionTest(temporalObject1, temporalObject2, bodyAABBoxHit, continuousCollisionResults);
+        }else if(bodyShape->isConcave())
+        {
+            const auto *concaveShape = dynamic_cast<const CollisionConcaveShape *>(bodyShape);
+
+            PhysicsTransform inverseTransformObject2 = bodyAABBoxHit->getPhysicsTransform().inverse();
+            AABBox<float> fromAABBoxLocalToObject1 = temporalObject1.getShape()->toAABBox(inverseTransformObject2 * temporalObject1.getFrom());
+            AABBox<float> toAABBoxLocalToObject1 = temporalObject1.getShape()->toAABBox(inverseTransformObject2 * temporalObject1.getTo());
+
+            FunctionTriangleVisitor triangleVisitor([&](const CollisionTriangleShape &triangle) {
+                triangleContinuousCollisionTest(triangle, temporalObject1, bodyAABBoxHit, continuousCollisionResults);
+            });
+
+            if(temporalObject1.isRay())
+            {
+                LineSegment3D<float> ray(fromAABBoxLocalToObject1.getMin(), toAABBoxLocalToObject1.getMin());
+                concaveShape->findTrianglesHitByRay(ray, triangleVisitor);
+            }else
+            {
+                AABBox<float> temporalAABBoxLocalToObject1 = fromAABBoxLocalToObject1.merge(toAABBoxLocalToObject1);
+                concaveShape->findTrianglesInAABBox(temporalAABBoxLocalToObject1, triangleVisitor);
+            }
+		}else
+		{
+            throw std::invalid_argument("Unknown shape type category: " + std::to_string(bodyShape->getShapeType()));
+		}
+	}
+
     /**
      * @param continuousCollisionResults [OUT] In case of collision detected: continuous collision result will be updated with collision details
      */
-	void NarrowPhaseManager::trianglesContinuousCollisionTest(const std::vector<CollisionTriangleShape> &triangles, const TemporalObject &temporalObject1,
+	void NarrowPhaseManager::triangleContinuousCollisionTest(const CollisionTriangleShape &triangle, const TemporalObject &temporalObject1,
 	        AbstractWorkBody *body2, ccd_set &continuousCollisionResults) const
     {
-        for(const auto &triangle : triangles)
-        {
-            const PhysicsTransform &fromToObject2 = body2->getPhysicsTransform();
-            TemporalObject temporalObject2(&triangle, fromToObject2, fromToObject2);
+        const PhysicsTransform &fromToObject2 = body2->getPhysicsTransform();
+        TemporalObject temporalObject2(&triangle, fromToObject2, fromToObject2);
 
-            continuousCollisionTest(temporalObject1, temporalObject2, body2, continuousCollisionResults);
-        }
+        continuousCollisionTest(temporalObject1, temporalObject2, body2, continuousCollisionResults);
     }
 
 	/**
@@ -264,4 +560,47 @@ namespace urchin
 		return continuousCollisionTest(rayCastObject, bodiesAABBoxHitRay);
 	}
 
+	/**
+	 * Process the narrow phase of a batch of rays. Rays are dispatched on the threads of the pool when the batch is big enough.
+	 * @param bodiesOffsets Bodies of ray 'i' are stored between indices bodiesOffsets[i] (inclusive) and bodiesOffsets[i+1] (exclusive)
+	 * @param bodiesAABBoxHitRays Bodies AABBox hit by the rays, grouped by ray
+	 * @param nearestResults [OUT] Nearest hit of each ray. A ray without hit has a result without body.
+	 */
+	void NarrowPhaseManager::rayBatchTest(const std::vector<Ray<float>> &rays, const std::vector<std::size_t> &bodiesOffsets,
+			const std::vector<AbstractWorkBody *> &bodiesAABBoxHitRays, std::vector<ContinuousCollisionResult<float>> &nearestResults) const
+	{
+		nearestResults.assign(rays.size(), ContinuousCollisionResult<float>(nullptr, Vector3<float>(), Point3<float>(), 1.0f));
+
+		auto rangeRayTest = [&](unsigned int, std::size_t beginIndex, std::size_t endIndex) {
+			CollisionSphereShape pointShape(0.0f);
+			ccd_set rayCastResults;
+			for(std::size_t rayIndex = beginIndex; rayIndex < endIndex; ++rayIndex)
+			{
+				PhysicsTransform from = PhysicsTransform(rays[rayIndex].getOrigin());
+				PhysicsTransform to = PhysicsTransform(rays[rayIndex].computeTo());
+				TemporalObject rayCastObject(&pointShape, from, to);
+
+				for(std::size_t i = bodiesOffsets[rayIndex]; i < bodiesOffsets[rayIndex + 1]; ++i)
+				{
+					continuousCollisionTest(rayCastObject, bodiesAABBoxHitRays[i], rayCastResults);
+				}
+
+				if(!rayCastResults.empty())
+				{
+					nearestResults[rayIndex] = **rayCastResults.begin();
+					rayCastResults.clear();
+				}
+			}
+		};
+
+		if(pairsThreadPool && rays.size() >= MIN_RAYS_BY_THREAD * 2)
+		{
+			auto numThreadsNeeded = static_cast<unsigned int>(rays.size() / MIN_RAYS_BY_THREAD);
+			pairsThreadPool->parallelFor(rays.size(), rangeRayTest, numThreadsNeeded);
+		}else
+		{
+			rangeRayTest(0, 0, rays.size());
+		}
+	}
+
 }
@@ -11,6 +11,7 @@
 #include "collision/narrowphase/algorithm/CollisionAlgorithm.h"
 #include "collision/narrowphase/algorithm/CollisionAlgorithmSelector.h"
 #include "collision/narrowphase/algorithm/continuous/GJKContinuousCollisionAlgorithm.h"
+#include "collision/narrowphase/algorithm/gjk/GJKAlgorithm.h"
 #include "collision/narrowphase/algorithm/continuous/result/ContinuousCollisionResult.h"
 #include "collision/broadphase/BroadPhaseManager.h"
 #include "body/BodyManager.h"
@@ -27,20 +28,36 @@ namespace urchin
 			NarrowPhaseManager(const BodyManager *, const BroadPhaseManager *);
 			~NarrowPhaseManager();
 
+			void setNumThreads(unsigned int);
+			unsigned int getNumThreads() const;
+
 			void process(float, const std::vector<OverlappingPair *> &, std::vector<ManifoldResult> &);
 			void processGhostBody(WorkGhostBody *, std::vector<ManifoldResult> &);
 
 			ccd_set continuousCollisionTest(const TemporalObject &,  const std::vector<AbstractWorkBody *> &) const;
 			ccd_set rayTest(const Ray<float> &, const std::vector<AbstractWorkBody *> &) const;
+			void rayBatchTest(const std::vector<Ray<float>> &, const std::vector<std::size_t> &, const std::vector<AbstractWorkBody *> &,
+					std::vector<ContinuousCollisionResult<float>> &) const;
 
 		private:
 			void processOverlappingPairs(const std::vector<OverlappingPair *> &, std::vector<ManifoldResult> &);
-			void processOverlappingPair(OverlappingPair *, std::vector<ManifoldResult> &);
+			void refreshCachedConvexObjects(const std::vector<OverlappingPair *> &);
+			void processOverlappingPairsInParallel(const std::vector<OverlappingPair *> &, std::vector<ManifoldResult> &);
+			bool isParallelizable(const OverlappingPair *) const;
+			void processOverlappingPair(OverlappingPair *, std::vector<ManifoldResult> &, ThreadPool *, bool);
+			std::unique_lock<SpinLock> lockBody(const AbstractWorkBody *) const;
+			void unlockSnapshottedBody(std::unique_lock<SpinLock> &, const AbstractWorkBody *) const;
+			bool isShapeCacheModified(const AbstractWorkBody *) const;
 			std::shared_ptr<CollisionAlgorithm> retrieveCollisionAlgorithm(OverlappingPair *);
 
 			void processPredictiveContacts(float, std::vector<ManifoldResult> &);
 			void handleContinuousCollision(AbstractWorkBody *, const PhysicsTransform &, const PhysicsTransform &, std::vector<ManifoldResult> &);
-			void trianglesContinuousCollisionTest(const std::vector<CollisionTriangleShape> &, const TemporalObject &, AbstractWorkBody *, ccd_set &) const;
+			void handleSpeculativeContacts(AbstractWorkBody *, const PhysicsTransform &, const PhysicsTransform &, std::vector<ManifoldResult> &);
+			void speculativeContactTest(const CollisionShape3D &, const PhysicsTransform &, const Vector3<float> &, AbstractWorkBody *, ManifoldResult &) const;
+			void speculativeContactTest(const CollisionShape3D &, const PhysicsTransform &, const Vector3<float> &, const CollisionShape3D &,
+					const PhysicsTransform &, ManifoldResult &) const;
+			void continuousCollisionTest(const TemporalObject &, AbstractWorkBody *, ccd_set &) const;
+			void triangleContinuousCollisionTest(const CollisionTriangleShape &, const TemporalObject &, AbstractWorkBody *, ccd_set &) const;
 			void continuousCollisionTest(const TemporalObject &, const TemporalObject &, AbstractWorkBody *, ccd_set &) const;
 
 			const BodyManager *bodyManager;
@@ -48,8 +65,12 @@ namespace urchin
 
 			CollisionAlgorithmSelector *const collisionAlgorithmSelector;
 			const GJKContinuousCollisionAlgorithm<double, float> gjkContinuousCollisionAlgorithm;
+			const GJKAlgorithm<double> gjkAlgorithm;
 
-			std::shared_ptr<LockById> bodiesMutex;
+			ThreadPool *pairsThreadPool;
+			std::vector<OverlappingPair *> parallelOverlappingPairs;
+			std::vector<OverlappingPair *> serialOverlappingPairs;
+			std::vector<std::vector<ManifoldResult>> threadsManifoldResults;
 	};
 
 }
@@ -7,7 +7,8 @@ namespace urchin
 	CollisionAlgorithm::CollisionAlgorithm(bool objectSwapped, ManifoldResult &&manifoldResult) :
 			objectSwapped(objectSwapped),
             manifoldResult(std::move(manifoldResult)),
-            collisionAlgorithmSelector(nullptr)
+            collisionAlgorithmSelector(nullptr),
+            threadPool(nullptr)
 	{
 
 	}
@@ -17,6 +18,15 @@ namespace urchin
 	    this->collisionAlgorithmSelector = collisionAlgorithmSelector;
     }
 
+    /**
+     * @param threadPool Thread pool usable to process the sub-tests of the algorithm in parallel. Must be null when the
+     * algorithm is processed by a thread of the pool or by a thread which doesn't own the pool.
+     */
+    void CollisionAlgorithm::setupThreadPool(ThreadPool *threadPool)
+    {
+        this->threadPool = threadPool;
+    }
+
 	void CollisionAlgorithm::processCollisionAlgorithm(const CollisionObjectWrapper &object1, const CollisionObjectWrapper &object2, bool refreshContractPoints)
 	{
 		if(objectSwapped)
@@ -48,6 +58,11 @@ namespace urchin
 		return collisionAlgorithmSelector;
 	}
 
+	ThreadPool *CollisionAlgorithm::getThreadPool() const
+	{
+		return threadPool;
+	}
+
 	ManifoldResult &CollisionAlgorithm::getManifoldResult()
 	{
 		return manifoldResult;
@@ -56,10 +71,21 @@ namespace urchin
 	/**
 	 * @param normalFromObject2 Contact normal from object 2. The normal direction should be toward the object 1.
 	 * @param depth Penetration depth (negative when collision exist)
+	 * @param featureId Identifier of the shapes features in contact. Identifier must be stable across the frames for the same features.
+	 */
+	void CollisionAlgorithm::addNewContactPoint(const Vector3<float> &normalFromObject2, const Point3<float> &pointOnObject2, float depth, unsigned int featureId)
+	{
+		manifoldResult.addContactPoint(normalFromObject2, pointOnObject2, depth, featureId, false);
+	}
+
+	/**
+	 * @return Feature ID combining two feature IDs (e.g.: feature ID of a sub-shape and index of the sub-shape). Returned
+	 * value is never NO_FEATURE_ID.
 	 */
-	void CollisionAlgorithm::addNewContactPoint(const Vector3<float> &normalFromObject2, const Point3<float> &pointOnObject2, float depth)
+	unsigned int CollisionAlgorithm::combineFeatureIds(unsigned int featureId1, unsigned int featureId2)
 	{
-		manifoldResult.addContactPoint(normalFromObject2, pointOnObject2, depth, false);
+		unsigned int featureId = featureId1 ^ (featureId2 + 0x9e3779b9u + (featureId1 << 6u) + (featureId1 >> 2u));
+		return featureId == NO_FEATURE_ID ? featureId + 1 : featureId;
 	}
 
 	void CollisionAlgorithm::refreshContactPoints()
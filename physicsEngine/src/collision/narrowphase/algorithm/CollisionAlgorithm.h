@@ -1,6 +1,8 @@
 #ifndef URCHINENGINE_COLLISIONALGORITHM_H
 #define URCHINENGINE_COLLISIONALGORITHM_H
 
+#include "UrchinCommon.h"
+
 #include "collision/ManifoldResult.h"
 #include "collision/narrowphase/CollisionObjectWrapper.h"
 
@@ -16,6 +18,7 @@ namespace urchin
 			virtual ~CollisionAlgorithm() = default;
 
 			void setupCollisionAlgorithmSelector(const CollisionAlgorithmSelector *);
+			void setupThreadPool(ThreadPool *);
 
 			void processCollisionAlgorithm(const CollisionObjectWrapper &, const CollisionObjectWrapper &, bool);
 
@@ -26,9 +29,11 @@ namespace urchin
 			virtual void doProcessCollisionAlgorithm(const CollisionObjectWrapper &, const CollisionObjectWrapper &) = 0;
 
             const CollisionAlgorithmSelector *getCollisionAlgorithmSelector() const;
+            ThreadPool *getThreadPool() const;
 
 			ManifoldResult &getManifoldResult();
-			void addNewContactPoint(const Vector3<float> &, const Point3<float> &, float);
+			void addNewContactPoint(const Vector3<float> &, const Point3<float> &, float, unsigned int);
+			static unsigned int combineFeatureIds(unsigned int, unsigned int);
             float getContactBreakingThreshold() const;
 
 		private:
@@ -38,6 +43,7 @@ namespace urchin
 			ManifoldResult manifoldResult;
 
 			const CollisionAlgorithmSelector *collisionAlgorithmSelector;
+			ThreadPool *threadPool;
 	};
 
 }
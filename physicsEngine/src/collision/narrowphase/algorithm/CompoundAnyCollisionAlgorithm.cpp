@@ -1,7 +1,10 @@
+#include <algorithm>
+
 #include "collision/narrowphase/algorithm/CompoundAnyCollisionAlgorithm.h"
-#include "shape/CollisionCompoundShape.h"
 #include "shape/CollisionShape3D.h"
 
+#define MIN_CHILD_PAIRS_BY_THREAD 16
+
 namespace urchin
 {
 
@@ -11,6 +14,10 @@ namespace urchin
 
 	}
 
+	/**
+	 * Only the children of the compound shape colliding with the box of the other shape are tested. The children boxes are
+	 * retrieved from the hierarchy of the compound shape.
+	 */
 	void CompoundAnyCollisionAlgorithm::doProcessCollisionAlgorithm(const CollisionObjectWrapper &object1, const CollisionObjectWrapper &object2)
 	{
 		ScopeProfiler profiler("physics", "algCompoundAny");
@@ -18,12 +25,33 @@ namespace urchin
 		const auto &compoundShape = dynamic_cast<const CollisionCompoundShape &>(object1.getShape());
 		const CollisionShape3D &otherShape = object2.getShape();
 
+		if(otherShape.getShapeType() == CollisionShape3D::COMPOUND_SHAPE)
+		{
+			processCompoundCompoundCollision(object1, object2);
+			return;
+		}
+
 		AbstractWorkBody *body1 = getManifoldResult().getBody1();
 		AbstractWorkBody *body2 = getManifoldResult().getBody2();
 
 		const std::vector<std::shared_ptr<const LocalizedCollisionShape>> &localizedShapes = compoundShape.getLocalizedShapes();
-		for (const auto &localizedShape : localizedShapes)
+		childIndices.clear();
+		if(otherShape.isConcave())
+		{ //concave shapes are large: no culling
+			for(std::size_t i = 0; i < localizedShapes.size(); ++i)
+			{
+				childIndices.push_back(i);
+			}
+		}else
 		{
+			PhysicsTransform otherLocalTransform = object1.getShapeWorldTransform().inverse() * object2.getShapeWorldTransform();
+			AABBox<float> otherLocalAABBox = computeLocalAABBox(otherShape, otherLocalTransform);
+			compoundShape.getChildrenBVH().aabboxQuery(otherLocalAABBox.enlarge(getContactBreakingThreshold(), getContactBreakingThreshold()), childIndices);
+		}
+
+		for (std::size_t childIndex : childIndices)
+		{
+			const std::shared_ptr<const LocalizedCollisionShape> &localizedShape = localizedShapes[childIndex];
 			std::shared_ptr<CollisionAlgorithm> collisionAlgorithm = getCollisionAlgorithmSelector()->createCollisionAlgorithm(
 					body1, localizedShape->shape.get(), body2, &otherShape);
 
@@ -34,15 +62,106 @@ namespace urchin
 			collisionAlgorithm->processCollisionAlgorithm(subObject1, subObject2, false);
 
 			const ManifoldResult &algorithmManifoldResult = collisionAlgorithm->getConstManifoldResult();
-			addContactPointsToManifold(algorithmManifoldResult, collisionAlgorithm->isObjectSwapped());
+			addContactPointsToManifold(algorithmManifoldResult, collisionAlgorithm->isObjectSwapped(), static_cast<unsigned int>(localizedShape->position));
+		}
+	}
+
+	/**
+	 * The children pairs are collected with the hierarchy of the first compound shape and they are processed in parallel
+	 * when a thread pool is available and the pairs are numerous. Contact points are added in pairs order: the result is
+	 * independent of the number of threads.
+	 */
+	void CompoundAnyCollisionAlgorithm::processCompoundCompoundCollision(const CollisionObjectWrapper &object1, const CollisionObjectWrapper &object2)
+	{
+		const auto &compoundShape1 = dynamic_cast<const CollisionCompoundShape &>(object1.getShape());
+		const auto &compoundShape2 = dynamic_cast<const CollisionCompoundShape &>(object2.getShape());
+
+		Transform<float> compound2LocalTransform = (object1.getShapeWorldTransform().inverse() * object2.getShapeWorldTransform()).toTransform();
+		childPairs.clear();
+		for(std::size_t childIndex2 = 0; childIndex2 < compoundShape2.getLocalizedShapes().size(); ++childIndex2)
+		{
+			AABBox<float> child2LocalAABBox = compoundShape2.getChildrenBVH().getChildAABBox(childIndex2).moveAABBox(compound2LocalTransform);
+
+			childIndices.clear();
+			compoundShape1.getChildrenBVH().aabboxQuery(child2LocalAABBox.enlarge(getContactBreakingThreshold(), getContactBreakingThreshold()), childIndices);
+			for(std::size_t childIndex1 : childIndices)
+			{
+				childPairs.emplace_back(childIndex1, childIndex2);
+			}
 		}
+		std::sort(childPairs.begin(), childPairs.end());
+
+		childPairAlgorithms.resize(childPairs.size());
+		ThreadPool *threadPool = getThreadPool();
+		if(threadPool && childPairs.size() >= MIN_CHILD_PAIRS_BY_THREAD * 2)
+		{
+			auto numThreadsNeeded = static_cast<unsigned int>(childPairs.size() / MIN_CHILD_PAIRS_BY_THREAD);
+			threadPool->parallelFor(childPairs.size(), [&](unsigned int, std::size_t beginIndex, std::size_t endIndex) {
+				processChildPairs(beginIndex, endIndex, compoundShape1, object1, compoundShape2, object2);
+			}, numThreadsNeeded);
+		}else
+		{
+			processChildPairs(0, childPairs.size(), compoundShape1, object1, compoundShape2, object2);
+		}
+
+		for(std::size_t i = 0; i < childPairs.size(); ++i)
+		{
+			unsigned int subShapeId = combineFeatureIds(static_cast<unsigned int>(compoundShape1.getLocalizedShapes()[childPairs[i].first]->position),
+					static_cast<unsigned int>(compoundShape2.getLocalizedShapes()[childPairs[i].second]->position));
+			addContactPointsToManifold(childPairAlgorithms[i]->getConstManifoldResult(), childPairAlgorithms[i]->isObjectSwapped(), subShapeId);
+		}
+		childPairAlgorithms.clear();
+	}
+
+	/**
+	 * Process the children pairs [beginIndex, endIndex[. This method can be called by several threads on distinct ranges.
+	 */
+	void CompoundAnyCollisionAlgorithm::processChildPairs(std::size_t beginIndex, std::size_t endIndex, const CollisionCompoundShape &compoundShape1,
+			const CollisionObjectWrapper &object1, const CollisionCompoundShape &compoundShape2, const CollisionObjectWrapper &object2)
+	{
+		AbstractWorkBody *body1 = getManifoldResult().getBody1();
+		AbstractWorkBody *body2 = getManifoldResult().getBody2();
+
+		for(std::size_t i = beginIndex; i < endIndex; ++i)
+		{
+			const std::shared_ptr<const LocalizedCollisionShape> &localizedShape1 = compoundShape1.getLocalizedShapes()[childPairs[i].first];
+			const std::shared_ptr<const LocalizedCollisionShape> &localizedShape2 = compoundShape2.getLocalizedShapes()[childPairs[i].second];
+
+			std::shared_ptr<CollisionAlgorithm> collisionAlgorithm = getCollisionAlgorithmSelector()->createCollisionAlgorithm(
+					body1, localizedShape1->shape.get(), body2, localizedShape2->shape.get());
+
+			CollisionObjectWrapper subObject1(*localizedShape1->shape, object1.getShapeWorldTransform() * localizedShape1->transform);
+			CollisionObjectWrapper subObject2(*localizedShape2->shape, object2.getShapeWorldTransform() * localizedShape2->transform);
+			collisionAlgorithm->processCollisionAlgorithm(subObject1, subObject2, false);
+
+			childPairAlgorithms[i] = std::move(collisionAlgorithm);
+		}
+	}
+
+	/**
+	 * @return Box of the convex shape in compound local space. The box is computed with the support points of the shape:
+	 * contrary to CollisionShape3D::toAABBox, no cache of the shape is updated and the method can be called by several threads.
+	 */
+	AABBox<float> CompoundAnyCollisionAlgorithm::computeLocalAABBox(const CollisionShape3D &shape, const PhysicsTransform &localTransform) const
+	{
+		std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> convexObject = shape.toConvexObject(localTransform);
+
+		Point3<float> min(convexObject->getSupportPoint(Vector3<float>(-1.0f, 0.0f, 0.0f), true).X,
+				convexObject->getSupportPoint(Vector3<float>(0.0f, -1.0f, 0.0f), true).Y,
+				convexObject->getSupportPoint(Vector3<float>(0.0f, 0.0f, -1.0f), true).Z);
+		Point3<float> max(convexObject->getSupportPoint(Vector3<float>(1.0f, 0.0f, 0.0f), true).X,
+				convexObject->getSupportPoint(Vector3<float>(0.0f, 1.0f, 0.0f), true).Y,
+				convexObject->getSupportPoint(Vector3<float>(0.0f, 0.0f, 1.0f), true).Z);
+		return AABBox<float>(min, max);
 	}
 
-	void CompoundAnyCollisionAlgorithm::addContactPointsToManifold(const ManifoldResult &manifoldResult, bool manifoldSwapped)
+	void CompoundAnyCollisionAlgorithm::addContactPointsToManifold(const ManifoldResult &manifoldResult, bool manifoldSwapped, unsigned int subShapeId)
 	{
 		for(unsigned int i=0; i<manifoldResult.getNumContactPoints(); ++i)
 		{
 			const ManifoldContactPoint &manifoldContactPoint = manifoldResult.getManifoldContactPoint(i);
+			unsigned int featureId = manifoldContactPoint.getFeatureId() == NO_FEATURE_ID ? NO_FEATURE_ID
+					: combineFeatureIds(subShapeId, manifoldContactPoint.getFeatureId()); //features of sub-shapes must be distinct
 			if(manifoldSwapped)
 			{
 				getManifoldResult().addContactPoint(
@@ -52,6 +171,7 @@ namespace urchin
 						manifoldContactPoint.getLocalPointOnObject2(),
 						manifoldContactPoint.getLocalPointOnObject1(),
 						manifoldContactPoint.getDepth(),
+						featureId,
 						manifoldContactPoint.isPredictive());
 			}else
 			{
@@ -62,6 +182,7 @@ namespace urchin
 						manifoldContactPoint.getLocalPointOnObject1(),
 						manifoldContactPoint.getLocalPointOnObject2(),
 						manifoldContactPoint.getDepth(),
+						featureId,
 						manifoldContactPoint.isPredictive());
 			}
 		}
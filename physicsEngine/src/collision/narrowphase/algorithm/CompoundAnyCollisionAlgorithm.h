@@ -1,11 +1,16 @@
 #ifndef URCHINENGINE_COMPOUNDANYCOLLISIONALGORITHM_H
 #define URCHINENGINE_COMPOUNDANYCOLLISIONALGORITHM_H
 
+#include <vector>
+#include <memory>
+#include <utility>
+
 #include "collision/narrowphase/algorithm/CollisionAlgorithm.h"
 #include "collision/narrowphase/algorithm/CollisionAlgorithmBuilder.h"
 #include "collision/narrowphase/algorithm/CollisionAlgorithmSelector.h"
 #include "collision/ManifoldResult.h"
 #include "collision/narrowphase/CollisionObjectWrapper.h"
+#include "shape/CollisionCompoundShape.h"
 
 namespace urchin
 {
@@ -27,7 +32,16 @@ namespace urchin
 			};
 
 		private:
-			void addContactPointsToManifold(const ManifoldResult &, bool);
+			void processCompoundCompoundCollision(const CollisionObjectWrapper &, const CollisionObjectWrapper &);
+			void processChildPairs(std::size_t, std::size_t, const CollisionCompoundShape &, const CollisionObjectWrapper &,
+					const CollisionCompoundShape &, const CollisionObjectWrapper &);
+			AABBox<float> computeLocalAABBox(const CollisionShape3D &, const PhysicsTransform &) const;
+
+			void addContactPointsToManifold(const ManifoldResult &, bool, unsigned int);
+
+			std::vector<std::size_t> childIndices;
+			std::vector<std::pair<std::size_t, std::size_t>> childPairs;
+			std::vector<std::shared_ptr<CollisionAlgorithm>> childPairAlgorithms;
 	};
 
 }
@@ -19,33 +19,70 @@ namespace urchin
 
         const CollisionShape3D &otherShape = object2.getShape();
 
-        AbstractWorkBody *body1 = getManifoldResult().getBody1();
-        AbstractWorkBody *body2 = getManifoldResult().getBody2();
-
         AABBox<float> aabboxLocalToObject1 = object2.getShape().toAABBox(object1.getShapeWorldTransform().inverse() * object2.getShapeWorldTransform());
         const auto &concaveShape = dynamic_cast<const CollisionConcaveShape &>(object1.getShape());
 
-        const std::vector<CollisionTriangleShape> &triangles = concaveShape.findTrianglesInAABBox(aabboxLocalToObject1);
-        for(const auto &triangle : triangles)
-        {
-            std::shared_ptr<CollisionAlgorithm> collisionAlgorithm = getCollisionAlgorithmSelector()->createCollisionAlgorithm(
-                    body1, &triangle, body2, &otherShape);
+        FunctionTriangleVisitor triangleVisitor([&](const CollisionTriangleShape &triangle) {
+            const std::shared_ptr<CollisionAlgorithm> &collisionAlgorithm = retrieveTriangleCollisionAlgorithm(triangle, otherShape).collisionAlgorithm;
 
             CollisionObjectWrapper subObject1(triangle, object1.getShapeWorldTransform());
             CollisionObjectWrapper subObject2(otherShape, object2.getShapeWorldTransform());
 
-            collisionAlgorithm->processCollisionAlgorithm(subObject1, subObject2, false);
+            collisionAlgorithm->processCollisionAlgorithm(subObject1, subObject2, true);
 
             const ManifoldResult &algorithmManifoldResult = collisionAlgorithm->getConstManifoldResult();
-            addContactPointsToManifold(algorithmManifoldResult, collisionAlgorithm->isObjectSwapped());
+            addContactPointsToManifold(algorithmManifoldResult, collisionAlgorithm->isObjectSwapped(), triangle.getTriangleIndex());
+        });
+        concaveShape.findTrianglesInAABBox(aabboxLocalToObject1, triangleVisitor);
+
+        removeUnusedTriangleCollisionAlgorithms();
+    }
+
+    /**
+     * Collision algorithms of triangles are kept between two processes: it avoids to re-create them at each step and
+     * keep the contact points persistent for each triangle.
+     */
+    ConcaveAnyCollisionAlgorithm::TriangleCollisionAlgorithm &ConcaveAnyCollisionAlgorithm::retrieveTriangleCollisionAlgorithm(
+            const CollisionTriangleShape &triangle, const CollisionShape3D &otherShape)
+    {
+        auto itFind = triangleCollisionAlgorithms.find(triangle.getTriangleIndex());
+        if(itFind != triangleCollisionAlgorithms.end())
+        {
+            itFind->second.usedInLastProcess = true;
+            return itFind->second;
+        }
+
+        AbstractWorkBody *body1 = getManifoldResult().getBody1();
+        AbstractWorkBody *body2 = getManifoldResult().getBody2();
+        TriangleCollisionAlgorithm triangleCollisionAlgorithm = {getCollisionAlgorithmSelector()->createCollisionAlgorithm(body1, &triangle, body2, &otherShape), true};
+        return triangleCollisionAlgorithms.emplace(triangle.getTriangleIndex(), std::move(triangleCollisionAlgorithm)).first->second;
+    }
+
+    /**
+     * Remove collision algorithms of triangles which are not anymore in the AABBox of the other shape
+     */
+    void ConcaveAnyCollisionAlgorithm::removeUnusedTriangleCollisionAlgorithms()
+    {
+        for(auto it = triangleCollisionAlgorithms.begin(); it != triangleCollisionAlgorithms.end();)
+        {
+            if(it->second.usedInLastProcess)
+            {
+                it->second.usedInLastProcess = false;
+                ++it;
+            }else
+            {
+                it = triangleCollisionAlgorithms.erase(it);
+            }
         }
     }
 
-    void ConcaveAnyCollisionAlgorithm::addContactPointsToManifold(const ManifoldResult &manifoldResult, bool manifoldSwapped)
+    void ConcaveAnyCollisionAlgorithm::addContactPointsToManifold(const ManifoldResult &manifoldResult, bool manifoldSwapped, std::size_t subShapeIndex)
     {
         for(unsigned int i=0; i<manifoldResult.getNumContactPoints(); ++i)
         {
             const ManifoldContactPoint &manifoldContactPoint = manifoldResult.getManifoldContactPoint(i);
+            unsigned int featureId = manifoldContactPoint.getFeatureId() == NO_FEATURE_ID ? NO_FEATURE_ID
+                    : combineFeatureIds(static_cast<unsigned int>(subShapeIndex), manifoldContactPoint.getFeatureId()); //features of sub-shapes must be distinct
             if(manifoldSwapped)
             {
                 getManifoldResult().addContactPoint(
@@ -55,6 +92,7 @@ namespace urchin
                         manifoldContactPoint.getLocalPointOnObject2(),
                         manifoldContactPoint.getLocalPointOnObject1(),
                         manifoldContactPoint.getDepth(),
+                        featureId,
                         manifoldContactPoint.isPredictive());
             }else
             {
@@ -65,6 +103,7 @@ namespace urchin
                         manifoldContactPoint.getLocalPointOnObject1(),
                         manifoldContactPoint.getLocalPointOnObject2(),
                         manifoldContactPoint.getDepth(),
+                        featureId,
                         manifoldContactPoint.isPredictive());
             }
         }
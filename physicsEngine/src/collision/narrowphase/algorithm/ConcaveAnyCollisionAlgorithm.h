@@ -1,11 +1,15 @@
 #ifndef URCHINENGINE_CONCAVEANYCOLLISIONALGORITHM_H
 #define URCHINENGINE_CONCAVEANYCOLLISIONALGORITHM_H
 
+#include <memory>
+#include <unordered_map>
+
 #include "collision/narrowphase/algorithm/CollisionAlgorithm.h"
 #include "collision/narrowphase/algorithm/CollisionAlgorithmBuilder.h"
 #include "collision/narrowphase/algorithm/CollisionAlgorithmSelector.h"
 #include "collision/ManifoldResult.h"
 #include "collision/narrowphase/CollisionObjectWrapper.h"
+#include "shape/CollisionTriangleShape.h"
 
 namespace urchin
 {
@@ -27,7 +31,17 @@ namespace urchin
             };
 
         private:
-            void addContactPointsToManifold(const ManifoldResult &, bool);
+            struct TriangleCollisionAlgorithm
+            {
+                std::shared_ptr<CollisionAlgorithm> collisionAlgorithm;
+                bool usedInLastProcess;
+            };
+
+            TriangleCollisionAlgorithm &retrieveTriangleCollisionAlgorithm(const CollisionTriangleShape &, const CollisionShape3D &);
+            void removeUnusedTriangleCollisionAlgorithms();
+            void addContactPointsToManifold(const ManifoldResult &, bool, std::size_t);
+
+            std::unordered_map<unsigned int, TriangleCollisionAlgorithm> triangleCollisionAlgorithms; //first: triangle index, second: collision algorithm
     };
 
 }
@@ -1,4 +1,5 @@
 #include <memory>
+#include <cmath>
 
 #include "collision/narrowphase/algorithm/ConvexConvexCollisionAlgorithm.h"
 #include "object/CollisionConvexObject3D.h"
@@ -16,43 +17,61 @@ namespace urchin
 	{
 		ScopeProfiler profiler("physics", "algConvConv");
 
-		//transform convex hull shapes
-		std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> convexObject1 = object1.getShape().toConvexObject(object1.getShapeWorldTransform());
-		std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> convexObject2 = object2.getShape().toConvexObject(object2.getShapeWorldTransform());
+		//transform convex hull shapes (cached convex objects of static/sleeping bodies are reused)
+		std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> transformedObject1, transformedObject2;
+		const CollisionConvexObject3D &convexObject1 = retrieveConvexObject(object1, transformedObject1);
+		const CollisionConvexObject3D &convexObject2 = retrieveConvexObject(object2, transformedObject2);
 
 		//process GJK and EPA hybrid algorithms
-		std::unique_ptr<GJKResult<double>, AlgorithmResultDeleter> gjkResultWithoutMargin = gjkAlgorithm.processGJK(*convexObject1, *convexObject2, false);
+		std::unique_ptr<GJKResult<double>, AlgorithmResultDeleter> gjkResultWithoutMargin = gjkAlgorithm.processGJK(convexObject1, convexObject2, false);
 
 		if(gjkResultWithoutMargin->isValidResult())
 		{
 			if(gjkResultWithoutMargin->isCollide())
 			{ //collision detected on reduced objects (without margins)
-				processCollisionAlgorithmWithMargin(convexObject1, convexObject2);
+				processCollisionAlgorithmWithMargin(object1, object2, convexObject1, convexObject2);
 			}else
 			{ //collision detected on enlarged objects (with margins) OR no collision detected
 				const Vector3<double> &vectorBA = gjkResultWithoutMargin->getClosestPointB().vector(gjkResultWithoutMargin->getClosestPointA());
 				float vectorBALength = vectorBA.length();
-				float sumMargins = convexObject1->getOuterMargin() + convexObject2->getOuterMargin();
+				float sumMargins = convexObject1.getOuterMargin() + convexObject2.getOuterMargin();
 				if(sumMargins > vectorBALength - getContactBreakingThreshold())
 				{ //collision detected on enlarged objects
 					const Vector3<double> &normalFromObject2 = vectorBA.normalize();
-					const Point3<double> &pointOnObject2 = gjkResultWithoutMargin->getClosestPointB().translate(normalFromObject2 * (double)convexObject2->getOuterMargin());
+					const Point3<double> &pointOnObject2 = gjkResultWithoutMargin->getClosestPointB().translate(normalFromObject2 * (double)convexObject2.getOuterMargin());
 					const float penetrationDepth = vectorBALength - sumMargins;
 
-					addNewContactPoint(normalFromObject2.cast<float>(), pointOnObject2.cast<float>(), penetrationDepth);
+					unsigned int featureId = computeFeatureId(object1, object2, normalFromObject2.cast<float>(), pointOnObject2.cast<float>(), penetrationDepth);
+					addNewContactPoint(normalFromObject2.cast<float>(), pointOnObject2.cast<float>(), penetrationDepth, featureId);
 				}
 			}
 		}
 	}
 
-	void ConvexConvexCollisionAlgorithm::processCollisionAlgorithmWithMargin(const std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> &convexObject1,
-			const std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> &convexObject2)
+	/**
+	 * @param transformedObject [OUT] Owner of the convex object when the object has no cached convex object
+	 * @return Convex object of the object in world space
+	 */
+	const CollisionConvexObject3D &ConvexConvexCollisionAlgorithm::retrieveConvexObject(const CollisionObjectWrapper &object,
+			std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> &transformedObject) const
 	{
-		std::unique_ptr<GJKResult<double>, AlgorithmResultDeleter> gjkResultWithMargin = gjkAlgorithm.processGJK(*convexObject1, *convexObject2, true);
+		if(object.getCachedConvexObject())
+		{
+			return *object.getCachedConvexObject();
+		}
+
+		transformedObject = object.getShape().toConvexObject(object.getShapeWorldTransform());
+		return *transformedObject;
+	}
+
+	void ConvexConvexCollisionAlgorithm::processCollisionAlgorithmWithMargin(const CollisionObjectWrapper &object1, const CollisionObjectWrapper &object2,
+			const CollisionConvexObject3D &convexObject1, const CollisionConvexObject3D &convexObject2)
+	{
+		std::unique_ptr<GJKResult<double>, AlgorithmResultDeleter> gjkResultWithMargin = gjkAlgorithm.processGJK(convexObject1, convexObject2, true);
 
 		if(gjkResultWithMargin->isValidResult() && gjkResultWithMargin->isCollide())
 		{
-			std::unique_ptr<EPAResult<double>, AlgorithmResultDeleter> epaResult = epaAlgorithm.processEPA(*convexObject1, *convexObject2, *gjkResultWithMargin);
+			std::unique_ptr<EPAResult<double>, AlgorithmResultDeleter> epaResult = epaAlgorithm.processEPA(convexObject1, convexObject2, *gjkResultWithMargin);
 
 			if(epaResult->isValidResult() && epaResult->isCollide())
 			{ //should be always true except for problems due to float imprecision
@@ -60,11 +79,44 @@ namespace urchin
 				const Point3<double> &pointOnObject2 = epaResult->getContactPointB();
 				const float penetrationDepth = -epaResult->getPenetrationDepth();
 
-				addNewContactPoint(normalFromObject2.cast<float>(), pointOnObject2.cast<float>(), penetrationDepth);
+				unsigned int featureId = computeFeatureId(object1, object2, normalFromObject2.cast<float>(), pointOnObject2.cast<float>(), penetrationDepth);
+				addNewContactPoint(normalFromObject2.cast<float>(), pointOnObject2.cast<float>(), penetrationDepth, featureId);
 			}
 		}
 	}
 
+	/**
+	 * GJK and EPA algorithms work on support functions and don't provide vertex or face indices. Features in contact are
+	 * identified by the cells containing the contact points in the local space of each shape: the contact points of
+	 * same features stay in the same cells across the frames.
+	 * @return Identifier of the features in contact
+	 */
+	unsigned int ConvexConvexCollisionAlgorithm::computeFeatureId(const CollisionObjectWrapper &object1, const CollisionObjectWrapper &object2,
+			const Vector3<float> &normalFromObject2, const Point3<float> &pointOnObject2, float depth) const
+	{
+		Point3<float> pointOnObject1 = pointOnObject2.translate(normalFromObject2 * depth);
+		unsigned int cellId1 = computeLocalPointCellId(object1.getShapeWorldTransform().inverseTransform(pointOnObject1));
+		unsigned int cellId2 = computeLocalPointCellId(object2.getShapeWorldTransform().inverseTransform(pointOnObject2));
+
+		return combineFeatureIds(cellId1, cellId2);
+	}
+
+	/**
+	 * @return Identifier of the cell containing the local point. Cells size is the contact breaking threshold.
+	 */
+	unsigned int ConvexConvexCollisionAlgorithm::computeLocalPointCellId(const Point3<float> &localPoint) const
+	{
+		float invCellSize = 1.0f / getContactBreakingThreshold();
+		unsigned int cellId = 0;
+		for(unsigned int i=0; i<3; ++i)
+		{
+			auto cellIndex = static_cast<int>(std::round(localPoint[i] * invCellSize)); //cells centered on origin: contact points are often on shape axes
+			cellId = combineFeatureIds(cellId, static_cast<unsigned int>(cellIndex));
+		}
+
+		return cellId;
+	}
+
 	CollisionAlgorithm *ConvexConvexCollisionAlgorithm::Builder::createCollisionAlgorithm(bool objectSwapped, ManifoldResult &&result, FixedSizePool<CollisionAlgorithm> *algorithmPool) const
 	{
 		void *memPtr = algorithmPool->allocate(sizeof(ConvexConvexCollisionAlgorithm));
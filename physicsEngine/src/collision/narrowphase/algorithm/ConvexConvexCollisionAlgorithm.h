@@ -28,8 +28,11 @@ namespace urchin
 			};
 
 		private:
-			void processCollisionAlgorithmWithMargin(const std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> &,
-			        const std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> &);
+			const CollisionConvexObject3D &retrieveConvexObject(const CollisionObjectWrapper &, std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> &) const;
+			void processCollisionAlgorithmWithMargin(const CollisionObjectWrapper &, const CollisionObjectWrapper &,
+					const CollisionConvexObject3D &, const CollisionConvexObject3D &);
+			unsigned int computeFeatureId(const CollisionObjectWrapper &, const CollisionObjectWrapper &, const Vector3<float> &, const Point3<float> &, float) const;
+			unsigned int computeLocalPointCellId(const Point3<float> &) const;
 
 			GJKAlgorithm<double> gjkAlgorithm;
 			EPAAlgorithm<double> epaAlgorithm;
@@ -2,7 +2,6 @@
 
 #include "collision/narrowphase/algorithm/SphereBoxCollisionAlgorithm.h"
 #include "shape/CollisionSphereShape.h"
-#include "shape/CollisionBoxShape.h"
 
 namespace urchin
 {
@@ -74,13 +73,42 @@ namespace urchin
 			//normalize normal
 			normalFromObject2 /= boxSphereLength;
 
+			unsigned int featureId = computeBoxFeatureId(box2, closestPointOnBox);
+
 			//transform back in world space
 			closestPointOnBox = object2.getShapeWorldTransform().transform(closestPointOnBox);
 			Point3<float> tmpNormalFromObject2 = object2.getShapeWorldTransform().getOrientation().rotatePoint(Point3<float>(normalFromObject2.X, normalFromObject2.Y, normalFromObject2.Z));
 			normalFromObject2.setValues(tmpNormalFromObject2.X, tmpNormalFromObject2.Y, tmpNormalFromObject2.Z);
 
-			addNewContactPoint(normalFromObject2, closestPointOnBox, depth);
+			addNewContactPoint(normalFromObject2, closestPointOnBox, depth, featureId);
+		}
+	}
+
+	/**
+	 * @param closestPointOnBox Closest point on box in box local space
+	 * @return Identifier of the box feature (face, edge or vertex) containing the closest point. Each axis of the box
+	 * gives the minimum side, the maximum side or none of them.
+	 */
+	unsigned int SphereBoxCollisionAlgorithm::computeBoxFeatureId(const CollisionBoxShape &box, const Point3<float> &closestPointOnBox) const
+	{
+		unsigned int featureId = 0;
+		unsigned int axisFactor = 1;
+		for(unsigned int i=0; i<3; ++i)
+		{
+			unsigned int axisSide = 0;
+			if(closestPointOnBox[i] <= -box.getHalfSize(i))
+			{
+				axisSide = 1;
+			}else if(closestPointOnBox[i] >= box.getHalfSize(i))
+			{
+				axisSide = 2;
+			}
+
+			featureId += axisSide * axisFactor;
+			axisFactor *= 3;
 		}
+
+		return featureId + 1; //avoid NO_FEATURE_ID
 	}
 
 	CollisionAlgorithm *SphereBoxCollisionAlgorithm::Builder::createCollisionAlgorithm(bool objectSwapped, ManifoldResult &&result, FixedSizePool<CollisionAlgorithm> *algorithmPool) const
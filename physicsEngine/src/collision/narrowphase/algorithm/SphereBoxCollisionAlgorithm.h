@@ -5,6 +5,7 @@
 #include "collision/narrowphase/algorithm/CollisionAlgorithmBuilder.h"
 #include "collision/ManifoldResult.h"
 #include "collision/narrowphase/CollisionObjectWrapper.h"
+#include "shape/CollisionBoxShape.h"
 
 namespace urchin
 {
@@ -24,6 +25,9 @@ namespace urchin
 				const std::vector<CollisionShape3D::ShapeType> &getFirstExpectedShapeType() const override;
 				unsigned int getAlgorithmSize() const override;
 			};
+
+		private:
+			unsigned int computeBoxFeatureId(const CollisionBoxShape &, const Point3<float> &) const;
 	};
 
 }
@@ -3,6 +3,8 @@
 #include "collision/narrowphase/algorithm/SphereSphereCollisionAlgorithm.h"
 #include "shape/CollisionSphereShape.h"
 
+#define SPHERES_FEATURE_ID 1 //spheres have only one contact point
+
 namespace urchin
 {
 
@@ -39,7 +41,7 @@ namespace urchin
 			//compute intersection point
 			Point3<float> pointOnObject2 = object2.getShapeWorldTransform().getPosition().translate(radius2 * normalFromObject2);
 
-			addNewContactPoint(normalFromObject2, pointOnObject2, depth);
+			addNewContactPoint(normalFromObject2, pointOnObject2, depth, SPHERES_FEATURE_ID);
 		}
 	}
 
@@ -17,6 +17,7 @@ namespace urchin
 		public:
 			ContinuousCollisionResult(AbstractWorkBody *, const Vector3<T> &, const Point3<T> &, T);
 			ContinuousCollisionResult(const ContinuousCollisionResult &);
+			ContinuousCollisionResult &operator=(const ContinuousCollisionResult &) = default;
 
 			AbstractWorkBody *getBody2() const;
 
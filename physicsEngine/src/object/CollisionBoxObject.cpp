@@ -49,22 +49,15 @@ namespace urchin
 	{
 		if(includeMargin)
 		{
-			const Point3<float> &supportPoint = boxObject.getSupportPoint(direction);
-			Point3<float> supportPointWithMargin = supportPoint;
-
+			Vector3<float> centerToSupportPoint(0.0f, 0.0f, 0.0f);
 			for(unsigned int i=0; i<3; ++i)
 			{ //for each axis
 				const Vector3<float> &axis = boxObject.getAxis(i);
-				if(axis.dotProduct(boxObject.getCenterOfMass().vector(supportPoint)) > 0.0f)
-				{
-					supportPointWithMargin = supportPointWithMargin.translate(axis * getOuterMargin());
-				}else
-				{
-					supportPointWithMargin = supportPointWithMargin.translate(-(axis * getOuterMargin()));
-				}
+				float halfSize = axis.dotProduct(direction) >= 0.0f ? getHalfSize(i) : -getHalfSize(i);
+				centerToSupportPoint += halfSize * axis;
 			}
 
-			return supportPointWithMargin;
+			return boxObject.getCenterOfMass().translate(centerToSupportPoint);
 		}
 
 		return boxObject.getSupportPoint(direction);
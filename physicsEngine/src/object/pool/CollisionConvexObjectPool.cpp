@@ -23,8 +23,8 @@ namespace urchin
         });
         unsigned int objectsPoolSize = ConfigService::instance()->getUnsignedIntValue("collisionObject.poolSize");
 
-        //pool is synchronized because elements are created in narrow phase (= synchronized phase called by different threads) and deleted by different threads outside the narrow phase
-        objectsPool = new SyncFixedSizePool<CollisionConvexObject3D>("collisionConvexObjectsPool", maxElementSize, objectsPoolSize);
+        //pool is thread local because elements are created in narrow phase by different threads: elements deleted by another thread outside the narrow phase are given back lock-free to their pool
+        objectsPool = new ThreadLocalFixedSizePool<CollisionConvexObject3D>("collisionConvexObjectsPool", maxElementSize, objectsPoolSize);
     }
 
     CollisionConvexObjectPool::~CollisionConvexObjectPool()
@@ -32,7 +32,7 @@ namespace urchin
         delete objectsPool;
     }
 
-    SyncFixedSizePool<CollisionConvexObject3D> *CollisionConvexObjectPool::getObjectsPool()
+    ThreadLocalFixedSizePool<CollisionConvexObject3D> *CollisionConvexObjectPool::getObjectsPool()
     {
         return objectsPool;
     }
@@ -2,7 +2,7 @@
 #define URCHINENGINE_COLLISIONCONVEXOBJECTPOOL_H
 
 #include "UrchinCommon.h"
-#include "utils/pool/SyncFixedSizePool.h"
+#include "utils/pool/ThreadLocalFixedSizePool.h"
 
 namespace urchin
 {
@@ -17,12 +17,12 @@ namespace urchin
             CollisionConvexObjectPool();
             ~CollisionConvexObjectPool() override;
 
-            SyncFixedSizePool<CollisionConvexObject3D> *getObjectsPool();
+            ThreadLocalFixedSizePool<CollisionConvexObject3D> *getObjectsPool();
 
         private:
             unsigned int maxObjectSize(const std::vector<unsigned int>&);
 
-            SyncFixedSizePool<CollisionConvexObject3D> *objectsPool;
+            ThreadLocalFixedSizePool<CollisionConvexObject3D> *objectsPool;
     };
 
 }
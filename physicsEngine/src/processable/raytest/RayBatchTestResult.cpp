@@ -0,0 +1,79 @@
+#include <stdexcept>
+
+#include "processable/raytest/RayBatchTestResult.h"
+
+namespace urchin
+{
+
+	RayBatchTestResult::RayBatchTestResult() :
+			resultReady(false)
+	{
+
+	}
+
+	void RayBatchTestResult::addResults(std::vector<ContinuousCollisionResult<float>> &nearestResults)
+	{
+		assert(this->nearestResults.empty());
+
+		this->nearestResults.swap(nearestResults);
+
+		resultReady.store(true, std::memory_order_release);
+	}
+
+	/**
+	 * Return true if result is available. Indeed, after calling ray batch test method, the result is not directly available
+	 * as the physics engine work in separate thread.
+	 */
+	bool RayBatchTestResult::isResultReady() const
+	{
+		return resultReady.load(std::memory_order_acquire);
+	}
+
+	std::size_t RayBatchTestResult::getNumberRays() const
+	{
+		checkResultReady();
+
+		return nearestResults.size();
+	}
+
+	/**
+	 * @param rayIndex Index of the ray in the batch
+	 */
+	bool RayBatchTestResult::hasHit(std::size_t rayIndex) const
+	{
+		checkResultReady();
+
+		return nearestResults[rayIndex].getBody2() != nullptr;
+	}
+
+	/**
+	 * @param rayIndex Index of the ray in the batch
+	 */
+	const ContinuousCollisionResult<float> &RayBatchTestResult::getNearestResult(std::size_t rayIndex) const
+	{
+		checkResultReady();
+
+		assert(nearestResults[rayIndex].getBody2() != nullptr);
+
+		return nearestResults[rayIndex];
+	}
+
+	/**
+	 * @return Nearest hit of each ray. A ray without hit has a result without body.
+	 */
+	const std::vector<ContinuousCollisionResult<float>> &RayBatchTestResult::getNearestResults() const
+	{
+		checkResultReady();
+
+		return nearestResults;
+	}
+
+	void RayBatchTestResult::checkResultReady() const
+	{
+		if(!resultReady.load(std::memory_order_acquire))
+		{
+			throw std::runtime_error("Ray batch test callback result is not ready.");
+		}
+	}
+
+}
@@ -0,0 +1,40 @@
+#ifndef URCHINENGINE_RAYBATCHTESTRESULT_H
+#define URCHINENGINE_RAYBATCHTESTRESULT_H
+
+#include <atomic>
+#include <vector>
+
+#include "collision/narrowphase/algorithm/continuous/result/ContinuousCollisionResult.h"
+
+namespace urchin
+{
+
+	/**
+	 * Result of a batch of ray tests. The result is fill asynchronously to ray tests and stores the nearest hit of each ray
+	 * contiguously in the order of the rays. Once "isResultReady" returns true, the result can be read without lock.
+	 */
+	class RayBatchTestResult
+	{
+		public:
+			RayBatchTestResult();
+
+			void addResults(std::vector<ContinuousCollisionResult<float>> &);
+
+			bool isResultReady() const;
+
+			std::size_t getNumberRays() const;
+			bool hasHit(std::size_t) const;
+			const ContinuousCollisionResult<float> &getNearestResult(std::size_t) const;
+			const std::vector<ContinuousCollisionResult<float>> &getNearestResults() const;
+
+		private:
+			void checkResultReady() const;
+
+			std::atomic_bool resultReady;
+
+			std::vector<ContinuousCollisionResult<float>> nearestResults;
+	};
+
+}
+
+#endif
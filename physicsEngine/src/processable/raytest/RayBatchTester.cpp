@@ -0,0 +1,43 @@
+#include "processable/raytest/RayBatchTester.h"
+
+#include <utility>
+
+namespace urchin
+{
+
+	RayBatchTester::RayBatchTester(std::vector<Ray<float>> rays) :
+			rays(std::move(rays)),
+			rayBatchTestResult(std::make_shared<RayBatchTestResult>()),
+			collisionWorld(nullptr)
+	{
+
+	}
+
+	std::shared_ptr<const RayBatchTestResult> RayBatchTester::getRayBatchTestResult() const
+	{
+		return rayBatchTestResult;
+	}
+
+	void RayBatchTester::initialize(PhysicsWorld *physicsWorld)
+	{
+		collisionWorld = physicsWorld->getCollisionWorld();
+	}
+
+	void RayBatchTester::setup(float, const Vector3<float> &)
+	{
+		//nothing to do
+	}
+
+	void RayBatchTester::execute(float, const Vector3<float> &)
+	{
+		std::vector<std::size_t> bodiesOffsets;
+		std::vector<AbstractWorkBody *> bodiesAABBoxHitRays;
+		collisionWorld->getBroadPhaseManager()->rayBatchTest(rays, bodiesOffsets, bodiesAABBoxHitRays);
+
+		std::vector<ContinuousCollisionResult<float>> nearestResults;
+		collisionWorld->getNarrowPhaseManager()->rayBatchTest(rays, bodiesOffsets, bodiesAABBoxHitRays, nearestResults);
+
+		rayBatchTestResult->addResults(nearestResults);
+	}
+
+}
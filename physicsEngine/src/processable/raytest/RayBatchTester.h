@@ -0,0 +1,39 @@
+#ifndef URCHINENGINE_RAYBATCHTESTER_H
+#define URCHINENGINE_RAYBATCHTESTER_H
+
+#include <vector>
+#include "UrchinCommon.h"
+
+#include "PhysicsWorld.h"
+#include "processable/Processable.h"
+#include "processable/raytest/RayBatchTestResult.h"
+#include "collision/CollisionWorld.h"
+
+namespace urchin
+{
+
+	/**
+	* Test a batch of rays with one broad phase traversal for all the rays
+	*/
+	class RayBatchTester : public Processable
+	{
+		public:
+			explicit RayBatchTester(std::vector<Ray<float>> rays);
+
+			std::shared_ptr<const RayBatchTestResult> getRayBatchTestResult() const;
+
+			void initialize(PhysicsWorld *) override;
+
+			void setup(float, const Vector3<float> &) override;
+			void execute(float, const Vector3<float> &) override;
+
+		private:
+			const std::vector<Ray<float>> rays;
+			std::shared_ptr<RayBatchTestResult> rayBatchTestResult;
+
+			CollisionWorld *collisionWorld;
+	};
+
+}
+
+#endif
@@ -10,7 +10,8 @@ namespace urchin
 			CollisionShape3D(),
 			localizedShapes(localizedShapes),
             maxDistanceToCenter(0.0f),
-            minDistanceToCenter(0.0f)
+            minDistanceToCenter(0.0f),
+			childrenBVH(computeChildrenAABBox(localizedShapes))
 	{
 		if(localizedShapes.empty())
 		{
@@ -34,6 +35,17 @@ namespace urchin
 		}
 	}
 
+	std::vector<AABBox<float>> CollisionCompoundShape::computeChildrenAABBox(const std::vector<std::shared_ptr<const LocalizedCollisionShape>> &localizedShapes)
+	{
+		std::vector<AABBox<float>> childrenAABBox;
+		childrenAABBox.reserve(localizedShapes.size());
+		for(const auto &localizedShape : localizedShapes)
+		{
+			childrenAABBox.push_back(localizedShape->shape->toAABBox(localizedShape->transform));
+		}
+		return childrenAABBox;
+	}
+
 	CollisionShape3D::ShapeType CollisionCompoundShape::getShapeType() const
 	{
 		return CollisionShape3D::COMPOUND_SHAPE;
@@ -49,6 +61,14 @@ namespace urchin
 		return localizedShapes;
 	}
 
+	/**
+	 * @return Hierarchy of the children boxes in compound local space. Indices of the children are the indices of the localized shapes.
+	 */
+	const CompoundChildrenBVH &CollisionCompoundShape::getChildrenBVH() const
+	{
+		return childrenBVH;
+	}
+
 	std::shared_ptr<CollisionShape3D> CollisionCompoundShape::scale(float scale) const
 	{
 		std::vector<std::shared_ptr<const LocalizedCollisionShape>> scaledLocalizedShapes;
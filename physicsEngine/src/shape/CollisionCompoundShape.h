@@ -6,6 +6,7 @@
 #include "UrchinCommon.h"
 
 #include "shape/CollisionShape3D.h"
+#include "shape/CompoundChildrenBVH.h"
 #include "object/CollisionConvexObject3D.h"
 #include "utils/math/PhysicsTransform.h"
 
@@ -27,6 +28,7 @@ namespace urchin
 			CollisionShape3D::ShapeType getShapeType() const override;
 			const ConvexShape3D<float> *getSingleShape() const override;
 			const std::vector<std::shared_ptr<const LocalizedCollisionShape>> &getLocalizedShapes() const;
+			const CompoundChildrenBVH &getChildrenBVH() const;
 
 			std::shared_ptr<CollisionShape3D> scale(float) const override;
 
@@ -41,11 +43,14 @@ namespace urchin
 
 		private:
 			void initializeDistances();
+			static std::vector<AABBox<float>> computeChildrenAABBox(const std::vector<std::shared_ptr<const LocalizedCollisionShape>> &);
 
 			const std::vector<std::shared_ptr<const LocalizedCollisionShape>> localizedShapes;
 
 			float maxDistanceToCenter;
 			float minDistanceToCenter;
+
+			const CompoundChildrenBVH childrenBVH;
 	};
 
 }
@@ -9,13 +9,48 @@
 namespace urchin
 {
 
+    /**
+    * Visitor of the triangles found in a concave shape. Visited triangle is built on the fly: it is valid only during the visit.
+    */
+    class TriangleVisitor
+    {
+        public:
+            virtual ~TriangleVisitor() = default;
+
+            virtual void visitTriangle(const CollisionTriangleShape &) = 0;
+    };
+
+    /**
+    * Triangle visitor calling a function (e.g.: lambda) without allocation
+    */
+    template<class Function> class FunctionTriangleVisitor : public TriangleVisitor
+    {
+        public:
+            explicit FunctionTriangleVisitor(Function function) :
+                    function(std::move(function))
+            {
+
+            }
+
+            void visitTriangle(const CollisionTriangleShape &triangle) override
+            {
+                function(triangle);
+            }
+
+        private:
+            Function function;
+    };
+
+    /**
+    * Concave shape queries don't use any shared state: they can be executed concurrently.
+    */
     class CollisionConcaveShape
     {
         public:
             virtual ~CollisionConcaveShape() = default;
 
-            virtual const std::vector<CollisionTriangleShape> &findTrianglesInAABBox(const AABBox<float> &) const = 0;
-            virtual const std::vector<CollisionTriangleShape> &findTrianglesHitByRay(const LineSegment3D<float> &) const = 0;
+            virtual void findTrianglesInAABBox(const AABBox<float> &, TriangleVisitor &) const = 0;
+            virtual void findTrianglesHitByRay(const LineSegment3D<float> &, TriangleVisitor &) const = 0;
     };
 
 }
@@ -15,15 +15,6 @@ namespace urchin
     {
         assert(this->vertices.size()==xLength*zLength);
         localAABBox = buildLocalAABBox();
-
-        unsigned int trianglesShapePoolSize = ConfigService::instance()->getUnsignedIntValue("collisionShape.heightfieldTrianglesPoolSize");
-        triangleShapesPool = new FixedSizePool<TriangleShape3D<float>>("triangleShapesPool", sizeof(TriangleShape3D<float>), trianglesShapePoolSize);
-    }
-
-    CollisionHeightfieldShape::~CollisionHeightfieldShape()
-    {
-        trianglesInAABBox.clear();
-        delete triangleShapesPool;
     }
 
     std::unique_ptr<BoxShape<float>> CollisionHeightfieldShape::buildLocalAABBox() const
@@ -91,24 +82,21 @@ namespace urchin
         return zLength;
     }
 
+    /**
+     * Box is computed at each call without the last transform cache of the shape: method can be called concurrently
+     * by the threads of the narrow phase.
+     */
     AABBox<float> CollisionHeightfieldShape::toAABBox(const PhysicsTransform &physicsTransform) const
     {
-        if(!lastTransform.equals(physicsTransform))
-        {
-            const Matrix3<float> &orientation = physicsTransform.retrieveOrientationMatrix();
-            Point3<float> extend(
-                    localAABBox->getHalfSize(0) * std::abs(orientation(0)) + localAABBox->getHalfSize(1) * std::abs(orientation(3)) + localAABBox->getHalfSize(2) * std::abs(orientation(6)),
-                    localAABBox->getHalfSize(0) * std::abs(orientation(1)) + localAABBox->getHalfSize(1) * std::abs(orientation(4)) + localAABBox->getHalfSize(2) * std::abs(orientation(7)),
-                    localAABBox->getHalfSize(0) * std::abs(orientation(2)) + localAABBox->getHalfSize(1) * std::abs(orientation(5)) + localAABBox->getHalfSize(2) * std::abs(orientation(8))
-            );
-
-            const Point3<float> &position = physicsTransform.getPosition();
-
-            lastAABBox = AABBox<float>(position - extend, position + extend);
-            lastTransform = physicsTransform;
-        }
-
-        return lastAABBox;
+        const Matrix3<float> &orientation = physicsTransform.retrieveOrientationMatrix();
+        Point3<float> extend(
+                localAABBox->getHalfSize(0) * std::abs(orientation(0)) + localAABBox->getHalfSize(1) * std::abs(orientation(3)) + localAABBox->getHalfSize(2) * std::abs(orientation(6)),
+                localAABBox->getHalfSize(0) * std::abs(orientation(1)) + localAABBox->getHalfSize(1) * std::abs(orientation(4)) + localAABBox->getHalfSize(2) * std::abs(orientation(7)),
+                localAABBox->getHalfSize(0) * std::abs(orientation(2)) + localAABBox->getHalfSize(1) * std::abs(orientation(5)) + localAABBox->getHalfSize(2) * std::abs(orientation(8))
+        );
+
+        const Point3<float> &position = physicsTransform.getPosition();
+        return AABBox<float>(position - extend, position + extend);
     }
 
     std::unique_ptr<CollisionConvexObject3D, ObjectDeleter> CollisionHeightfieldShape::toConvexObject(const PhysicsTransform &physicsTransform) const
@@ -144,10 +132,11 @@ namespace urchin
         return new CollisionHeightfieldShape(vertices, xLength, zLength);
     }
 
-    const std::vector<CollisionTriangleShape> &CollisionHeightfieldShape::findTrianglesInAABBox(const AABBox<float> &checkAABBox) const
+    /**
+     * @param triangleVisitor Visitor called for each triangle having its AABBox overlapping the given AABBox
+     */
+    void CollisionHeightfieldShape::findTrianglesInAABBox(const AABBox<float> &checkAABBox, TriangleVisitor &triangleVisitor) const
     {
-        trianglesInAABBox.clear();
-
         auto vertexXRange = computeStartEndIndices(checkAABBox.getMin().X, checkAABBox.getMax().X, Axis::X);
         auto vertexZRange = computeStartEndIndices(checkAABBox.getMin().Z, checkAABBox.getMax().Z, Axis::Z);
 
@@ -155,71 +144,111 @@ namespace urchin
         {
             for (unsigned int x = vertexXRange.first; x < vertexXRange.second; ++x)
             {
-                createTrianglesMatchHeight(x, z, checkAABBox.getMin().Y, checkAABBox.getMax().Y);
+                visitTrianglesMatchHeight(x, z, checkAABBox.getMin().Y, checkAABBox.getMax().Y, triangleVisitor);
             }
         }
-
-        return trianglesInAABBox;
     }
 
-    const std::vector<CollisionTriangleShape> &CollisionHeightfieldShape::findTrianglesHitByRay(const LineSegment3D<float> &ray) const
+    /**
+     * Walk through the cells of the heightfield crossed by the ray (DDA algorithm on XZ plane). For each cell, the triangles are
+     * tested against the heights of the ray at the cell entry and exit.
+     * @param triangleVisitor Visitor called for each triangle potentially hit by the ray. Triangles are visited in ray direction order.
+     */
+    void CollisionHeightfieldShape::findTrianglesHitByRay(const LineSegment3D<float> &ray, TriangleVisitor &triangleVisitor) const
     {
-        trianglesInAABBox.clear();
+        const Point3<float> &rayStart = ray.getA();
+        Vector3<float> rayVector = ray.getA().vector(ray.getB());
 
-        bool raySameXValues = ray.getA().X == ray.getB().X;
-        bool raySameZValues = ray.getA().Z == ray.getB().Z;
+        float tStart = 0.0f;
+        float tEnd = 1.0f;
+        if(!clipRayOnGrid(rayStart, rayVector, tStart, tEnd))
+        {
+            return;
+        }
 
-        //2d line equation variables
-        float slopeLineZX = (ray.getB().X - ray.getA().X) / (ray.getB().Z - ray.getA().Z);
-        float slopeLineXY = (ray.getB().Y - ray.getA().Y) / (ray.getB().X - ray.getA().X);
-        float slopeLineZY = (ray.getB().Y - ray.getA().Y) / (ray.getB().Z - ray.getA().Z);
-        float interceptLineZX = ray.getA().X - (slopeLineZX * ray.getA().Z);
-        float interceptLineXY = ray.getA().Y - (slopeLineXY * ray.getA().X);
-        float interceptLineZY = ray.getA().Y - (slopeLineZY * ray.getA().Z);
+        float xCellSize = vertices[1].X - vertices[0].X;
+        float zCellSize = vertices[xLength].Z - vertices[0].Z;
+        auto maxXCell = static_cast<int>(xLength - 2);
+        auto maxZCell = static_cast<int>(zLength - 2);
+
+        Point3<float> clippedRayStart = rayStart.translate(rayVector * tStart);
+        int xCell = MathAlgorithm::clamp(static_cast<int>((clippedRayStart.X - vertices[0].X) / xCellSize), 0, maxXCell);
+        int zCell = MathAlgorithm::clamp(static_cast<int>((clippedRayStart.Z - vertices[0].Z) / zCellSize), 0, maxZCell);
+
+        int xStep = rayVector.X > 0.0f ? 1 : -1;
+        int zStep = rayVector.Z > 0.0f ? 1 : -1;
+        float xNextBoundary = vertices[0].X + (float)(xStep > 0 ? xCell + 1 : xCell) * xCellSize;
+        float zNextBoundary = vertices[0].Z + (float)(zStep > 0 ? zCell + 1 : zCell) * zCellSize;
+        float tMaxX = rayVector.X != 0.0f ? (xNextBoundary - rayStart.X) / rayVector.X : std::numeric_limits<float>::max();
+        float tMaxZ = rayVector.Z != 0.0f ? (zNextBoundary - rayStart.Z) / rayVector.Z : std::numeric_limits<float>::max();
+        float tDeltaX = rayVector.X != 0.0f ? xCellSize / std::abs(rayVector.X) : std::numeric_limits<float>::max();
+        float tDeltaZ = rayVector.Z != 0.0f ? zCellSize / std::abs(rayVector.Z) : std::numeric_limits<float>::max();
+
+        float tCellEnter = tStart;
+        while(true)
+        {
+            float tCellExit = std::min(std::min(tMaxX, tMaxZ), tEnd);
+            float yCellEnter = rayStart.Y + rayVector.Y * tCellEnter;
+            float yCellExit = rayStart.Y + rayVector.Y * tCellExit;
+            auto yMinMaxValue = std::minmax(yCellEnter, yCellExit);
 
-        float rayMinZ = std::min(ray.getA().Z, ray.getB().Z);
-        float rayMaxZ = std::max(ray.getA().Z, ray.getB().Z);
-        auto vertexZRange = computeStartEndIndices(rayMinZ, rayMaxZ, Axis::Z);
+            visitTrianglesMatchHeight(static_cast<unsigned int>(xCell), static_cast<unsigned int>(zCell), yMinMaxValue.first, yMinMaxValue.second, triangleVisitor);
 
-        for(unsigned int z = vertexZRange.first; z < vertexZRange.second; ++z)
-        {
-            float zStartValue = vertices[xLength * z].Z;
-            float zEndValue = vertices[xLength * (z + 1)].Z;
-            float xFirstValue = raySameZValues ? ray.getA().X : slopeLineZX * zStartValue + interceptLineZX;
-            float xSecondValue = raySameZValues ? ray.getB().X : slopeLineZX * zEndValue + interceptLineZX;
-            auto xMinMaxValue = std::minmax(xFirstValue, xSecondValue);
+            if(tCellExit >= tEnd)
+            {
+                break;
+            }
 
-            auto vertexXRange = computeStartEndIndices(xMinMaxValue.first, xMinMaxValue.second, Axis::X);
+            if(tMaxX < tMaxZ)
+            {
+                xCell += xStep;
+                tMaxX += tDeltaX;
+            }else
+            {
+                zCell += zStep;
+                tMaxZ += tDeltaZ;
+            }
 
-            for (unsigned int x = vertexXRange.first; x < vertexXRange.second; ++x)
+            if(xCell < 0 || xCell > maxXCell || zCell < 0 || zCell > maxZCell)
             {
-                //compute min and max Y values based on X value (don't give satisfying result when ray is parallel to Z axis)
-                float xCurrentValue = vertices[x].X;
-                float xNextValue = vertices[x + 1].X;
-                float yFirstValue1 = raySameXValues ? ray.getA().Y : slopeLineXY * xCurrentValue + interceptLineXY;
-                float ySecondValue1 = raySameXValues ? ray.getB().Y : slopeLineXY * xNextValue + interceptLineXY;
-                auto yMinMaxValue1 = std::minmax(yFirstValue1, ySecondValue1);
-
-                //compute min and max Y values based on Z value (don't give satisfying result when ray is parallel to X axis)
-                float yFirstValue2 = raySameZValues ? ray.getA().Y : slopeLineZY * zStartValue + interceptLineZY;
-                float ySecondValue2 = raySameZValues ? ray.getB().Y : slopeLineZY * zEndValue + interceptLineZY;
-                auto yMinMaxValue2 = std::minmax(yFirstValue2, ySecondValue2);
-
-                //combine both results to get a more satisfying result
-                float rayMinY = std::max(yMinMaxValue1.first, yMinMaxValue2.first);
-                float rayMaxY = std::min(yMinMaxValue1.second, yMinMaxValue2.second);
-
-                createTrianglesMatchHeight(x, z, rayMinY, rayMaxY);
+                break;
             }
+            tCellEnter = tCellExit;
         }
-
-        return trianglesInAABBox;
     }
 
     /**
-     * @param minValue Lower bound value on X (or Z) axis
-     * @param maxValue Upper bound value on X (or Z) axis
+     * Clip the ray (rayStart + t * rayVector) on the XZ bounds of the heightfield.
+     * @param tStart [IN/OUT] Ray parameter where the ray enters in the heightfield
+     * @param tEnd [IN/OUT] Ray parameter where the ray leaves the heightfield
+     * @return False when the ray doesn't cross the heightfield on XZ plane
      */
+    bool CollisionHeightfieldShape::clipRayOnGrid(const Point3<float> &rayStart, const Vector3<float> &rayVector, float &tStart, float &tEnd) const
+    {
+        const float minBounds[2] = {vertices[0].X, vertices[0].Z};
+        const float maxBounds[2] = {vertices[xLength - 1].X, vertices[vertices.size() - 1].Z};
+        const float starts[2] = {rayStart.X, rayStart.Z};
+        const float directions[2] = {rayVector.X, rayVector.Z};
+
+        for(unsigned int i=0; i<2; ++i)
+        {
+            if(directions[i] == 0.0f)
+            {
+                if(starts[i] < minBounds[i] || starts[i] > maxBounds[i])
+                {
+                    return false;
+                }
+            }else
+            {
+                auto tBounds = std::minmax((minBounds[i] - starts[i]) / directions[i], (maxBounds[i] - starts[i]) / directions[i]);
+                tStart = std::max(tStart, tBounds.first);
+                tEnd = std::min(tEnd, tBounds.second);
+            }
+        }
+
+        return tStart <= tEnd;
+    }
+
     std::pair<unsigned int, unsigned int> CollisionHeightfieldShape::computeStartEndIndices(float minValue, float maxValue, Axis axis) const
     {
         float halfSize = axis==Axis::X ? localAABBox->getHalfSizes().X : localAABBox->getHalfSizes().Z;
@@ -235,31 +264,26 @@ namespace urchin
         return std::make_pair(startVertex, endVertex);
     }
 
-    void CollisionHeightfieldShape::createTrianglesMatchHeight(unsigned int x, unsigned int z, float minY, float maxY) const
+    void CollisionHeightfieldShape::visitTrianglesMatchHeight(unsigned int x, unsigned int z, float minY, float maxY, TriangleVisitor &triangleVisitor) const
     {
         Point3<float> point1 = vertices[x + xLength * z]; //far-left
         Point3<float> point2 = vertices[x + 1 + xLength * z]; //far-right
         Point3<float> point3 = vertices[x + xLength * (z + 1)]; //near-left
         Point3<float> point4 = vertices[x + 1 + xLength * (z + 1)]; //near-right
 
+        unsigned int firstTriangleIndex = (x + xLength * z) * 2;
         bool hasDiagonalPointAbove = point2.Y > minY || point3.Y > minY;
         bool hasDiagonalPointBelow = point2.Y < maxY || point3.Y < maxY;
 
         if( (point1.Y > minY || hasDiagonalPointAbove) && (point1.Y < maxY || hasDiagonalPointBelow) )
         {
-            createCollisionTriangleShape(point1, point3, point2);
+            triangleVisitor.visitTriangle(CollisionTriangleShape(point1, point3, point2, firstTriangleIndex));
         }
 
         if( (point4.Y > minY || hasDiagonalPointAbove) && (point4.Y < maxY || hasDiagonalPointBelow) )
         {
-            createCollisionTriangleShape(point2, point3, point4);
+            triangleVisitor.visitTriangle(CollisionTriangleShape(point2, point3, point4, firstTriangleIndex + 1));
         }
     }
 
-    void CollisionHeightfieldShape::createCollisionTriangleShape(const Point3<float> &p1, const Point3<float> &p2, const Point3<float> &p3) const
-    {
-        void *shapeMemPtr = triangleShapesPool->allocate(sizeof(TriangleShape3D<float>));
-        trianglesInAABBox.emplace_back(CollisionTriangleShape(new (shapeMemPtr) TriangleShape3D<float>(p1, p2, p3), triangleShapesPool));
-    }
-
 }
@@ -8,7 +8,6 @@
 #include "shape/CollisionShape3D.h"
 #include "shape/CollisionConcaveShape.h"
 #include "object/CollisionTriangleObject.h"
-#include "utils/pool/FixedSizePool.h"
 
 namespace urchin
 {
@@ -19,7 +18,7 @@ namespace urchin
             CollisionHeightfieldShape(std::vector<Point3<float>>, unsigned int, unsigned int);
             CollisionHeightfieldShape(CollisionHeightfieldShape &&) = delete;
             CollisionHeightfieldShape(const CollisionHeightfieldShape &) = delete;
-            ~CollisionHeightfieldShape() override;
+            ~CollisionHeightfieldShape() override = default;
 
             CollisionShape3D::ShapeType getShapeType() const override;
             const ConvexShape3D<float> *getSingleShape() const override;
@@ -38,25 +37,22 @@ namespace urchin
 
             CollisionShape3D *clone() const override;
 
-            const std::vector<CollisionTriangleShape> &findTrianglesInAABBox(const AABBox<float> &) const override;
-            const std::vector<CollisionTriangleShape> &findTrianglesHitByRay(const LineSegment3D<float> &) const override;
+            void findTrianglesInAABBox(const AABBox<float> &, TriangleVisitor &) const override;
+            void findTrianglesHitByRay(const LineSegment3D<float> &, TriangleVisitor &) const override;
 
         private:
             enum Axis{X, Z};
 
             std::unique_ptr<BoxShape<float>> buildLocalAABBox() const;
             std::pair<unsigned int, unsigned int> computeStartEndIndices(float, float, Axis) const;
-            void createTrianglesMatchHeight(unsigned int, unsigned int, float, float) const;
-            void createCollisionTriangleShape(const Point3<float> &, const Point3<float> &, const Point3<float> &) const;
+            bool clipRayOnGrid(const Point3<float> &, const Vector3<float> &, float &, float &) const;
+            void visitTrianglesMatchHeight(unsigned int, unsigned int, float, float, TriangleVisitor &) const;
 
             std::vector<Point3<float>> vertices;
             unsigned int xLength;
             unsigned int zLength;
 
             std::unique_ptr<BoxShape<float>> localAABBox;
-            
-            mutable std::vector<CollisionTriangleShape> trianglesInAABBox;
-            FixedSizePool<TriangleShape3D<float>> *triangleShapesPool;
     };
 
 }
@@ -9,7 +9,7 @@
 
 #include "utils/math/PhysicsTransform.h"
 #include "object/CollisionConvexObject3D.h"
-#include "utils/pool/FixedSizePool.h"
+#include "utils/pool/ThreadLocalFixedSizePool.h"
 #include "object/pool/ObjectDeleter.h"
 
 namespace urchin
@@ -63,7 +63,7 @@ namespace urchin
 			virtual CollisionShape3D *clone() const = 0;
 
 		protected:
-            FixedSizePool<CollisionConvexObject3D> *getObjectsPool() const;
+            ThreadLocalFixedSizePool<CollisionConvexObject3D> *getObjectsPool() const;
 			void refreshInnerMargin(float);
 
 			mutable AABBox<float> lastAABBox;
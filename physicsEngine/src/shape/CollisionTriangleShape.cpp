@@ -6,38 +6,23 @@ namespace urchin
 
     CollisionTriangleShape::CollisionTriangleShape(const Point3<float> *points) :
             CollisionShape3D(),
-            triangleShape(new TriangleShape3D<float>(points)),
-            triangleShapesPool(nullptr)
+            triangleShape(TriangleShape3D<float>(points)),
+            triangleIndex(0)
     {
         refreshInnerMargin(0.0f); //no margin for triangle
     }
 
-    CollisionTriangleShape::CollisionTriangleShape(TriangleShape3D<float> *triangleShape, FixedSizePool<TriangleShape3D<float>> *triangleShapesPool) :
+    /**
+     * @param triangleIndex Index of the triangle in the concave shape. Index is constant for a same triangle in order to identify it between queries.
+     */
+    CollisionTriangleShape::CollisionTriangleShape(const Point3<float> &point1, const Point3<float> &point2, const Point3<float> &point3, unsigned int triangleIndex) :
             CollisionShape3D(),
-            triangleShape(triangleShape),
-            triangleShapesPool(triangleShapesPool)
+            triangleShape(TriangleShape3D<float>(point1, point2, point3)),
+            triangleIndex(triangleIndex)
     {
         refreshInnerMargin(0.0f); //no margin for triangle
     }
 
-    CollisionTriangleShape::CollisionTriangleShape(CollisionTriangleShape &&collisionTriangleShape) noexcept :
-            CollisionShape3D(collisionTriangleShape),
-            triangleShape(std::exchange(collisionTriangleShape.triangleShape, nullptr)),
-            triangleShapesPool(std::exchange(collisionTriangleShape.triangleShapesPool, nullptr))
-    {
-    }
-
-    CollisionTriangleShape::~CollisionTriangleShape()
-    {
-        if(triangleShapesPool)
-        {
-            triangleShapesPool->free(triangleShape);
-        }else
-        {
-            delete triangleShape;
-        }
-    }
-
     CollisionShape3D::ShapeType CollisionTriangleShape::getShapeType() const
     {
         return CollisionShape3D::TRIANGLE_SHAPE;
@@ -45,7 +30,12 @@ namespace urchin
 
     const ConvexShape3D<float> *CollisionTriangleShape::getSingleShape() const
     {
-        return triangleShape;
+        return &triangleShape;
+    }
+
+    unsigned int CollisionTriangleShape::getTriangleIndex() const
+    {
+        return triangleIndex;
     }
 
     std::shared_ptr<CollisionShape3D> CollisionTriangleShape::scale(float) const
@@ -64,9 +54,9 @@ namespace urchin
 
         void *memPtr = getObjectsPool()->allocate(sizeof(CollisionTriangleObject));
         auto *collisionObjectPtr = new (memPtr) CollisionTriangleObject(getInnerMargin(),
-                physicsTransform.transform(triangleShape->getPoints()[0]),
-                physicsTransform.transform(triangleShape->getPoints()[1]),
-                physicsTransform.transform(triangleShape->getPoints()[2]));
+                physicsTransform.transform(triangleShape.getPoints()[0]),
+                physicsTransform.transform(triangleShape.getPoints()[1]),
+                physicsTransform.transform(triangleShape.getPoints()[2]));
         return std::unique_ptr<CollisionTriangleObject, ObjectDeleter>(collisionObjectPtr);
     }
 
@@ -87,7 +77,7 @@ namespace urchin
 
     CollisionShape3D *CollisionTriangleShape::clone() const
     {
-        return new CollisionTriangleShape(triangleShape->getPoints());
+        return new CollisionTriangleShape(*this);
     }
 
 }
@@ -9,7 +9,6 @@
 #include "object/CollisionConvexObject3D.h"
 #include "object/CollisionTriangleObject.h"
 #include "utils/math/PhysicsTransform.h"
-#include "utils/pool/FixedSizePool.h"
 
 namespace urchin
 {
@@ -18,13 +17,12 @@ namespace urchin
     {
         public:
             explicit CollisionTriangleShape(const Point3<float> *);
-            CollisionTriangleShape(TriangleShape3D<float> *, FixedSizePool<TriangleShape3D<float>> *);
-            CollisionTriangleShape(CollisionTriangleShape &&) noexcept;
-            CollisionTriangleShape(const CollisionTriangleShape &) = delete;
-            ~CollisionTriangleShape() override;
+            CollisionTriangleShape(const Point3<float> &, const Point3<float> &, const Point3<float> &, unsigned int);
+            ~CollisionTriangleShape() override = default;
 
             CollisionShape3D::ShapeType getShapeType() const override;
             const ConvexShape3D<float> *getSingleShape() const override;
+            unsigned int getTriangleIndex() const;
 
             std::shared_ptr<CollisionShape3D> scale(float) const override;
 
@@ -38,8 +36,8 @@ namespace urchin
             CollisionShape3D *clone() const override;
 
         private:
-            TriangleShape3D<float> *triangleShape; //shape including margin
-            FixedSizePool<TriangleShape3D<float>> *triangleShapesPool;
+            TriangleShape3D<float> triangleShape; //shape including margin
+            unsigned int triangleIndex; //index of the triangle in the concave shape
     };
 
 }
@@ -0,0 +1,118 @@
+#include <algorithm>
+
+#include "shape/CompoundChildrenBVH.h"
+
+#define MAX_CHILDREN_BY_LEAF 2
+#define MAX_BVH_DEPTH 64
+
+namespace urchin
+{
+
+	/**
+	 * @param childrenAABBox Boxes of the children in compound local space. Indices of the children returned by queries are
+	 * the indices of this vector.
+	 */
+	CompoundChildrenBVH::CompoundChildrenBVH(const std::vector<AABBox<float>> &childrenAABBox) :
+			childrenAABBox(childrenAABBox)
+	{
+		childIndices.resize(childrenAABBox.size());
+		for(uint32_t i = 0; i < childIndices.size(); ++i)
+		{
+			childIndices[i] = i;
+		}
+
+		if(!childIndices.empty())
+		{
+			nodes.reserve(2 * childIndices.size());
+			buildNode(0, static_cast<uint32_t>(childIndices.size()));
+		}
+	}
+
+	/**
+	 * Build the node of the children [begin, end[ of childIndices. Children are split at the median of their box centers
+	 * along the largest axis: the depth of the tree is logarithmic.
+	 * @return Index of the built node
+	 */
+	uint32_t CompoundChildrenBVH::buildNode(uint32_t begin, uint32_t end)
+	{
+		auto nodeIndex = static_cast<uint32_t>(nodes.size());
+		nodes.push_back(Node{childrenAABBox[childIndices[begin]], begin, end - begin, 0});
+		for(uint32_t i = begin + 1; i < end; ++i)
+		{
+			nodes[nodeIndex].aabbox = nodes[nodeIndex].aabbox.merge(childrenAABBox[childIndices[i]]);
+		}
+
+		if(end - begin > MAX_CHILDREN_BY_LEAF)
+		{
+			AABBox<float> centersBox = AABBox<float>::initMergeableAABBox();
+			for(uint32_t i = begin; i < end; ++i)
+			{
+				const Point3<float> center = childrenAABBox[childIndices[i]].getCenterOfMass();
+				centersBox = centersBox.merge(AABBox<float>(center, center));
+			}
+			unsigned int splitAxis = centersBox.getMaxHalfSizeIndex();
+
+			uint32_t middle = begin + (end - begin) / 2;
+			std::nth_element(childIndices.begin() + begin, childIndices.begin() + middle, childIndices.begin() + end, [&](uint32_t index1, uint32_t index2) {
+				return childrenAABBox[index1].getCenterOfMass()[splitAxis] < childrenAABBox[index2].getCenterOfMass()[splitAxis];
+			});
+
+			uint32_t leftNodeIndex = buildNode(begin, middle);
+			uint32_t rightNodeIndex = buildNode(middle, end);
+			nodes[nodeIndex].firstChild = leftNodeIndex;
+			nodes[nodeIndex].nbChildren = 0;
+			nodes[nodeIndex].rightNode = rightNodeIndex;
+		}
+
+		return nodeIndex;
+	}
+
+	const AABBox<float> &CompoundChildrenBVH::getChildAABBox(std::size_t childIndex) const
+	{
+		return childrenAABBox[childIndex];
+	}
+
+	/**
+	 * @param aabbox Box in compound local space
+	 * @param childIndicesHit [OUT] Indices of the children colliding with the box, in increasing order
+	 */
+	void CompoundChildrenBVH::aabboxQuery(const AABBox<float> &aabbox, std::vector<std::size_t> &childIndicesHit) const
+	{
+		if(nodes.empty())
+		{
+			return;
+		}
+
+		std::size_t firstIndexHit = childIndicesHit.size();
+		uint32_t nodesToVisit[MAX_BVH_DEPTH];
+		unsigned int nbNodesToVisit = 0;
+		nodesToVisit[nbNodesToVisit++] = 0;
+
+		while(nbNodesToVisit > 0)
+		{
+			const Node &node = nodes[nodesToVisit[--nbNodesToVisit]];
+			if(!node.aabbox.collideWithAABBox(aabbox))
+			{
+				continue;
+			}
+
+			if(node.nbChildren > 0)
+			{
+				for(uint32_t i = node.firstChild; i < node.firstChild + node.nbChildren; ++i)
+				{
+					if(childrenAABBox[childIndices[i]].collideWithAABBox(aabbox))
+					{
+						childIndicesHit.push_back(childIndices[i]);
+					}
+				}
+			}else
+			{
+				nodesToVisit[nbNodesToVisit++] = node.rightNode;
+				nodesToVisit[nbNodesToVisit++] = node.firstChild;
+			}
+		}
+
+		std::sort(childIndicesHit.begin() + static_cast<long>(firstIndexHit), childIndicesHit.end());
+	}
+
+}
@@ -0,0 +1,42 @@
+#ifndef URCHINENGINE_COMPOUNDCHILDRENBVH_H
+#define URCHINENGINE_COMPOUNDCHILDRENBVH_H
+
+#include <vector>
+#include <cstdint>
+#include "UrchinCommon.h"
+
+namespace urchin
+{
+
+	/**
+	 * Static bounding volume hierarchy of the children of a compound shape. The hierarchy is built once from the boxes of
+	 * the children expressed in the compound local space and it is never updated: children of a compound shape don't move.
+	 */
+	class CompoundChildrenBVH
+	{
+		public:
+			explicit CompoundChildrenBVH(const std::vector<AABBox<float>> &);
+
+			const AABBox<float> &getChildAABBox(std::size_t) const;
+
+			void aabboxQuery(const AABBox<float> &, std::vector<std::size_t> &) const;
+
+		private:
+			struct Node
+			{
+				AABBox<float> aabbox;
+				uint32_t firstChild; //index of left node for internal node, position in childIndices for leaf node
+				uint32_t nbChildren; //0 for internal node
+				uint32_t rightNode; //index of right node for internal node
+			};
+
+			uint32_t buildNode(uint32_t, uint32_t);
+
+			std::vector<AABBox<float>> childrenAABBox;
+			std::vector<uint32_t> childIndices;
+			std::vector<Node> nodes;
+	};
+
+}
+
+#endif
@@ -22,6 +22,9 @@ namespace urchin
 			virtual void* allocate(unsigned int);
 			virtual void free(BaseType *ptr);
 
+		protected:
+			void deallocate(BaseType *ptr);
+
 		private:
 			void logPoolIsFull();
 
@@ -65,17 +65,25 @@ template<class BaseType> void* FixedSizePool<BaseType>::allocate(unsigned int si
  * @param ptr Pointer to free
  */
 template<class BaseType> void FixedSizePool<BaseType>::free(BaseType *ptr)
+{
+	ptr->~BaseType();
+	deallocate(ptr);
+}
+
+/**
+ * Free location in the pool without calling the destructor.
+ * @param ptr Pointer to free (destructor must be already called)
+ */
+template<class BaseType> void FixedSizePool<BaseType>::deallocate(BaseType *ptr)
 {
 	if (((unsigned char*)ptr >= pool && (unsigned char*)ptr < pool + maxElementSize*maxElements))
 	{ //ptr is in the pool
-		ptr->~BaseType();
-		
 		*(void**)ptr = firstFree;
 		firstFree = ptr;
 		++freeCount;
 	}else
 	{
-		delete ptr;
+		operator delete(ptr);
 	}
 }
 
@@ -13,7 +13,8 @@ template<class BaseType> void* SyncFixedSizePool<BaseType>::allocate(unsigned in
 
 template<class BaseType> void SyncFixedSizePool<BaseType>::free(BaseType *ptr)
 {
-    std::lock_guard<std::mutex> lock(mutex);
+    ptr->~BaseType(); //destructor called outside the lock because it can free other elements of this pool
 
-    FixedSizePool<BaseType>::free(ptr);
+    std::lock_guard<std::mutex> lock(mutex);
+    FixedSizePool<BaseType>::deallocate(ptr);
 }
@@ -0,0 +1,5 @@
+
+namespace urchin
+{
+
+}
@@ -0,0 +1,90 @@
+#ifndef URCHINENGINE_THREADLOCALFIXEDSIZEPOOL_H
+#define URCHINENGINE_THREADLOCALFIXEDSIZEPOOL_H
+
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <set>
+#include <vector>
+#include <sstream>
+#include <string>
+#include "UrchinCommon.h"
+
+#define MAX_POOL_THREADS 64
+
+namespace urchin
+{
+
+	/**
+	* Pool where each thread allocates its elements in its own fixed size chunk of memory. Allocations are lock-free: a thread
+	* pops elements from its own free list. Elements freed by another thread than the owner of the chunk are pushed in a
+	* lock-free remote free list which is taken back by the owner once its own free list is empty.
+	* The chunk of a thread is released when the thread exits and it is reused by the next thread needing a chunk.
+	* Once the chunk of a thread is full (or when there are more than MAX_POOL_THREADS living threads), a classical allocation
+	* (new/delete) is performed.
+	*/
+	template<class BaseType> class ThreadLocalFixedSizePool
+	{
+		public:
+			ThreadLocalFixedSizePool(const std::string &, unsigned int, unsigned int);
+			~ThreadLocalFixedSizePool();
+
+			void* allocate(unsigned int);
+			void free(BaseType *ptr);
+
+			unsigned int getNumberThreadChunks() const;
+			unsigned int getThreadUsage(unsigned int) const;
+			unsigned int getThreadHighWaterMark(unsigned int) const;
+			unsigned int getHighWaterMark() const;
+			unsigned int getOverflowCount() const;
+			unsigned int getRemoteFreeCount() const;
+
+			void updateProfilerCounters(const std::string &) const;
+
+		private:
+			struct ThreadChunk
+			{
+				std::atomic<std::thread::id> ownerThreadId; //default thread id when chunk is released
+				unsigned char *memory;
+				void *localFreeList; //only accessed by the owner thread
+				std::atomic<void *> remoteFreeList;
+				std::atomic<unsigned int> usedCount;
+				std::atomic<unsigned int> highWaterMark;
+			};
+
+			ThreadChunk *getThreadChunk();
+			ThreadChunk *createThreadChunk();
+			ThreadChunk *acquireReleasedThreadChunk();
+			void releaseAtThreadExit(ThreadChunk *) const;
+			ThreadChunk *findChunkContaining(const void *) const;
+			void logPoolIsFull();
+
+			struct ThreadChunksReleaser
+			{
+				~ThreadChunksReleaser();
+
+				std::vector<std::pair<unsigned int, ThreadChunk *>> poolThreadChunks;
+			};
+
+			static std::atomic<unsigned int> nextPoolId;
+			static std::mutex livePoolsMutex;
+			static std::set<unsigned int> livePoolIds;
+			const unsigned int poolId;
+
+			std::string poolName;
+			unsigned int maxElementSize;
+			unsigned int maxElementsByThread;
+
+			std::atomic<ThreadChunk *> threadChunks[MAX_POOL_THREADS];
+			std::atomic<unsigned int> threadChunksCount;
+
+			std::atomic<unsigned int> overflowCount;
+			std::atomic<unsigned int> remoteFreeCount;
+			std::atomic<bool> fullPoolLogged;
+	};
+
+	#include "ThreadLocalFixedSizePool.inl"
+
+}
+
+#endif
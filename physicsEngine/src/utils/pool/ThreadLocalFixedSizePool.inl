@@ -0,0 +1,344 @@
+//static
+template<class BaseType> std::atomic<unsigned int> ThreadLocalFixedSizePool<BaseType>::nextPoolId(1);
+template<class BaseType> std::mutex ThreadLocalFixedSizePool<BaseType>::livePoolsMutex;
+template<class BaseType> std::set<unsigned int> ThreadLocalFixedSizePool<BaseType>::livePoolIds;
+
+/**
+ * Release the chunks of the thread when it exits: chunks of pools still alive can be reused by other threads.
+ */
+template<class BaseType> ThreadLocalFixedSizePool<BaseType>::ThreadChunksReleaser::~ThreadChunksReleaser()
+{
+	std::lock_guard<std::mutex> lock(livePoolsMutex);
+	for(const auto &poolThreadChunk : poolThreadChunks)
+	{
+		if(livePoolIds.find(poolThreadChunk.first) != livePoolIds.end())
+		{
+			poolThreadChunk.second->ownerThreadId.store(std::thread::id(), std::memory_order_release);
+		}
+	}
+}
+
+/**
+ * @param maxElementSize Size of element to store in pool. If there are several classes which extends 'BaseType', the biggest one
+ *  should be provided
+ * @param maxElementsByThread Maximum of elements which can be stored in the chunk of each thread. If the maximum is exceed,
+ *  a classical allocation (new/delete) will be performed.
+ */
+template<class BaseType> ThreadLocalFixedSizePool<BaseType>::ThreadLocalFixedSizePool(const std::string &poolName, unsigned int maxElementSize, unsigned int maxElementsByThread) :
+		poolId(nextPoolId.fetch_add(1)),
+		poolName(poolName),
+		maxElementSize(std::max(maxElementSize, (unsigned int)sizeof(void *))),
+		maxElementsByThread(maxElementsByThread),
+		threadChunksCount(0),
+		overflowCount(0),
+		remoteFreeCount(0),
+		fullPoolLogged(false)
+{
+	for(auto &threadChunk : threadChunks)
+	{
+		threadChunk.store(nullptr);
+	}
+
+	std::lock_guard<std::mutex> lock(livePoolsMutex);
+	livePoolIds.insert(poolId);
+}
+
+template<class BaseType> ThreadLocalFixedSizePool<BaseType>::~ThreadLocalFixedSizePool()
+{
+	{
+		std::lock_guard<std::mutex> lock(livePoolsMutex);
+		livePoolIds.erase(poolId);
+	}
+
+	for(unsigned int i=0; i<getNumberThreadChunks(); ++i)
+	{
+		ThreadChunk *threadChunk = threadChunks[i].load();
+		if(threadChunk->usedCount.load() != 0) //ensure that 'free' method has been called
+		{
+			Logger::logger().logError("Thread local fixed size pool '" + poolName + "' not correctly cleared. Used count: " + std::to_string(threadChunk->usedCount.load())
+					+ ", thread chunk: " + std::to_string(i) + ".");
+		}
+
+		operator delete(threadChunk->memory);
+		delete threadChunk;
+	}
+}
+
+/**
+ * @return Memory pointer which can be used to instantiate an element.
+ */
+template<class BaseType> void* ThreadLocalFixedSizePool<BaseType>::allocate(unsigned int size)
+{
+	if(size > maxElementSize)
+	{
+		throw std::runtime_error("Thread local fixed size pool '" + poolName + "' cannot allocate " + std::to_string(size) + " bytes because max allowed allocation is " + std::to_string(maxElementSize) + " bytes");
+	}
+
+	ThreadChunk *threadChunk = getThreadChunk();
+	if(threadChunk)
+	{
+		if(!threadChunk->localFreeList)
+		{ //take back the elements freed by the other threads
+			threadChunk->localFreeList = threadChunk->remoteFreeList.exchange(nullptr, std::memory_order_acquire);
+		}
+
+		if(threadChunk->localFreeList)
+		{ //chunk is not full
+			void *result = threadChunk->localFreeList;
+			threadChunk->localFreeList = *(void**)result;
+
+			unsigned int usedCount = threadChunk->usedCount.fetch_add(1, std::memory_order_relaxed) + 1;
+			if(usedCount > threadChunk->highWaterMark.load(std::memory_order_relaxed))
+			{ //only updated by the owner thread
+				threadChunk->highWaterMark.store(usedCount, std::memory_order_relaxed);
+			}
+
+			return result;
+		}
+	}
+
+	//chunk is full: allocate new memory location
+	overflowCount.fetch_add(1, std::memory_order_relaxed);
+	logPoolIsFull();
+	return operator new(maxElementSize);
+}
+
+/**
+ * Call destructor of pointer and free location in the pool. The pointer can be freed by another thread than the one which
+ * allocated it.
+ * @param ptr Pointer to free
+ */
+template<class BaseType> void ThreadLocalFixedSizePool<BaseType>::free(BaseType *ptr)
+{
+	ptr->~BaseType(); //destructor called first because it can free other elements of this pool
+
+	ThreadChunk *threadChunk = findChunkContaining(ptr);
+	if(!threadChunk)
+	{
+		operator delete(ptr);
+		return;
+	}
+
+	if(threadChunk->ownerThreadId.load(std::memory_order_relaxed) == std::this_thread::get_id())
+	{
+		*(void**)ptr = threadChunk->localFreeList;
+		threadChunk->localFreeList = ptr;
+	}else
+	{ //lock-free push in the remote free list of the owner thread
+		void *remoteFreeListHead = threadChunk->remoteFreeList.load(std::memory_order_relaxed);
+		do
+		{
+			*(void**)ptr = remoteFreeListHead;
+		} while(!threadChunk->remoteFreeList.compare_exchange_weak(remoteFreeListHead, ptr, std::memory_order_release, std::memory_order_relaxed));
+
+		remoteFreeCount.fetch_add(1, std::memory_order_relaxed);
+	}
+	threadChunk->usedCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+template<class BaseType> unsigned int ThreadLocalFixedSizePool<BaseType>::getNumberThreadChunks() const
+{
+	return std::min(threadChunksCount.load(), (unsigned int)MAX_POOL_THREADS);
+}
+
+/**
+ * @return Number of elements currently allocated in the chunk of the thread
+ */
+template<class BaseType> unsigned int ThreadLocalFixedSizePool<BaseType>::getThreadUsage(unsigned int threadChunkIndex) const
+{
+	ThreadChunk *threadChunk = threadChunks[threadChunkIndex].load();
+	return threadChunk ? threadChunk->usedCount.load(std::memory_order_relaxed) : 0;
+}
+
+/**
+ * @return Maximum of elements allocated at the same time in the chunk of the thread
+ */
+template<class BaseType> unsigned int ThreadLocalFixedSizePool<BaseType>::getThreadHighWaterMark(unsigned int threadChunkIndex) const
+{
+	ThreadChunk *threadChunk = threadChunks[threadChunkIndex].load();
+	return threadChunk ? threadChunk->highWaterMark.load(std::memory_order_relaxed) : 0;
+}
+
+/**
+ * @return Highest high-water mark of the threads chunks. A value equals to the maximum of elements by thread means that
+ * the pool size should be increased.
+ */
+template<class BaseType> unsigned int ThreadLocalFixedSizePool<BaseType>::getHighWaterMark() const
+{
+	unsigned int highWaterMark = 0;
+	for(unsigned int i=0; i<getNumberThreadChunks(); ++i)
+	{
+		highWaterMark = std::max(highWaterMark, getThreadHighWaterMark(i));
+	}
+	return highWaterMark;
+}
+
+/**
+ * @return Number of allocations performed outside the pool because the chunk of the thread was full
+ */
+template<class BaseType> unsigned int ThreadLocalFixedSizePool<BaseType>::getOverflowCount() const
+{
+	return overflowCount.load(std::memory_order_relaxed);
+}
+
+/**
+ * @return Number of elements freed by another thread than the one which allocated them
+ */
+template<class BaseType> unsigned int ThreadLocalFixedSizePool<BaseType>::getRemoteFreeCount() const
+{
+	return remoteFreeCount.load(std::memory_order_relaxed);
+}
+
+/**
+ * Update the counters of the pool in the profiler. Counters are logged with the profiling result. Nothing is done when the
+ * profiler is disabled: method can be called at each step.
+ * @param profilerInstanceName Name of the profiler instance
+ */
+template<class BaseType> void ThreadLocalFixedSizePool<BaseType>::updateProfilerCounters(const std::string &profilerInstanceName) const
+{
+	std::shared_ptr<Profiler> profiler = Profiler::getInstance(profilerInstanceName);
+	if(!profiler->isEnabled())
+	{
+		return;
+	}
+
+	profiler->updateCounter(poolName + ".highWaterMark", getHighWaterMark());
+	profiler->updateCounter(poolName + ".overflowCount", getOverflowCount());
+	profiler->updateCounter(poolName + ".remoteFreeCount", getRemoteFreeCount());
+	for(unsigned int i=0; i<getNumberThreadChunks(); ++i)
+	{
+		profiler->updateCounter(poolName + ".thread" + std::to_string(i) + ".usage", getThreadUsage(i));
+		profiler->updateCounter(poolName + ".thread" + std::to_string(i) + ".highWaterMark", getThreadHighWaterMark(i));
+	}
+}
+
+/**
+ * @return Chunk of the current thread or null when the maximum of threads is reached
+ */
+template<class BaseType> typename ThreadLocalFixedSizePool<BaseType>::ThreadChunk *ThreadLocalFixedSizePool<BaseType>::getThreadChunk()
+{
+	thread_local unsigned int cachedPoolId = 0;
+	thread_local ThreadChunk *cachedThreadChunk = nullptr;
+
+	if(cachedPoolId != poolId)
+	{ //first use of this pool by the thread or thread alternates between several pools
+		cachedThreadChunk = nullptr;
+		for(unsigned int i=0; i<getNumberThreadChunks(); ++i)
+		{
+			ThreadChunk *threadChunk = threadChunks[i].load();
+			if(threadChunk && threadChunk->ownerThreadId.load(std::memory_order_relaxed) == std::this_thread::get_id())
+			{
+				cachedThreadChunk = threadChunk;
+				break;
+			}
+		}
+
+		if(!cachedThreadChunk)
+		{
+			cachedThreadChunk = acquireReleasedThreadChunk();
+		}
+		if(!cachedThreadChunk)
+		{
+			cachedThreadChunk = createThreadChunk();
+		}
+		if(cachedThreadChunk)
+		{
+			releaseAtThreadExit(cachedThreadChunk);
+		}
+		cachedPoolId = poolId;
+	}
+
+	return cachedThreadChunk;
+}
+
+template<class BaseType> typename ThreadLocalFixedSizePool<BaseType>::ThreadChunk *ThreadLocalFixedSizePool<BaseType>::createThreadChunk()
+{
+	if(maxElementsByThread == 0)
+	{
+		return nullptr;
+	}
+
+	unsigned int threadChunkIndex = threadChunksCount.fetch_add(1);
+	if(threadChunkIndex >= MAX_POOL_THREADS)
+	{
+		return nullptr;
+	}
+
+	auto *threadChunk = new ThreadChunk();
+	threadChunk->ownerThreadId.store(std::this_thread::get_id());
+	threadChunk->memory = static_cast<unsigned char *>(operator new(maxElementSize * maxElementsByThread));
+	threadChunk->remoteFreeList.store(nullptr);
+	threadChunk->usedCount.store(0);
+	threadChunk->highWaterMark.store(0);
+
+	//initialize chunk: each element contains address of next element and last one contains 0
+	unsigned char *p = threadChunk->memory;
+	for(unsigned int i=0; i<maxElementsByThread - 1; ++i)
+	{
+		*(void**)p = (p + maxElementSize);
+		p += maxElementSize;
+	}
+	*(void**)p = nullptr;
+	threadChunk->localFreeList = threadChunk->memory;
+
+	threadChunks[threadChunkIndex].store(threadChunk);
+	return threadChunk;
+}
+
+/**
+ * @return Chunk released by an exited thread and now owned by the current thread or null when there is no released chunk
+ */
+template<class BaseType> typename ThreadLocalFixedSizePool<BaseType>::ThreadChunk *ThreadLocalFixedSizePool<BaseType>::acquireReleasedThreadChunk()
+{
+	for(unsigned int i=0; i<getNumberThreadChunks(); ++i)
+	{
+		ThreadChunk *threadChunk = threadChunks[i].load();
+		std::thread::id releasedThreadId;
+		if(threadChunk && threadChunk->ownerThreadId.compare_exchange_strong(releasedThreadId, std::this_thread::get_id(), std::memory_order_acquire))
+		{ //local free list of the exited thread is taken over by the current thread
+			return threadChunk;
+		}
+	}
+	return nullptr;
+}
+
+template<class BaseType> void ThreadLocalFixedSizePool<BaseType>::releaseAtThreadExit(ThreadChunk *threadChunk) const
+{
+	thread_local ThreadChunksReleaser threadChunksReleaser;
+	for(const auto &poolThreadChunk : threadChunksReleaser.poolThreadChunks)
+	{
+		if(poolThreadChunk.first == poolId)
+		{
+			return;
+		}
+	}
+	threadChunksReleaser.poolThreadChunks.emplace_back(std::make_pair(poolId, threadChunk));
+}
+
+template<class BaseType> typename ThreadLocalFixedSizePool<BaseType>::ThreadChunk *ThreadLocalFixedSizePool<BaseType>::findChunkContaining(const void *ptr) const
+{
+	auto *bytePtr = static_cast<const unsigned char *>(ptr);
+	for(unsigned int i=0; i<getNumberThreadChunks(); ++i)
+	{
+		ThreadChunk *threadChunk = threadChunks[i].load(std::memory_order_acquire);
+		if(threadChunk && bytePtr >= threadChunk->memory && bytePtr < threadChunk->memory + maxElementSize * maxElementsByThread)
+		{
+			return threadChunk;
+		}
+	}
+	return nullptr;
+}
+
+template<class BaseType> void ThreadLocalFixedSizePool<BaseType>::logPoolIsFull()
+{
+	if(!fullPoolLogged.exchange(true))
+	{
+		std::stringstream logStream;
+		logStream << "Thread local pool is full of elements." << std::endl;
+		logStream << " - Pool name: " << poolName << std::endl;
+		logStream << " - Element size: " << maxElementSize << std::endl;
+		logStream << " - Maximum elements by thread: " << maxElementsByThread << std::endl;
+		logStream << " - Number of threads: " << threadChunksCount.load();
+		Logger::logger().logWarning(logStream.str());
+	}
+}
@@ -11,6 +11,7 @@ namespace urchin
 	SoundManager::SoundManager()
 	{
 		DeviceManager::instance();
+		Profiler::getInstance("sound"); //main thread is the profiled thread: stream update worker thread is only traced
         streamUpdateWorker = new StreamUpdateWorker();
         streamUpdateWorkerThread = new std::thread(&StreamUpdateWorker::start, streamUpdateWorker);
 
@@ -116,6 +116,7 @@ namespace urchin
 			while (continueExecution())
 			{
 				{
+					ScopeProfiler profiler("sound", "streamUpdate");
 					std::lock_guard<std::mutex> lock(tasksMutex);
 
 					for (auto it = tasks.begin(); it != tasks.end();)
@@ -1,6 +1,7 @@
 #include <cppunit/ui/text/TestRunner.h>
 
 #include "common/system/FileHandlerTest.h"
+#include "common/tools/profiler/ProfilerTest.h"
 #include "common/math/algebra/QuaternionTest.h"
 #include "common/math/geometry/OrthogonalProjectionTest.h"
 #include "common/math/geometry/ClosestPointTest.h"
@@ -12,8 +13,14 @@
 #include "common/math/geometry/SortPointsTest.h"
 #include "physics/shape/ShapeToAABBoxTest.h"
 #include "physics/shape/ShapeToConvexObjectTest.h"
+#include "physics/shape/HeightfieldShapeQueryTest.h"
+#include "physics/shape/CompoundChildrenBVHTest.h"
 #include "physics/object/SupportPointTest.h"
 #include "physics/body/InertiaCalculationTest.h"
+#include "physics/body/TransformDoubleBufferTest.h"
+#include "physics/body/BodyStateStoreTest.h"
+#include "physics/body/WorkBodyShapeCacheTest.h"
+#include "physics/collision/broadphase/HashPairContainerTest.h"
 #include "physics/collision/broadphase/aabbtree/BodyAABBTreeTest.h"
 #include "physics/collision/narrowphase/algorithm/gjk/GJKBoxTest.h"
 #include "physics/collision/narrowphase/algorithm/gjk/GJKConvexHullTest.h"
@@ -24,7 +31,18 @@
 #include "physics/collision/narrowphase/algorithm/epa/EPAConvexHullTest.h"
 #include "physics/collision/narrowphase/algorithm/epa/EPAConvexObjectTest.h"
 #include "physics/collision/island/IslandContainerTest.h"
+#include "physics/collision/island/IslandManagerTest.h"
+#include "physics/collision/constraintsolver/WarmStartCacheTest.h"
+#include "physics/utils/pool/ThreadLocalFixedSizePoolTest.h"
+#include "physics/processable/raytest/RayBatchTesterTest.h"
+#include "physics/PhysicsWorldTest.h"
 #include "physics/it/FallingObjectIT.h"
+#include "physics/collision/broadphase/BroadPhaseBenchmark.h"
+#include "physics/collision/narrowphase/NarrowPhaseBenchmark.h"
+#include "physics/collision/narrowphase/algorithm/GJKEPABenchmark.h"
+#include "physics/processable/raytest/RayBatchTesterBenchmark.h"
+#include "physics/character/CharacterControllerBenchmark.h"
+#include "physics/PhysicsWorldBenchmark.h"
 #include "ai/path/navmesh/csg/CSGPolygonTest.h"
 #include "ai/path/navmesh/csg/PolygonsUnionTest.h"
 #include "ai/path/navmesh/csg/PolygonsSubtractionTest.h"
@@ -32,15 +50,24 @@
 #include "ai/path/navmesh/triangulation/TriangulationTest.h"
 #include "ai/path/navmesh/polytope/services/TerrainObstacleServiceTest.h"
 #include "ai/path/navmesh/jump/EdgeLinkDetectionTest.h"
+#include "ai/path/navmesh/model/output/NavTriangleGridTest.h"
 #include "ai/path/navmesh/NavMeshGeneratorTest.h"
 #include "ai/path/pathfinding/FunnelAlgorithmTest.h"
+#include "ai/path/pathfinding/IncrementalFunnelAlgorithmTest.h"
+#include "ai/path/pathfinding/PathNodeHeapTest.h"
+#include "ai/path/pathfinding/hierarchical/NavPolygonGraphTest.h"
 #include "ai/path/pathfinding/PathfindingAStarTest.h"
+#include "ai/path/pathfinding/PathfindingAStarBenchmark.h"
+#include "ai/path/PathRequestProcessorTest.h"
 
 void commonTests(CppUnit::TextUi::TestRunner &runner)
 {
     //system - file
     runner.addTest(FileHandlerTest::suite());
 
+    //tools - profiler
+    runner.addTest(ProfilerTest::suite());
+
     //math - algebra
     runner.addTest(QuaternionTest::suite());
 
@@ -60,14 +87,20 @@ void physicsTests(CppUnit::TextUi::TestRunner &runner)
     //shape
     runner.addTest(ShapeToAABBoxTest::suite());
     runner.addTest(ShapeToConvexObjectTest::suite());
+    runner.addTest(HeightfieldShapeQueryTest::suite());
+    runner.addTest(CompoundChildrenBVHTest::suite());
 
     //object
     runner.addTest(SupportPointTest::suite());
 
     //body
     runner.addTest(InertiaCalculationTest::suite());
+    runner.addTest(TransformDoubleBufferTest::suite());
+    runner.addTest(BodyStateStoreTest::suite());
+    runner.addTest(WorkBodyShapeCacheTest::suite());
 
     //broad phase
+    runner.addTest(HashPairContainerTest::suite());
     runner.addTest(BodyAABBTreeTest::suite());
 
     //narrow phase
@@ -82,6 +115,19 @@ void physicsTests(CppUnit::TextUi::TestRunner &runner)
 
     //island
     runner.addTest(IslandContainerTest::suite());
+    runner.addTest(IslandManagerTest::suite());
+
+    //constraint solver
+    runner.addTest(WarmStartCacheTest::suite());
+
+    //pool
+    runner.addTest(ThreadLocalFixedSizePoolTest::suite());
+
+    //processable
+    runner.addTest(RayBatchTesterTest::suite());
+
+    //world
+    runner.addTest(PhysicsWorldTest::suite());
 
     //integration tests (IT)
     runner.addTest(FallingObjectIT::suite());
@@ -97,21 +143,46 @@ void aiTests(CppUnit::TextUi::TestRunner &runner)
     runner.addTest(TriangulationTest::suite());
     runner.addTest(TerrainObstacleServiceTest::suite());
     runner.addTest(EdgeLinkDetectionTest::suite());
+    runner.addTest(NavTriangleGridTest::suite());
     runner.addTest(NavMeshGeneratorTest::suite());
 
     //pathfinding
     runner.addTest(FunnelAlgorithmTest::suite());
+    runner.addTest(IncrementalFunnelAlgorithmTest::suite());
+    runner.addTest(PathNodeHeapTest::suite());
+    runner.addTest(NavPolygonGraphTest::suite());
     runner.addTest(PathfindingAStarTest::suite());
+    runner.addTest(PathRequestProcessorTest::suite());
+}
+
+void benchmarkTests(CppUnit::TextUi::TestRunner &runner)
+{
+    //physics
+    runner.addTest(BroadPhaseBenchmark::suite());
+    runner.addTest(NarrowPhaseBenchmark::suite());
+    runner.addTest(GJKEPABenchmark::suite());
+    runner.addTest(RayBatchTesterBenchmark::suite());
+    runner.addTest(CharacterControllerBenchmark::suite());
+    runner.addTest(PhysicsWorldBenchmark::suite());
+
+    //ai
+    runner.addTest(PathfindingAStarBenchmark::suite());
 }
 
-int main()
+int main(int argc, char *argv[])
 {
 	urchin::ConfigService::instance()->loadProperties("resources/engine.properties");
 
     CppUnit::TextUi::TestRunner runner;
-    commonTests(runner);
-    physicsTests(runner);
-    aiTests(runner);
+    if(argc > 1 && std::string(argv[1]) == "benchmark")
+    {
+        benchmarkTests(runner);
+    }else
+    {
+        commonTests(runner);
+        physicsTests(runner);
+        aiTests(runner);
+    }
 	runner.run();
 
 	urchin::SingletonManager::destroyAllSingletons();
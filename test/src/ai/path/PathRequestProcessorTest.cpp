@@ -0,0 +1,156 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <thread>
+#include <atomic>
+
+#include "PathRequestProcessorTest.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void PathRequestProcessorTest::processAllRequests()
+{
+    std::shared_ptr<NavMesh> navMesh = buildNavMesh();
+    std::vector<std::shared_ptr<PathRequest>> pathRequests = buildPathRequests(5);
+    PathRequestProcessor pathRequestProcessor;
+    pathRequestProcessor.setNumThreads(1);
+    pathRequestProcessor.setTimeBudget(0.0f);
+
+    unsigned int numberProcessedRequests = pathRequestProcessor.processPathRequests(navMesh, pathRequests);
+
+    AssertHelper::assertUnsignedInt(numberProcessedRequests, 5);
+    for(const auto &pathRequest : pathRequests)
+    {
+        AssertHelper::assertTrue(pathRequest->isPathReady());
+        AssertHelper::assertUnsignedInt(pathRequest->getPath().size(), 2);
+    }
+}
+
+void PathRequestProcessorTest::processByPriority()
+{
+    std::shared_ptr<NavMesh> navMesh = buildNavMesh();
+    std::vector<std::shared_ptr<PathRequest>> pathRequests = buildPathRequests(3);
+    std::shared_ptr<PathRequest> lowPriorityRequest = pathRequests[0];
+    std::shared_ptr<PathRequest> highPriorityRequest = pathRequests[2];
+    highPriorityRequest->setPriority(10);
+    PathRequestProcessor pathRequestProcessor;
+    pathRequestProcessor.setNumThreads(1);
+    pathRequestProcessor.setTimeBudget(0.000000001f); //only one request processed by call
+
+    unsigned int numberProcessedRequests = pathRequestProcessor.processPathRequests(navMesh, pathRequests);
+
+    AssertHelper::assertUnsignedInt(numberProcessedRequests, 1);
+    AssertHelper::assertTrue(highPriorityRequest->isPathReady());
+    AssertHelper::assertTrue(!lowPriorityRequest->isPathReady());
+}
+
+void PathRequestProcessorTest::processOldestRequestsFirst()
+{
+    std::shared_ptr<NavMesh> navMesh = buildNavMesh();
+    std::vector<std::shared_ptr<PathRequest>> pathRequests = buildPathRequests(3);
+    std::vector<std::shared_ptr<PathRequest>> initialPathRequests = pathRequests;
+    PathRequestProcessor pathRequestProcessor;
+    pathRequestProcessor.setNumThreads(1);
+    pathRequestProcessor.setTimeBudget(0.000000001f); //only one request processed by call
+
+    for(unsigned int i = 0; i < 3; ++i)
+    {
+        AssertHelper::assertTrue(!initialPathRequests[i]->isPathReady());
+        pathRequestProcessor.processPathRequests(navMesh, pathRequests);
+        AssertHelper::assertTrue(initialPathRequests[i]->isPathReady());
+    }
+    unsigned int firstRequestProcessingId = initialPathRequests[0]->getProcessingId();
+    pathRequestProcessor.processPathRequests(navMesh, pathRequests);
+
+    AssertHelper::assertTrue(initialPathRequests[0]->getProcessingId() > firstRequestProcessingId); //processed again before the others
+    AssertHelper::assertTrue(initialPathRequests[1]->getProcessingId() < initialPathRequests[2]->getProcessingId());
+}
+
+void PathRequestProcessorTest::processInParallel()
+{
+    std::shared_ptr<NavMesh> navMesh = buildNavMesh();
+    std::vector<std::shared_ptr<PathRequest>> pathRequests = buildPathRequests(20);
+    PathRequestProcessor pathRequestProcessor;
+    pathRequestProcessor.setNumThreads(4);
+    pathRequestProcessor.setTimeBudget(0.0f);
+
+    unsigned int numberProcessedRequests = pathRequestProcessor.processPathRequests(navMesh, pathRequests);
+
+    AssertHelper::assertUnsignedInt(pathRequestProcessor.getNumThreads(), 4);
+    AssertHelper::assertUnsignedInt(numberProcessedRequests, 20);
+    for(const auto &pathRequest : pathRequests)
+    {
+        AssertHelper::assertTrue(pathRequest->isPathReady());
+        std::vector<PathPoint> path = pathRequest->getPath();
+        AssertHelper::assertUnsignedInt(path.size(), 2);
+        AssertHelper::assertPoint3FloatEquals(path[0].getPoint(), pathRequest->getStartPoint());
+        AssertHelper::assertPoint3FloatEquals(path[1].getPoint(), pathRequest->getEndPoint());
+    }
+}
+
+void PathRequestProcessorTest::updateConfigurationDuringProcessing()
+{
+    std::shared_ptr<NavMesh> navMesh = buildNavMesh();
+    std::vector<std::shared_ptr<PathRequest>> pathRequests = buildPathRequests(20);
+    PathRequestProcessor pathRequestProcessor;
+    pathRequestProcessor.setTimeBudget(0.0f);
+    std::atomic_bool processingDone(false);
+
+    std::thread configurationThread([&]() {
+        for(unsigned int i = 0; !processingDone.load(); ++i)
+        {
+            pathRequestProcessor.setNumThreads(1 + i % 4);
+            pathRequestProcessor.setHierarchicalSearch(i % 2 == 0);
+            std::this_thread::yield();
+        }
+    });
+    unsigned int numberProcessedRequests = 0;
+    for(unsigned int i = 0; i < 50; ++i)
+    {
+        numberProcessedRequests += pathRequestProcessor.processPathRequests(navMesh, pathRequests);
+    }
+    processingDone.store(true);
+    configurationThread.join();
+
+    AssertHelper::assertUnsignedInt(numberProcessedRequests, 50 * 20);
+    pathRequestProcessor.setNumThreads(3);
+    AssertHelper::assertUnsignedInt(pathRequestProcessor.getNumThreads(), 3);
+}
+
+std::shared_ptr<NavMesh> PathRequestProcessorTest::buildNavMesh()
+{
+    std::vector<Point3<float>> polygonPoints = {Point3<float>(0.0f, 0.0f, 0.0f), Point3<float>(0.0f, 0.0f, 4.0f), Point3<float>(4.0f, 0.0f, 4.0f), Point3<float>(4.0f, 0.0f, 0.0f)};
+    auto navPolygon = std::make_shared<NavPolygon>("polyTestName", std::move(polygonPoints), nullptr);
+    auto navTriangle1 = std::make_shared<NavTriangle>(0, 1, 3);
+    auto navTriangle2 = std::make_shared<NavTriangle>(1, 2, 3);
+    navPolygon->addTriangles({navTriangle1, navTriangle2}, navPolygon);
+    navTriangle1->addStandardLink(1, navTriangle2);
+    navTriangle2->addStandardLink(2, navTriangle1);
+
+    auto navMesh = std::make_shared<NavMesh>();
+    navMesh->copyAllPolygons({navPolygon});
+    return navMesh;
+}
+
+std::vector<std::shared_ptr<PathRequest>> PathRequestProcessorTest::buildPathRequests(unsigned int numberRequests)
+{
+    std::vector<std::shared_ptr<PathRequest>> pathRequests;
+    for(unsigned int i = 0; i < numberRequests; ++i)
+    {
+        float offset = 0.1f * (float)i / (float)numberRequests;
+        pathRequests.push_back(std::make_shared<PathRequest>(Point3<float>(1.0f + offset, 0.0f, 1.0f), Point3<float>(3.0f, 0.0f, 3.0f - offset)));
+    }
+    return pathRequests;
+}
+
+CppUnit::Test *PathRequestProcessorTest::suite()
+{
+    auto *suite = new CppUnit::TestSuite("PathRequestProcessorTest");
+
+    suite->addTest(new CppUnit::TestCaller<PathRequestProcessorTest>("processAllRequests", &PathRequestProcessorTest::processAllRequests));
+    suite->addTest(new CppUnit::TestCaller<PathRequestProcessorTest>("processByPriority", &PathRequestProcessorTest::processByPriority));
+    suite->addTest(new CppUnit::TestCaller<PathRequestProcessorTest>("processOldestRequestsFirst", &PathRequestProcessorTest::processOldestRequestsFirst));
+    suite->addTest(new CppUnit::TestCaller<PathRequestProcessorTest>("processInParallel", &PathRequestProcessorTest::processInParallel));
+    suite->addTest(new CppUnit::TestCaller<PathRequestProcessorTest>("updateConfigurationDuringProcessing", &PathRequestProcessorTest::updateConfigurationDuringProcessing));
+
+    return suite;
+}
@@ -0,0 +1,25 @@
+#ifndef URCHINENGINE_PATHREQUESTPROCESSORTEST_H
+#define URCHINENGINE_PATHREQUESTPROCESSORTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include <memory>
+#include "UrchinAIEngine.h"
+
+class PathRequestProcessorTest : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void processAllRequests();
+        void processByPriority();
+        void processOldestRequestsFirst();
+        void processInParallel();
+        void updateConfigurationDuringProcessing();
+
+    private:
+        std::shared_ptr<urchin::NavMesh> buildNavMesh();
+        std::vector<std::shared_ptr<urchin::PathRequest>> buildPathRequests(unsigned int);
+};
+
+#endif
@@ -105,15 +105,15 @@ void NavMeshGeneratorTest::holeAndCrossingHoleOnWalkableFace()
     std::shared_ptr<NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
 
     AssertHelper::assertUnsignedInt(navMesh->getPolygons().size(), 4);
-    AssertHelper::assertTrue(navMesh->getPolygons()[0]->getName()=="<hole[2]>");
-    AssertHelper::assertTrue(navMesh->getPolygons()[1]->getName()=="<[walkableFace[2]] - [crossingHole]{0}> - <hole>");
-    AssertHelper::assertUnsignedInt(navMesh->getPolygons()[1]->getPoints().size(), 8);
-    AssertHelper::assertUnsignedInt(navMesh->getPolygons()[1]->getTriangles().size(), 8);
-    AssertHelper::assertTrue(navMesh->getPolygons()[2]->getName()=="<[walkableFace[2]] - [crossingHole]{1}>");
-    AssertHelper::assertPoint3FloatEquals(navMesh->getPolygons()[2]->getPoints()[0], Point3<float>(2.0, 0.01, 2.0));
-    AssertHelper::assertPoint3FloatEquals(navMesh->getPolygons()[2]->getPoints()[1], Point3<float>(2.0, 0.01, -2.0));
-    AssertHelper::assertPoint3FloatEquals(navMesh->getPolygons()[2]->getPoints()[2], Point3<float>(1.7, 0.01, -2.0));
-    AssertHelper::assertPoint3FloatEquals(navMesh->getPolygons()[2]->getPoints()[3], Point3<float>(1.7, 0.01, 2.0));
+    AssertHelper::assertTrue(navMesh->getPolygons()[0]->getName()=="<[walkableFace[2]] - [crossingHole]{0}> - <hole>");
+    AssertHelper::assertUnsignedInt(navMesh->getPolygons()[0]->getPoints().size(), 8);
+    AssertHelper::assertUnsignedInt(navMesh->getPolygons()[0]->getTriangles().size(), 8);
+    AssertHelper::assertTrue(navMesh->getPolygons()[1]->getName()=="<[walkableFace[2]] - [crossingHole]{1}>");
+    AssertHelper::assertPoint3FloatEquals(navMesh->getPolygons()[1]->getPoints()[0], Point3<float>(2.0, 0.01, 2.0));
+    AssertHelper::assertPoint3FloatEquals(navMesh->getPolygons()[1]->getPoints()[1], Point3<float>(2.0, 0.01, -2.0));
+    AssertHelper::assertPoint3FloatEquals(navMesh->getPolygons()[1]->getPoints()[2], Point3<float>(1.7, 0.01, -2.0));
+    AssertHelper::assertPoint3FloatEquals(navMesh->getPolygons()[1]->getPoints()[3], Point3<float>(1.7, 0.01, 2.0));
+    AssertHelper::assertTrue(navMesh->getPolygons()[2]->getName()=="<hole[2]>");
     AssertHelper::assertTrue(navMesh->getPolygons()[3]->getName()=="<crossingHole[2]>");
 }
 
@@ -189,9 +189,9 @@ void NavMeshGeneratorTest::linksRecreatedAfterMove()
     navMeshGenerator.setNavMeshAgent(buildNavMeshAgent());
 
     std::shared_ptr<NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
-    auto cube1MovingPolygon = navMesh->getPolygons()[0];
+    auto cube1MovingPolygon = navMesh->getPolygons()[2];
     auto cube2AffectedByMovePolygon = navMesh->getPolygons()[1];
-    auto cube3WitLinkToCube1Polygon = navMesh->getPolygons()[2];
+    auto cube3WitLinkToCube1Polygon = navMesh->getPolygons()[0];
 
     AssertHelper::assertUnsignedInt(navMesh->getPolygons().size(), 3);
     AssertHelper::assertString(cube1MovingPolygon->getName(), "<cube1[2]>");
@@ -202,9 +202,9 @@ void NavMeshGeneratorTest::linksRecreatedAfterMove()
     cube1Moving->updateTransform(Point3<float>(1.0, 1.5, 0.0), Quaternion<float>());
 
     navMesh = navMeshGenerator.generate(aiWorld);
-    auto newCube1MovingPolygon = navMesh->getPolygons()[2];
+    auto newCube1MovingPolygon = navMesh->getPolygons()[0];
     auto newCube2AffectedByMovePolygon = navMesh->getPolygons()[1];
-    auto newCube3WitLinkToCube1Polygon = navMesh->getPolygons()[0];
+    auto newCube3WitLinkToCube1Polygon = navMesh->getPolygons()[2];
 
     AssertHelper::assertUnsignedInt(navMesh->getPolygons().size(), 3);
     AssertHelper::assertString(newCube1MovingPolygon->getName(), "<cube1[2]>");
@@ -212,6 +212,31 @@ void NavMeshGeneratorTest::linksRecreatedAfterMove()
     AssertHelper::assertString(newCube3WitLinkToCube1Polygon->getName(), "<cube3[2]>");
     AssertHelper::assertUnsignedInt(countPolygonLinks(newCube3WitLinkToCube1Polygon, newCube2AffectedByMovePolygon), 1);
     AssertHelper::assertUnsignedInt(countPolygonLinks(newCube3WitLinkToCube1Polygon, cube2AffectedByMovePolygon), 0);
+    AssertHelper::assertUnsignedInt(newCube3WitLinkToCube1Polygon->getId(), cube3WitLinkToCube1Polygon->getId()); //polygon not regenerated...
+    AssertHelper::assertTrue(newCube3WitLinkToCube1Polygon->getLinksUpdateId() != cube3WitLinkToCube1Polygon->getLinksUpdateId()); //...but relinked
+}
+
+void NavMeshGeneratorTest::unchangedNavMesh()
+{
+    auto walkableShape = std::make_shared<AIShape>(std::make_shared<BoxShape<float>>(Vector3<float>(2.0, 0.01, 2.0)).get());
+    auto walkableFaceObject = std::make_shared<AIObject>("walkableFace", Transform<float>(Point3<float>(0.0, 0.0, 0.0)), true, walkableShape);
+    auto holeShape = std::make_shared<AIShape>(std::make_shared<BoxShape<float>>(Vector3<float>(1.0, 0.01, 1.0)).get());
+    auto holeObject = std::make_shared<AIObject>("hole", Transform<float>(Point3<float>(0.0, 1.0, 0.0)), true, holeShape);
+    AIWorld aiWorld;
+    aiWorld.addEntity(walkableFaceObject);
+    aiWorld.addEntity(holeObject);
+    NavMeshGenerator navMeshGenerator;
+    navMeshGenerator.setNavMeshAgent(buildNavMeshAgent());
+    NavPolygonGraph polygonGraph;
+
+    std::shared_ptr<NavMesh> navMesh = navMeshGenerator.generate(aiWorld);
+    unsigned int navMeshUpdateId = navMesh->getUpdateId();
+    polygonGraph.update(*navMesh);
+
+    navMesh = navMeshGenerator.generate(aiWorld);
+
+    AssertHelper::assertUnsignedInt(navMesh->getUpdateId(), navMeshUpdateId);
+    AssertHelper::assertUnsignedInt(polygonGraph.getNavMeshUpdateId(), navMesh->getUpdateId()); //no graph update required
 }
 
 unsigned int NavMeshGeneratorTest::countPolygonLinks(const std::shared_ptr<NavPolygon> &sourcePolygon, const std::shared_ptr<NavPolygon> &targetPolygon)
@@ -250,6 +275,7 @@ CppUnit::Test *NavMeshGeneratorTest::suite()
     suite->addTest(new CppUnit::TestCaller<NavMeshGeneratorTest>("removeHoleFromWalkableFace", &NavMeshGeneratorTest::removeHoleFromWalkableFace));
 
     suite->addTest(new CppUnit::TestCaller<NavMeshGeneratorTest>("linksRecreatedAfterMove", &NavMeshGeneratorTest::linksRecreatedAfterMove));
+    suite->addTest(new CppUnit::TestCaller<NavMeshGeneratorTest>("unchangedNavMesh", &NavMeshGeneratorTest::unchangedNavMesh));
 
     return suite;
 }
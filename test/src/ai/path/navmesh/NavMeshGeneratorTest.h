@@ -21,6 +21,7 @@ class NavMeshGeneratorTest : public CppUnit::TestFixture
         void removeHoleFromWalkableFace();
 
         void linksRecreatedAfterMove();
+        void unchangedNavMesh();
 
     private:
         unsigned int countPolygonLinks(const std::shared_ptr<urchin::NavPolygon> &sourcePolygon, const std::shared_ptr<urchin::NavPolygon> &targetPolygon);
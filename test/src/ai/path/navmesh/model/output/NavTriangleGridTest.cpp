@@ -0,0 +1,110 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <algorithm>
+
+#include "NavTriangleGridTest.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void NavTriangleGridTest::pointQueryInsideTriangles()
+{
+    auto navMesh = std::make_shared<NavMesh>();
+    navMesh->copyAllPolygons({buildSquarePolygon(Point3<float>(0.0f, 0.0f, 0.0f), 4.0f), buildSquarePolygon(Point3<float>(10.0f, 0.0f, 10.0f), 2.0f)});
+
+    std::vector<unsigned int> nearOriginTriangleIds;
+    navMesh->getTriangleGrid().pointQuery(Point2<float>(1.0f, 1.0f), nearOriginTriangleIds);
+    std::vector<unsigned int> farTriangleIds;
+    navMesh->getTriangleGrid().pointQuery(Point2<float>(11.5f, 11.5f), farTriangleIds);
+
+    AssertHelper::assertTrue(containsTriangleId(nearOriginTriangleIds, 0));
+    AssertHelper::assertTrue(!containsTriangleId(nearOriginTriangleIds, 2) && !containsTriangleId(nearOriginTriangleIds, 3));
+    AssertHelper::assertTrue(containsTriangleId(farTriangleIds, 3));
+    AssertHelper::assertTrue(!containsTriangleId(farTriangleIds, 0) && !containsTriangleId(farTriangleIds, 1));
+}
+
+void NavTriangleGridTest::pointQueryOutsideTriangles()
+{
+    auto navMesh = std::make_shared<NavMesh>();
+    navMesh->copyAllPolygons({buildSquarePolygon(Point3<float>(0.0f, 0.0f, 0.0f), 4.0f)});
+
+    std::vector<unsigned int> triangleIds;
+    navMesh->getTriangleGrid().pointQuery(Point2<float>(-1.0f, 1.0f), triangleIds);
+    navMesh->getTriangleGrid().pointQuery(Point2<float>(1.0f, 10.0f), triangleIds);
+
+    AssertHelper::assertUnsignedInt(triangleIds.size(), 0);
+}
+
+void NavTriangleGridTest::pointQueryOverlappingTriangles()
+{
+    auto navMesh = std::make_shared<NavMesh>();
+    navMesh->copyAllPolygons({buildSquarePolygon(Point3<float>(0.0f, 0.0f, 0.0f), 4.0f), buildSquarePolygon(Point3<float>(0.0f, 3.0f, 0.0f), 4.0f)});
+
+    std::vector<unsigned int> triangleIds;
+    navMesh->getTriangleGrid().pointQuery(Point2<float>(1.0f, 1.0f), triangleIds);
+
+    AssertHelper::assertTrue(containsTriangleId(triangleIds, 0));
+    AssertHelper::assertTrue(containsTriangleId(triangleIds, 2));
+    AssertHelper::assertTrue(std::is_sorted(triangleIds.begin(), triangleIds.end()));
+}
+
+/**
+ * Long polygon on X axis: grid has the maximum number of cells on X axis and the max bound is on the limit of the last cell
+ */
+void NavTriangleGridTest::pointQueryOnMaxBound()
+{
+    std::vector<Point3<float>> polygonPoints = {Point3<float>(0.0f, 0.0f, 0.0f), Point3<float>(0.0f, 0.0f, 0.001f),
+            Point3<float>(1024.0f, 0.0f, 0.001f), Point3<float>(1024.0f, 0.0f, 0.0f)};
+    auto navPolygon = std::make_shared<NavPolygon>("polyTestName", std::move(polygonPoints), nullptr);
+    navPolygon->addTriangles({std::make_shared<NavTriangle>(0, 1, 3), std::make_shared<NavTriangle>(1, 2, 3)}, navPolygon);
+    auto navMesh = std::make_shared<NavMesh>();
+    navMesh->copyAllPolygons({navPolygon});
+
+    std::vector<unsigned int> triangleIds;
+    navMesh->getTriangleGrid().pointQuery(Point2<float>(1024.0f, 0.0005f), triangleIds);
+
+    AssertHelper::assertTrue(containsTriangleId(triangleIds, 1));
+}
+
+void NavTriangleGridTest::gridSharedByCopies()
+{
+    auto navMesh = std::make_shared<NavMesh>();
+    navMesh->copyAllPolygons({buildSquarePolygon(Point3<float>(0.0f, 0.0f, 0.0f), 4.0f), buildSquarePolygon(Point3<float>(10.0f, 0.0f, 10.0f), 2.0f)});
+
+    NavMesh copiedNavMesh(*navMesh);
+    std::vector<unsigned int> farTriangleIds;
+    copiedNavMesh.getTriangleGrid().pointQuery(Point2<float>(11.5f, 11.5f), farTriangleIds);
+
+    AssertHelper::assertTrue(&copiedNavMesh.getTriangleGrid() == &navMesh->getTriangleGrid());
+    AssertHelper::assertTrue(containsTriangleId(farTriangleIds, 3));
+    AssertHelper::assertUnsignedInt(copiedNavMesh.getTriangles()[3]->getNavMeshId(), 3);
+}
+
+std::shared_ptr<NavPolygon> NavTriangleGridTest::buildSquarePolygon(const Point3<float> &origin, float size)
+{
+    std::vector<Point3<float>> polygonPoints = {origin, Point3<float>(origin.X, origin.Y, origin.Z + size),
+            Point3<float>(origin.X + size, origin.Y, origin.Z + size), Point3<float>(origin.X + size, origin.Y, origin.Z)};
+    auto navPolygon = std::make_shared<NavPolygon>("polyTestName", std::move(polygonPoints), nullptr);
+    auto navTriangle1 = std::make_shared<NavTriangle>(0, 1, 3);
+    auto navTriangle2 = std::make_shared<NavTriangle>(1, 2, 3);
+    navPolygon->addTriangles({navTriangle1, navTriangle2}, navPolygon);
+
+    return navPolygon;
+}
+
+bool NavTriangleGridTest::containsTriangleId(const std::vector<unsigned int> &triangleIds, unsigned int triangleId)
+{
+    return std::find(triangleIds.begin(), triangleIds.end(), triangleId) != triangleIds.end();
+}
+
+CppUnit::Test *NavTriangleGridTest::suite()
+{
+    auto *suite = new CppUnit::TestSuite("NavTriangleGridTest");
+
+    suite->addTest(new CppUnit::TestCaller<NavTriangleGridTest>("pointQueryInsideTriangles", &NavTriangleGridTest::pointQueryInsideTriangles));
+    suite->addTest(new CppUnit::TestCaller<NavTriangleGridTest>("pointQueryOutsideTriangles", &NavTriangleGridTest::pointQueryOutsideTriangles));
+    suite->addTest(new CppUnit::TestCaller<NavTriangleGridTest>("pointQueryOverlappingTriangles", &NavTriangleGridTest::pointQueryOverlappingTriangles));
+    suite->addTest(new CppUnit::TestCaller<NavTriangleGridTest>("pointQueryOnMaxBound", &NavTriangleGridTest::pointQueryOnMaxBound));
+    suite->addTest(new CppUnit::TestCaller<NavTriangleGridTest>("gridSharedByCopies", &NavTriangleGridTest::gridSharedByCopies));
+
+    return suite;
+}
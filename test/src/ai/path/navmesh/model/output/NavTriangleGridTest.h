@@ -0,0 +1,25 @@
+#ifndef URCHINENGINE_NAVTRIANGLEGRIDTEST_H
+#define URCHINENGINE_NAVTRIANGLEGRIDTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include <memory>
+#include "UrchinAIEngine.h"
+
+class NavTriangleGridTest : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void pointQueryInsideTriangles();
+        void pointQueryOutsideTriangles();
+        void pointQueryOverlappingTriangles();
+        void pointQueryOnMaxBound();
+        void gridSharedByCopies();
+
+    private:
+        std::shared_ptr<urchin::NavPolygon> buildSquarePolygon(const urchin::Point3<float> &, float);
+        bool containsTriangleId(const std::vector<unsigned int> &, unsigned int);
+};
+
+#endif
@@ -0,0 +1,114 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <cmath>
+#include "UrchinCommon.h"
+#include "UrchinAIEngine.h"
+
+#include "IncrementalFunnelAlgorithmTest.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void IncrementalFunnelAlgorithmTest::cornerPath()
+{
+    IncrementalFunnelAlgorithm incrementalFunnelAlgorithm;
+    std::shared_ptr<NavLink> navLink = NavLink::newStandardLink(0, nullptr); //link not used by the algorithm
+    PathNode startNode(nullptr, 0.0f, 0.0f);
+    incrementalFunnelAlgorithm.startFunnel(startNode, Point3<float>(1.0, 0.0, -1.0));
+    PathNode node(nullptr, 0.0f, 0.0f);
+    node.setPreviousNode(&startNode, navLink.get());
+    incrementalFunnelAlgorithm.addPortal(node, LineSegment3D<float>(Point3<float>(2.0, 0.0, 0.0), Point3<float>(0.0, 0.0, 0.0)));
+
+    float cost = incrementalFunnelAlgorithm.computeCost(node, Point3<float>(4.0, 0.0, 1.0));
+
+    AssertHelper::assertFloatEquals(cost, std::sqrt(2.0f) + std::sqrt(5.0f));
+}
+
+/**
+ * Cost computed after each portal must be equals to the path length computed by funnel algorithm from the start point.
+ */
+void IncrementalFunnelAlgorithmTest::zigzagPath()
+{
+    Point3<float> startPoint(1.0, 0.0, 0.0);
+    std::vector<LineSegment3D<float>> portals = {
+            LineSegment3D<float>(Point3<float>(2.0, 0.0, 1.0), Point3<float>(0.0, 0.0, 1.0)),
+            LineSegment3D<float>(Point3<float>(4.0, 0.0, 2.0), Point3<float>(2.5, 0.0, 2.0)),
+            LineSegment3D<float>(Point3<float>(4.5, 0.0, 3.0), Point3<float>(3.0, 0.0, 3.0)),
+            LineSegment3D<float>(Point3<float>(2.0, 0.0, 4.0), Point3<float>(0.0, 0.0, 4.0)),
+            LineSegment3D<float>(Point3<float>(1.5, 0.0, 5.0), Point3<float>(-0.5, 0.0, 5.0)),
+            LineSegment3D<float>(Point3<float>(5.0, 0.0, 6.0), Point3<float>(3.0, 0.0, 6.0)),
+            LineSegment3D<float>(Point3<float>(5.5, 0.0, 7.0), Point3<float>(4.0, 0.0, 7.0)),
+            LineSegment3D<float>(Point3<float>(1.0, 0.0, 8.0), Point3<float>(-1.0, 0.0, 8.0))};
+    std::vector<Point3<float>> endPoints = {Point3<float>(0.0, 0.0, 9.0), Point3<float>(6.0, 0.0, 9.0), Point3<float>(3.0, 0.0, 7.5)};
+
+    IncrementalFunnelAlgorithm incrementalFunnelAlgorithm;
+    std::shared_ptr<NavLink> navLink = NavLink::newStandardLink(0, nullptr); //link not used by the algorithm
+    std::vector<PathNode> pathNodes(portals.size() + 1, PathNode(nullptr, 0.0f, 0.0f));
+    incrementalFunnelAlgorithm.startFunnel(pathNodes[0], startPoint);
+    for(std::size_t i = 0; i < portals.size(); ++i)
+    {
+        pathNodes[i + 1].setPreviousNode(&pathNodes[i], navLink.get());
+        incrementalFunnelAlgorithm.addPortal(pathNodes[i + 1], portals[i]);
+
+        for(const auto &endPoint : endPoints)
+        {
+            float expectedCost = funnelPathLength(startPoint, portals, i + 1, endPoint);
+            AssertHelper::assertFloatEquals(incrementalFunnelAlgorithm.computeCost(pathNodes[i + 1], endPoint), expectedCost, 0.0001f);
+        }
+    }
+}
+
+void IncrementalFunnelAlgorithmTest::transitionPoint()
+{
+    IncrementalFunnelAlgorithm incrementalFunnelAlgorithm;
+    std::shared_ptr<NavLink> navLink = NavLink::newStandardLink(0, nullptr); //link not used by the algorithm
+    PathNode startNode(nullptr, 0.0f, 0.0f);
+    incrementalFunnelAlgorithm.startFunnel(startNode, Point3<float>(1.0, 0.0, 0.0));
+    PathNode node1(nullptr, 0.0f, 0.0f);
+    node1.setPreviousNode(&startNode, navLink.get());
+    incrementalFunnelAlgorithm.addPortal(node1, LineSegment3D<float>(Point3<float>(2.0, 0.0, 1.0), Point3<float>(0.0, 0.0, 1.0)));
+    PathNode node2(nullptr, 0.0f, 0.0f);
+    node2.setPreviousNode(&node1, navLink.get());
+    incrementalFunnelAlgorithm.addTransitionPoint(node2, Point3<float>(1.0, 0.0, 2.0), 1.5f, Point3<float>(1.0, 0.0, 3.0)); //jump of 1 unit
+
+    float cost = incrementalFunnelAlgorithm.computeCost(node2, Point3<float>(1.0, 0.0, 5.0));
+
+    AssertHelper::assertFloatEquals(cost, 2.0f + 1.5f + 1.0f + 2.0f);
+    AssertHelper::assertPoint3FloatEquals(node2.getFunnel().lastTransitionPoint, Point3<float>(1.0, 0.0, 3.0));
+}
+
+float IncrementalFunnelAlgorithmTest::funnelPathLength(const Point3<float> &startPoint, const std::vector<LineSegment3D<float>> &portals, std::size_t numberPortals,
+                                                       const Point3<float> &endPoint)
+{
+    std::vector<std::shared_ptr<PathPortal>> pathPortals;
+    pathPortals.push_back(std::make_shared<PathPortal>(LineSegment3D<float>(startPoint, startPoint), nullptr, nullptr, false));
+    for(std::size_t i = 0; i < numberPortals; ++i)
+    {
+        pathPortals.push_back(std::make_shared<PathPortal>(portals[i], nullptr, nullptr, false));
+    }
+    pathPortals.push_back(std::make_shared<PathPortal>(LineSegment3D<float>(endPoint, endPoint), nullptr, nullptr, false));
+
+    pathPortals = FunnelAlgorithm(pathPortals).computePivotPoints();
+
+    float length = 0.0f;
+    Point3<float> previousPoint = startPoint;
+    for(const auto &pathPortal : pathPortals)
+    {
+        if(pathPortal->hasTransitionPoint())
+        {
+            length += previousPoint.distance(pathPortal->getTransitionPoint());
+            previousPoint = pathPortal->getTransitionPoint();
+        }
+    }
+    return length;
+}
+
+CppUnit::Test *IncrementalFunnelAlgorithmTest::suite()
+{
+    auto *suite = new CppUnit::TestSuite("IncrementalFunnelAlgorithmTest");
+
+    suite->addTest(new CppUnit::TestCaller<IncrementalFunnelAlgorithmTest>("cornerPath", &IncrementalFunnelAlgorithmTest::cornerPath));
+    suite->addTest(new CppUnit::TestCaller<IncrementalFunnelAlgorithmTest>("zigzagPath", &IncrementalFunnelAlgorithmTest::zigzagPath));
+    suite->addTest(new CppUnit::TestCaller<IncrementalFunnelAlgorithmTest>("transitionPoint", &IncrementalFunnelAlgorithmTest::transitionPoint));
+
+    return suite;
+}
@@ -0,0 +1,21 @@
+#ifndef URCHINENGINE_INCREMENTALFUNNELALGORITHMTEST_H
+#define URCHINENGINE_INCREMENTALFUNNELALGORITHMTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include "UrchinAIEngine.h"
+
+class IncrementalFunnelAlgorithmTest : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void cornerPath();
+        void zigzagPath();
+        void transitionPoint();
+
+    private:
+        float funnelPathLength(const urchin::Point3<float> &, const std::vector<urchin::LineSegment3D<float>> &, std::size_t, const urchin::Point3<float> &);
+};
+
+#endif
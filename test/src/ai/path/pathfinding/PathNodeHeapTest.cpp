@@ -0,0 +1,88 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include "UrchinAIEngine.h"
+
+#include "PathNodeHeapTest.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void PathNodeHeapTest::popInScoreOrder()
+{
+    PathNodeHeap pathNodeHeap;
+    pathNodeHeap.reset(20);
+    std::vector<float> scores = {5.0f, 3.0f, 8.0f, 1.0f, 9.0f, 4.0f, 7.0f, 2.0f, 6.0f, 0.0f};
+    for(unsigned int i = 0; i < scores.size(); ++i)
+    {
+        pathNodeHeap.push(i * 2, scores[i]);
+    }
+
+    std::vector<unsigned int> expectedNodeIndices = {18, 6, 14, 2, 10, 0, 16, 12, 4, 8};
+    for(unsigned int expectedNodeIndex : expectedNodeIndices)
+    {
+        AssertHelper::assertTrue(pathNodeHeap.contains(expectedNodeIndex));
+        AssertHelper::assertUnsignedInt(pathNodeHeap.pop(), expectedNodeIndex);
+        AssertHelper::assertTrue(!pathNodeHeap.contains(expectedNodeIndex));
+    }
+    AssertHelper::assertTrue(pathNodeHeap.isEmpty());
+}
+
+void PathNodeHeapTest::popSameScoreInInsertionOrder()
+{
+    PathNodeHeap pathNodeHeap;
+    pathNodeHeap.reset(10);
+    for(unsigned int nodeIndex : {7, 3, 9, 1, 5})
+    {
+        pathNodeHeap.push(nodeIndex, 2.0f);
+    }
+
+    for(unsigned int expectedNodeIndex : {7, 3, 9, 1, 5})
+    {
+        AssertHelper::assertUnsignedInt(pathNodeHeap.pop(), expectedNodeIndex);
+    }
+}
+
+void PathNodeHeapTest::decreaseKey()
+{
+    PathNodeHeap pathNodeHeap;
+    pathNodeHeap.reset(10);
+    for(unsigned int i = 0; i < 10; ++i)
+    {
+        pathNodeHeap.push(i, 10.0f + (float)i);
+    }
+
+    pathNodeHeap.decreaseKey(8, 5.0f);
+    pathNodeHeap.decreaseKey(4, 10.5f);
+
+    AssertHelper::assertUnsignedInt(pathNodeHeap.pop(), 8);
+    AssertHelper::assertUnsignedInt(pathNodeHeap.pop(), 0);
+    AssertHelper::assertUnsignedInt(pathNodeHeap.pop(), 4);
+    AssertHelper::assertUnsignedInt(pathNodeHeap.pop(), 1);
+}
+
+void PathNodeHeapTest::resetHeap()
+{
+    PathNodeHeap pathNodeHeap;
+    pathNodeHeap.reset(5);
+    pathNodeHeap.push(1, 1.0f);
+    pathNodeHeap.push(3, 3.0f);
+
+    pathNodeHeap.reset(8);
+
+    AssertHelper::assertTrue(pathNodeHeap.isEmpty());
+    AssertHelper::assertTrue(!pathNodeHeap.contains(1));
+    AssertHelper::assertTrue(!pathNodeHeap.contains(3));
+    pathNodeHeap.push(7, 2.0f);
+    AssertHelper::assertUnsignedInt(pathNodeHeap.pop(), 7);
+}
+
+CppUnit::Test *PathNodeHeapTest::suite()
+{
+    auto *suite = new CppUnit::TestSuite("PathNodeHeapTest");
+
+    suite->addTest(new CppUnit::TestCaller<PathNodeHeapTest>("popInScoreOrder", &PathNodeHeapTest::popInScoreOrder));
+    suite->addTest(new CppUnit::TestCaller<PathNodeHeapTest>("popSameScoreInInsertionOrder", &PathNodeHeapTest::popSameScoreInInsertionOrder));
+    suite->addTest(new CppUnit::TestCaller<PathNodeHeapTest>("decreaseKey", &PathNodeHeapTest::decreaseKey));
+    suite->addTest(new CppUnit::TestCaller<PathNodeHeapTest>("resetHeap", &PathNodeHeapTest::resetHeap));
+
+    return suite;
+}
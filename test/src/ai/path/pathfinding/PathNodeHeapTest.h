@@ -0,0 +1,18 @@
+#ifndef URCHINENGINE_PATHNODEHEAPTEST_H
+#define URCHINENGINE_PATHNODEHEAPTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class PathNodeHeapTest : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void popInScoreOrder();
+        void popSameScoreInInsertionOrder();
+        void decreaseKey();
+        void resetHeap();
+};
+
+#endif
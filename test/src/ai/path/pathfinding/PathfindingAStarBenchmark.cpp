@@ -0,0 +1,449 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <iterator>
+
+#include "PathfindingAStarBenchmark.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+/**
+ * Find paths between opposite sides of a navigation mesh of 7.2k triangles.
+ */
+void PathfindingAStarBenchmark::pathsOnLargeNavMesh()
+{
+    constexpr unsigned int GRID_SIZE = 60;
+    constexpr float CELL_SIZE = 1.0f;
+    constexpr unsigned int NUM_PATHS = 10;
+    std::shared_ptr<NavMesh> navMesh = buildGridNavMesh(GRID_SIZE, CELL_SIZE);
+    PathfindingAStar pathfindingAStar(navMesh);
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    std::vector<PathPoint> pathPoints = findPaths(pathfindingAStar, GRID_SIZE, CELL_SIZE, NUM_PATHS);
+    auto endTime = std::chrono::high_resolution_clock::now();
+    double pathDurationMs = std::chrono::duration<double, std::milli>(endTime - startTime).count() / NUM_PATHS;
+
+    std::cout << std::fixed << std::setprecision(3) << "PathfindingAStarBenchmark - triangles: " << navMesh->getNumberTriangles() << ", paths: " << NUM_PATHS
+              << ", path points: " << pathPoints.size() << ", path: " << pathDurationMs << "ms" << std::endl;
+}
+
+/**
+ * Compare G score computed incrementally with G score computed by executing the funnel algorithm from the start point.
+ */
+void PathfindingAStarBenchmark::incrementalGScore()
+{
+    constexpr unsigned int GRID_SIZE = 40;
+    constexpr float CELL_SIZE = 1.0f;
+    constexpr unsigned int NUM_PATHS = 5;
+    std::shared_ptr<NavMesh> navMesh = buildGridNavMesh(GRID_SIZE, CELL_SIZE);
+    PathfindingAStar pathfindingAStar(navMesh);
+
+    pathfindingAStar.setIncrementalGScore(false);
+    auto startTime = std::chrono::high_resolution_clock::now();
+    std::vector<PathPoint> funnelPathPoints = findPaths(pathfindingAStar, GRID_SIZE, CELL_SIZE, NUM_PATHS);
+    auto endTime = std::chrono::high_resolution_clock::now();
+    double funnelDurationMs = std::chrono::duration<double, std::milli>(endTime - startTime).count() / NUM_PATHS;
+
+    pathfindingAStar.setIncrementalGScore(true);
+    startTime = std::chrono::high_resolution_clock::now();
+    std::vector<PathPoint> incrementalPathPoints = findPaths(pathfindingAStar, GRID_SIZE, CELL_SIZE, NUM_PATHS);
+    endTime = std::chrono::high_resolution_clock::now();
+    double incrementalDurationMs = std::chrono::duration<double, std::milli>(endTime - startTime).count() / NUM_PATHS;
+
+    AssertHelper::assertUnsignedInt(incrementalPathPoints.size(), funnelPathPoints.size());
+    for(std::size_t i = 0; i < incrementalPathPoints.size(); ++i)
+    {
+        AssertHelper::assertPoint3FloatEquals(incrementalPathPoints[i].getPoint(), funnelPathPoints[i].getPoint());
+    }
+
+    std::cout << std::fixed << std::setprecision(3) << "PathfindingAStarBenchmark - triangles: " << navMesh->getNumberTriangles() << ", paths: " << NUM_PATHS
+              << ", funnel G score path: " << funnelDurationMs << "ms, incremental G score path: " << incrementalDurationMs << "ms" << std::endl;
+}
+
+/**
+ * Find short paths on a navigation mesh of 80k triangles: duration is dominated by the search of start and end triangles.
+ */
+void PathfindingAStarBenchmark::shortPathsOnHugeNavMesh()
+{
+    constexpr unsigned int GRID_SIZE = 200;
+    constexpr float CELL_SIZE = 1.0f;
+    constexpr unsigned int NUM_PATHS = 500;
+    std::shared_ptr<NavMesh> navMesh = buildGridNavMesh(GRID_SIZE, CELL_SIZE);
+    PathfindingAStar pathfindingAStar(navMesh);
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    for(unsigned int i = 0; i < NUM_PATHS; ++i)
+    {
+        float x = (float)((i * 37) % GRID_SIZE) + 0.3f;
+        float z = (float)((i * 53) % (GRID_SIZE - 3)) + 0.4f;
+        if(isWallCell((unsigned int)x, (unsigned int)z) || isWallCell((unsigned int)x, (unsigned int)z + 2))
+        {
+            x -= 1.0f;
+        }
+        std::vector<PathPoint> pathPoints = pathfindingAStar.findPath(Point3<float>(x * CELL_SIZE, 0.0f, z * CELL_SIZE), Point3<float>(x * CELL_SIZE, 0.0f, (z + 2.0f) * CELL_SIZE));
+        AssertHelper::assertTrue(pathPoints.size() >= 2);
+    }
+    auto endTime = std::chrono::high_resolution_clock::now();
+    double pathDurationUs = std::chrono::duration<double, std::micro>(endTime - startTime).count() / NUM_PATHS;
+
+    std::cout << std::fixed << std::setprecision(3) << "PathfindingAStarBenchmark - triangles: " << navMesh->getNumberTriangles() << ", short paths: " << NUM_PATHS
+              << ", path: " << pathDurationUs << "us" << std::endl;
+}
+
+/**
+ * Compare the processing of path requests on the AI thread only with the processing on all hardware threads.
+ */
+void PathfindingAStarBenchmark::pathRequestsInParallel()
+{
+    constexpr unsigned int GRID_SIZE = 60;
+    constexpr float CELL_SIZE = 1.0f;
+    constexpr unsigned int NUM_REQUESTS = 64;
+    std::shared_ptr<NavMesh> navMesh = buildGridNavMesh(GRID_SIZE, CELL_SIZE);
+
+    std::vector<std::shared_ptr<PathRequest>> pathRequests;
+    for(unsigned int i = 0; i < NUM_REQUESTS; ++i)
+    {
+        float startZ = ((float)i + 0.4f) * ((float)GRID_SIZE * CELL_SIZE / (float)NUM_REQUESTS);
+        pathRequests.push_back(std::make_shared<PathRequest>(Point3<float>(0.3f * CELL_SIZE, 0.0f, startZ), Point3<float>((float)GRID_SIZE * CELL_SIZE - 0.3f * CELL_SIZE, 0.0f, (float)GRID_SIZE * CELL_SIZE - startZ)));
+    }
+    std::vector<std::shared_ptr<PathRequest>> sortedPathRequests = pathRequests;
+    PathRequestProcessor pathRequestProcessor;
+    pathRequestProcessor.setTimeBudget(0.0f);
+
+    pathRequestProcessor.setNumThreads(1);
+    auto startTime = std::chrono::high_resolution_clock::now();
+    pathRequestProcessor.processPathRequests(navMesh, sortedPathRequests);
+    auto endTime = std::chrono::high_resolution_clock::now();
+    double serialDurationMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    std::vector<std::vector<PathPoint>> serialPaths;
+    std::transform(pathRequests.begin(), pathRequests.end(), std::back_inserter(serialPaths), [](const auto &pathRequest){return pathRequest->getPath();});
+
+    pathRequestProcessor.setNumThreads(0);
+    startTime = std::chrono::high_resolution_clock::now();
+    pathRequestProcessor.processPathRequests(navMesh, sortedPathRequests);
+    endTime = std::chrono::high_resolution_clock::now();
+    double parallelDurationMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+    for(std::size_t i = 0; i < pathRequests.size(); ++i)
+    {
+        std::vector<PathPoint> parallelPath = pathRequests[i]->getPath();
+        AssertHelper::assertUnsignedInt(parallelPath.size(), serialPaths[i].size());
+        for(std::size_t j = 0; j < parallelPath.size(); ++j)
+        {
+            AssertHelper::assertPoint3FloatEquals(parallelPath[j].getPoint(), serialPaths[i][j].getPoint());
+        }
+    }
+
+    std::cout << std::fixed << std::setprecision(3) << "PathfindingAStarBenchmark - requests: " << NUM_REQUESTS << ", 1 thread: " << serialDurationMs
+              << "ms, " << pathRequestProcessor.getNumThreads() << " threads: " << parallelDurationMs << "ms" << std::endl;
+}
+
+/**
+ * Compare the search on all the triangles with the hierarchical search on a navigation mesh of 28.8k triangles split in 576
+ * polygons. Update of the polygon graph is measured after the generation of all polygons and after the regeneration of one polygon.
+ */
+void PathfindingAStarBenchmark::hierarchicalSearch()
+{
+    constexpr unsigned int GRID_SIZE = 120;
+    constexpr float CELL_SIZE = 1.0f;
+    constexpr unsigned int BLOCK_SIZE = 5;
+    constexpr unsigned int NUM_PATHS = 10;
+    std::vector<std::shared_ptr<NavTriangle>> cellTriangles;
+    std::vector<std::shared_ptr<NavPolygon>> navPolygons = buildClusteredPolygons(GRID_SIZE, CELL_SIZE, BLOCK_SIZE, cellTriangles);
+    auto navMesh = std::make_shared<NavMesh>();
+    navMesh->copyAllPolygons(navPolygons);
+    PathfindingAStar pathfindingAStar(navMesh);
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    std::vector<PathPoint> fullPathPoints = findPaths(pathfindingAStar, GRID_SIZE, CELL_SIZE, NUM_PATHS);
+    auto endTime = std::chrono::high_resolution_clock::now();
+    double fullDurationMs = std::chrono::duration<double, std::milli>(endTime - startTime).count() / NUM_PATHS;
+
+    NavPolygonGraph polygonGraph;
+    startTime = std::chrono::high_resolution_clock::now();
+    polygonGraph.update(*navMesh);
+    endTime = std::chrono::high_resolution_clock::now();
+    double graphUpdateDurationMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    unsigned int graphUpdatedPolygons = polygonGraph.getNumberUpdatedPolygons();
+
+    pathfindingAStar.setPolygonGraph(&polygonGraph);
+    startTime = std::chrono::high_resolution_clock::now();
+    std::vector<PathPoint> hierarchicalPathPoints = findPaths(pathfindingAStar, GRID_SIZE, CELL_SIZE, NUM_PATHS);
+    endTime = std::chrono::high_resolution_clock::now();
+    double hierarchicalDurationMs = std::chrono::duration<double, std::milli>(endTime - startTime).count() / NUM_PATHS;
+
+    //regenerate the polygon in the middle of the navigation mesh
+    unsigned int numberBlocks = GRID_SIZE / BLOCK_SIZE;
+    unsigned int middleBlock = numberBlocks / 2;
+    std::size_t middlePolygonIndex = middleBlock * numberBlocks + middleBlock;
+    for(const auto &navPolygon : navPolygons)
+    {
+        navPolygon->removeLinksTo(navPolygons[middlePolygonIndex]);
+    }
+    navPolygons[middlePolygonIndex] = buildBlockPolygon(middleBlock, middleBlock, GRID_SIZE, CELL_SIZE, BLOCK_SIZE, cellTriangles);
+    for(unsigned int i = middleBlock * BLOCK_SIZE; i < (middleBlock + 1) * BLOCK_SIZE; ++i)
+    {
+        linkCellToLeftBlock(middleBlock * BLOCK_SIZE, i, GRID_SIZE, cellTriangles);
+        linkCellToLeftBlock((middleBlock + 1) * BLOCK_SIZE, i, GRID_SIZE, cellTriangles);
+        linkCellToBottomBlock(i, middleBlock * BLOCK_SIZE, GRID_SIZE, cellTriangles);
+        linkCellToBottomBlock(i, (middleBlock + 1) * BLOCK_SIZE, GRID_SIZE, cellTriangles);
+    }
+    for(std::size_t neighborPolygonIndex : {middlePolygonIndex - 1, middlePolygonIndex + 1, middlePolygonIndex - numberBlocks, middlePolygonIndex + numberBlocks})
+    {
+        navPolygons[neighborPolygonIndex]->changeLinksUpdateId();
+    }
+    navMesh->copyAllPolygons(navPolygons);
+    startTime = std::chrono::high_resolution_clock::now();
+    polygonGraph.update(*navMesh);
+    endTime = std::chrono::high_resolution_clock::now();
+    double graphIncrementalUpdateDurationMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    unsigned int graphIncrementalUpdatedPolygons = polygonGraph.getNumberUpdatedPolygons();
+
+    AssertHelper::assertUnsignedInt(graphUpdatedPolygons, (unsigned int)navPolygons.size());
+    AssertHelper::assertUnsignedInt(graphIncrementalUpdatedPolygons, 1);
+    AssertHelper::assertTrue(computePathLength(hierarchicalPathPoints) <= computePathLength(fullPathPoints) * 1.1f);
+
+    std::cout << std::fixed << std::setprecision(3) << "PathfindingAStarBenchmark - triangles: " << navMesh->getNumberTriangles() << ", polygons: " << navPolygons.size()
+              << ", full search path: " << fullDurationMs << "ms (length: " << computePathLength(fullPathPoints) << "), hierarchical search path: " << hierarchicalDurationMs
+              << "ms (length: " << computePathLength(hierarchicalPathPoints) << "), graph update: " << graphUpdateDurationMs << "ms, graph update after one polygon regenerated: "
+              << graphIncrementalUpdateDurationMs << "ms" << std::endl;
+}
+
+/**
+ * @return Points of all the paths found between the left and right sides of the grid
+ */
+std::vector<PathPoint> PathfindingAStarBenchmark::findPaths(PathfindingAStar &pathfindingAStar, unsigned int gridSize, float cellSize, unsigned int numPaths)
+{
+    std::vector<PathPoint> allPathPoints;
+    for(unsigned int i = 0; i < numPaths; ++i)
+    {
+        float startZ = ((float)i + 0.4f) * ((float)gridSize * cellSize / (float)numPaths); //avoid points on triangle edges
+        Point3<float> startPoint(0.3f * cellSize, 0.0f, startZ);
+        Point3<float> endPoint((float)gridSize * cellSize - 0.3f * cellSize, 0.0f, (float)gridSize * cellSize - startZ);
+
+        std::vector<PathPoint> pathPoints = pathfindingAStar.findPath(startPoint, endPoint);
+        AssertHelper::assertTrue(pathPoints.size() >= 2);
+        allPathPoints.insert(allPathPoints.end(), pathPoints.begin(), pathPoints.end());
+    }
+    return allPathPoints;
+}
+
+/**
+ * Build a flat navigation mesh of one polygon where each cell of the grid is composed of two triangles linked to their neighbors.
+ * Walls having gaps force the paths to zigzag.
+ */
+std::shared_ptr<NavMesh> PathfindingAStarBenchmark::buildGridNavMesh(unsigned int gridSize, float cellSize)
+{
+    std::vector<Point3<float>> polygonPoints;
+    polygonPoints.reserve((gridSize + 1) * (gridSize + 1));
+    for(unsigned int z = 0; z <= gridSize; ++z)
+    {
+        for(unsigned int x = 0; x <= gridSize; ++x)
+        {
+            polygonPoints.emplace_back(Point3<float>((float)x * cellSize, 0.0f, (float)z * cellSize));
+        }
+    }
+    auto navPolygon = std::make_shared<NavPolygon>("gridPolygon", std::move(polygonPoints), nullptr);
+
+    //cell (x, z) is composed of triangles: [x,z - x,z+1 - x+1,z] at index 2*cellIndex and [x,z+1 - x+1,z+1 - x+1,z] at index 2*cellIndex+1
+    std::vector<std::shared_ptr<NavTriangle>> triangles;
+    triangles.reserve(2 * gridSize * gridSize);
+    for(unsigned int z = 0; z < gridSize; ++z)
+    {
+        for(unsigned int x = 0; x < gridSize; ++x)
+        {
+            std::size_t p00 = z * (gridSize + 1) + x;
+            std::size_t p10 = p00 + 1;
+            std::size_t p01 = p00 + (gridSize + 1);
+            std::size_t p11 = p01 + 1;
+            triangles.push_back(isWallCell(x, z) ? nullptr : std::make_shared<NavTriangle>(p00, p01, p10));
+            triangles.push_back(isWallCell(x, z) ? nullptr : std::make_shared<NavTriangle>(p01, p11, p10));
+        }
+    }
+    std::vector<std::shared_ptr<NavTriangle>> polygonTriangles;
+    std::copy_if(triangles.begin(), triangles.end(), std::back_inserter(polygonTriangles), [](const auto &triangle){return triangle != nullptr;});
+    navPolygon->addTriangles(polygonTriangles, navPolygon);
+
+    for(unsigned int z = 0; z < gridSize; ++z)
+    {
+        for(unsigned int x = 0; x < gridSize; ++x)
+        {
+            if(isWallCell(x, z))
+            {
+                continue;
+            }
+            std::size_t cellIndex = z * gridSize + x;
+            const auto &triangleA = triangles[2 * cellIndex];
+            const auto &triangleB = triangles[2 * cellIndex + 1];
+
+            triangleA->addStandardLink(1, triangleB);
+            triangleB->addStandardLink(2, triangleA);
+            if(x > 0 && !isWallCell(x - 1, z))
+            {
+                const auto &leftTriangleB = triangles[2 * (cellIndex - 1) + 1];
+                triangleA->addStandardLink(0, leftTriangleB);
+                leftTriangleB->addStandardLink(1, triangleA);
+            }
+            if(z > 0 && !isWallCell(x, z - 1))
+            {
+                const auto &bottomTriangleB = triangles[2 * (cellIndex - gridSize) + 1];
+                triangleA->addStandardLink(2, bottomTriangleB);
+                bottomTriangleB->addStandardLink(0, triangleA);
+            }
+        }
+    }
+
+    auto navMesh = std::make_shared<NavMesh>();
+    navMesh->copyAllPolygons({navPolygon});
+    return navMesh;
+}
+
+/**
+ * Build a flat navigation mesh where each block of the grid is a polygon. Polygons are linked to their neighbors by join polygons links.
+ * @param cellTriangles [out] Triangles of the grid cells (see buildGridNavMesh() for the triangles order)
+ */
+std::vector<std::shared_ptr<NavPolygon>> PathfindingAStarBenchmark::buildClusteredPolygons(unsigned int gridSize, float cellSize, unsigned int blockSize,
+        std::vector<std::shared_ptr<NavTriangle>> &cellTriangles)
+{
+    cellTriangles.assign(2 * gridSize * gridSize, nullptr);
+    unsigned int numberBlocks = gridSize / blockSize;
+    std::vector<std::shared_ptr<NavPolygon>> navPolygons;
+    for(unsigned int blockZ = 0; blockZ < numberBlocks; ++blockZ)
+    {
+        for(unsigned int blockX = 0; blockX < numberBlocks; ++blockX)
+        {
+            navPolygons.push_back(buildBlockPolygon(blockX, blockZ, gridSize, cellSize, blockSize, cellTriangles));
+        }
+    }
+
+    for(unsigned int z = 0; z < gridSize; ++z)
+    {
+        for(unsigned int x = 0; x < gridSize; ++x)
+        {
+            if(x % blockSize == 0)
+            {
+                linkCellToLeftBlock(x, z, gridSize, cellTriangles);
+            }
+            if(z % blockSize == 0)
+            {
+                linkCellToBottomBlock(x, z, gridSize, cellTriangles);
+            }
+        }
+    }
+    return navPolygons;
+}
+
+std::shared_ptr<NavPolygon> PathfindingAStarBenchmark::buildBlockPolygon(unsigned int blockX, unsigned int blockZ, unsigned int gridSize, float cellSize,
+        unsigned int blockSize, std::vector<std::shared_ptr<NavTriangle>> &cellTriangles)
+{
+    std::vector<Point3<float>> polygonPoints;
+    polygonPoints.reserve((blockSize + 1) * (blockSize + 1));
+    for(unsigned int z = 0; z <= blockSize; ++z)
+    {
+        for(unsigned int x = 0; x <= blockSize; ++x)
+        {
+            polygonPoints.emplace_back(Point3<float>((float)(blockX * blockSize + x) * cellSize, 0.0f, (float)(blockZ * blockSize + z) * cellSize));
+        }
+    }
+    auto navPolygon = std::make_shared<NavPolygon>("blockPolygon", std::move(polygonPoints), nullptr);
+
+    std::vector<std::shared_ptr<NavTriangle>> polygonTriangles;
+    for(unsigned int z = 0; z < blockSize; ++z)
+    {
+        for(unsigned int x = 0; x < blockSize; ++x)
+        {
+            std::size_t cellIndex = (blockZ * blockSize + z) * gridSize + (blockX * blockSize + x);
+            if(isWallCell(blockX * blockSize + x, blockZ * blockSize + z))
+            {
+                cellTriangles[2 * cellIndex] = nullptr;
+                cellTriangles[2 * cellIndex + 1] = nullptr;
+                continue;
+            }
+            std::size_t p00 = z * (blockSize + 1) + x;
+            std::size_t p10 = p00 + 1;
+            std::size_t p01 = p00 + (blockSize + 1);
+            std::size_t p11 = p01 + 1;
+            auto triangleA = std::make_shared<NavTriangle>(p00, p01, p10);
+            auto triangleB = std::make_shared<NavTriangle>(p01, p11, p10);
+            triangleA->addStandardLink(1, triangleB);
+            triangleB->addStandardLink(2, triangleA);
+            if(x > 0 && cellTriangles[2 * (cellIndex - 1) + 1])
+            {
+                triangleA->addStandardLink(0, cellTriangles[2 * (cellIndex - 1) + 1]);
+                cellTriangles[2 * (cellIndex - 1) + 1]->addStandardLink(1, triangleA);
+            }
+            if(z > 0 && cellTriangles[2 * (cellIndex - gridSize) + 1])
+            {
+                triangleA->addStandardLink(2, cellTriangles[2 * (cellIndex - gridSize) + 1]);
+                cellTriangles[2 * (cellIndex - gridSize) + 1]->addStandardLink(0, triangleA);
+            }
+
+            cellTriangles[2 * cellIndex] = triangleA;
+            cellTriangles[2 * cellIndex + 1] = triangleB;
+            polygonTriangles.push_back(triangleA);
+            polygonTriangles.push_back(triangleB);
+        }
+    }
+    navPolygon->addTriangles(polygonTriangles, navPolygon);
+
+    return navPolygon;
+}
+
+void PathfindingAStarBenchmark::linkCellToLeftBlock(unsigned int x, unsigned int z, unsigned int gridSize, const std::vector<std::shared_ptr<NavTriangle>> &cellTriangles)
+{
+    std::size_t cellIndex = z * gridSize + x;
+    if(x > 0 && cellTriangles[2 * cellIndex] && cellTriangles[2 * (cellIndex - 1) + 1])
+    {
+        cellTriangles[2 * cellIndex]->addJoinPolygonsLink(0, cellTriangles[2 * (cellIndex - 1) + 1], new NavLinkConstraint(1.0f, 0.0f, 1));
+        cellTriangles[2 * (cellIndex - 1) + 1]->addJoinPolygonsLink(1, cellTriangles[2 * cellIndex], new NavLinkConstraint(1.0f, 0.0f, 0));
+    }
+}
+
+void PathfindingAStarBenchmark::linkCellToBottomBlock(unsigned int x, unsigned int z, unsigned int gridSize, const std::vector<std::shared_ptr<NavTriangle>> &cellTriangles)
+{
+    std::size_t cellIndex = z * gridSize + x;
+    if(z > 0 && cellTriangles[2 * cellIndex] && cellTriangles[2 * (cellIndex - gridSize) + 1])
+    {
+        cellTriangles[2 * cellIndex]->addJoinPolygonsLink(2, cellTriangles[2 * (cellIndex - gridSize) + 1], new NavLinkConstraint(1.0f, 0.0f, 0));
+        cellTriangles[2 * (cellIndex - gridSize) + 1]->addJoinPolygonsLink(0, cellTriangles[2 * cellIndex], new NavLinkConstraint(1.0f, 0.0f, 2));
+    }
+}
+
+/**
+ * @return Length of the paths including the transitions between them (identical for all searches)
+ */
+float PathfindingAStarBenchmark::computePathLength(const std::vector<PathPoint> &pathPoints) const
+{
+    float pathLength = 0.0f;
+    for(std::size_t i = 1; i < pathPoints.size(); ++i)
+    {
+        pathLength += pathPoints[i - 1].getPoint().distance(pathPoints[i].getPoint());
+    }
+    return pathLength;
+}
+
+bool PathfindingAStarBenchmark::isWallCell(unsigned int x, unsigned int z) const
+{
+    if(x % 10 != 5)
+    {
+        return false;
+    }
+    unsigned int gapZ = ((x / 10) % 2 == 0) ? 2 : 12;
+    return z % 15 != gapZ;
+}
+
+CppUnit::Test *PathfindingAStarBenchmark::suite()
+{
+    auto *suite = new CppUnit::TestSuite("PathfindingAStarBenchmark");
+
+    suite->addTest(new CppUnit::TestCaller<PathfindingAStarBenchmark>("pathsOnLargeNavMesh", &PathfindingAStarBenchmark::pathsOnLargeNavMesh));
+    suite->addTest(new CppUnit::TestCaller<PathfindingAStarBenchmark>("incrementalGScore", &PathfindingAStarBenchmark::incrementalGScore));
+    suite->addTest(new CppUnit::TestCaller<PathfindingAStarBenchmark>("shortPathsOnHugeNavMesh", &PathfindingAStarBenchmark::shortPathsOnHugeNavMesh));
+    suite->addTest(new CppUnit::TestCaller<PathfindingAStarBenchmark>("pathRequestsInParallel", &PathfindingAStarBenchmark::pathRequestsInParallel));
+    suite->addTest(new CppUnit::TestCaller<PathfindingAStarBenchmark>("hierarchicalSearch", &PathfindingAStarBenchmark::hierarchicalSearch));
+
+    return suite;
+}
@@ -0,0 +1,30 @@
+#ifndef URCHINENGINE_PATHFINDINGASTARBENCHMARK_H
+#define URCHINENGINE_PATHFINDINGASTARBENCHMARK_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include "UrchinAIEngine.h"
+
+class PathfindingAStarBenchmark : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void pathsOnLargeNavMesh();
+        void incrementalGScore();
+        void shortPathsOnHugeNavMesh();
+        void pathRequestsInParallel();
+        void hierarchicalSearch();
+
+    private:
+        std::vector<urchin::PathPoint> findPaths(urchin::PathfindingAStar &, unsigned int, float, unsigned int);
+        std::shared_ptr<urchin::NavMesh> buildGridNavMesh(unsigned int, float);
+        std::vector<std::shared_ptr<urchin::NavPolygon>> buildClusteredPolygons(unsigned int, float, unsigned int, std::vector<std::shared_ptr<urchin::NavTriangle>> &);
+        std::shared_ptr<urchin::NavPolygon> buildBlockPolygon(unsigned int, unsigned int, unsigned int, float, unsigned int, std::vector<std::shared_ptr<urchin::NavTriangle>> &);
+        void linkCellToLeftBlock(unsigned int, unsigned int, unsigned int, const std::vector<std::shared_ptr<urchin::NavTriangle>> &);
+        void linkCellToBottomBlock(unsigned int, unsigned int, unsigned int, const std::vector<std::shared_ptr<urchin::NavTriangle>> &);
+        float computePathLength(const std::vector<urchin::PathPoint> &) const;
+        bool isWallCell(unsigned int, unsigned int) const;
+};
+
+#endif
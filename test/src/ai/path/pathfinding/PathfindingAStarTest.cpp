@@ -56,6 +56,41 @@ void PathfindingAStarTest::joinPolygonsPath()
     AssertHelper::assertTrue(!pathPoints[2].isJumpPoint());
 }
 
+void PathfindingAStarTest::hierarchicalPath()
+{
+    std::vector<std::shared_ptr<NavPolygon>> navPolygons;
+    for(std::size_t i = 0; i < 3; ++i)
+    {
+        auto originX = (float)i * 4.0f;
+        std::vector<Point3<float>> polygonPoints = {Point3<float>(originX, 0.0f, 0.0f), Point3<float>(originX, 0.0f, 4.0f),
+                Point3<float>(originX + 4.0f, 0.0f, 4.0f), Point3<float>(originX + 4.0f, 0.0f, 0.0f)};
+        auto navPolygon = std::make_shared<NavPolygon>("polyTestName", std::move(polygonPoints), nullptr);
+        auto navTriangle1 = std::make_shared<NavTriangle>(0, 1, 3);
+        auto navTriangle2 = std::make_shared<NavTriangle>(1, 2, 3);
+        navPolygon->addTriangles({navTriangle1, navTriangle2}, navPolygon);
+        navTriangle1->addStandardLink(1, navTriangle2);
+        navTriangle2->addStandardLink(2, navTriangle1);
+        if(!navPolygons.empty())
+        {
+            navPolygons.back()->getTriangle(1)->addJoinPolygonsLink(1, navTriangle1, new NavLinkConstraint(1.0f, 0.0f, 0));
+            navTriangle1->addJoinPolygonsLink(0, navPolygons.back()->getTriangle(1), new NavLinkConstraint(1.0f, 0.0f, 1));
+        }
+        navPolygons.push_back(navPolygon);
+    }
+    auto navMesh = std::make_shared<NavMesh>();
+    navMesh->copyAllPolygons(navPolygons);
+    NavPolygonGraph polygonGraph;
+    polygonGraph.update(*navMesh);
+    PathfindingAStar pathfindingAStar(navMesh);
+    pathfindingAStar.setPolygonGraph(&polygonGraph);
+
+    std::vector<PathPoint> pathPoints = pathfindingAStar.findPath(Point3<float>(1.0f, 0.0f, 2.0f), Point3<float>(11.0f, 0.0f, 3.0f));
+
+    AssertHelper::assertUnsignedInt(pathPoints.size(), 2);
+    AssertHelper::assertPoint3FloatEquals(pathPoints[0].getPoint(), Point3<float>(1.0f, 0.0f, 2.0f));
+    AssertHelper::assertPoint3FloatEquals(pathPoints[1].getPoint(), Point3<float>(11.0f, 0.0f, 3.0f));
+}
+
 void PathfindingAStarTest::jumpWithSmallConstraint()
 {
     std::vector<PathPoint> pathPoints = pathWithJump(new NavLinkConstraint(1.0f, 0.0f, 2));
@@ -86,6 +121,62 @@ void PathfindingAStarTest::jumpWithBigConstraint()
     AssertHelper::assertTrue(!pathPoints[3].isJumpPoint());
 }
 
+void PathfindingAStarTest::successivePaths()
+{
+    std::vector<Point3<float>> polygonPoints = {Point3<float>(0.0f, 0.0f, 0.0f), Point3<float>(0.0f, 0.0f, 4.0f), Point3<float>(4.0f, 0.0f, 4.0f), Point3<float>(4.0f, 0.0f, 0.0f)};
+    auto navPolygon = std::make_shared<NavPolygon>("polyTestName", std::move(polygonPoints), nullptr);
+    auto navTriangle1 = std::make_shared<NavTriangle>(0, 1, 3);
+    auto navTriangle2 = std::make_shared<NavTriangle>(1, 2, 3);
+    navPolygon->addTriangles({navTriangle1, navTriangle2}, navPolygon);
+
+    navTriangle1->addStandardLink(1, navTriangle2);
+    navTriangle2->addStandardLink(2, navTriangle1);
+    auto navMesh = std::make_shared<NavMesh>();
+    navMesh->copyAllPolygons({navPolygon});
+    PathfindingAStar pathfindingAStar(navMesh);
+
+    std::vector<PathPoint> pathPoints1 = pathfindingAStar.findPath(Point3<float>(1.0f, 0.0f, 1.0f), Point3<float>(3.0f, 0.0f, 3.0f));
+    std::vector<PathPoint> pathPoints2 = pathfindingAStar.findPath(Point3<float>(3.0f, 0.0f, 3.0f), Point3<float>(1.0f, 0.0f, 1.0f));
+    std::vector<PathPoint> pathPoints3 = pathfindingAStar.findPath(Point3<float>(1.0f, 0.0f, 1.0f), Point3<float>(3.0f, 0.0f, 3.0f));
+
+    AssertHelper::assertUnsignedInt(pathPoints1.size(), 2);
+    AssertHelper::assertUnsignedInt(pathPoints2.size(), 2);
+    AssertHelper::assertPoint3FloatEquals(pathPoints2[0].getPoint(), Point3<float>(3.0f, 0.0f, 3.0f));
+    AssertHelper::assertPoint3FloatEquals(pathPoints2[1].getPoint(), Point3<float>(1.0f, 0.0f, 1.0f));
+    AssertHelper::assertUnsignedInt(pathPoints3.size(), 2);
+    AssertHelper::assertPoint3FloatEquals(pathPoints3[0].getPoint(), pathPoints1[0].getPoint());
+    AssertHelper::assertPoint3FloatEquals(pathPoints3[1].getPoint(), pathPoints1[1].getPoint());
+}
+
+void PathfindingAStarTest::pathOnOverlappingFloors()
+{
+    std::vector<Point3<float>> groundPoints = {Point3<float>(0.0f, 0.0f, 0.0f), Point3<float>(0.0f, 0.0f, 4.0f), Point3<float>(4.0f, 0.0f, 4.0f), Point3<float>(4.0f, 0.0f, 0.0f)};
+    auto groundPolygon = std::make_shared<NavPolygon>("groundTestName", std::move(groundPoints), nullptr);
+    auto groundTriangle1 = std::make_shared<NavTriangle>(0, 1, 3);
+    auto groundTriangle2 = std::make_shared<NavTriangle>(1, 2, 3);
+    groundPolygon->addTriangles({groundTriangle1, groundTriangle2}, groundPolygon);
+    groundTriangle1->addStandardLink(1, groundTriangle2);
+
+    std::vector<Point3<float>> floorPoints = {Point3<float>(0.0f, 3.0f, 0.0f), Point3<float>(0.0f, 3.0f, 4.0f), Point3<float>(2.0f, 3.0f, 4.0f), Point3<float>(2.0f, 3.0f, 0.0f)};
+    auto floorPolygon = std::make_shared<NavPolygon>("floorTestName", std::move(floorPoints), nullptr);
+    auto floorTriangle1 = std::make_shared<NavTriangle>(0, 1, 3);
+    auto floorTriangle2 = std::make_shared<NavTriangle>(1, 2, 3);
+    floorPolygon->addTriangles({floorTriangle1, floorTriangle2}, floorPolygon);
+    floorTriangle1->addStandardLink(1, floorTriangle2);
+
+    auto navMesh = std::make_shared<NavMesh>();
+    navMesh->copyAllPolygons({groundPolygon, floorPolygon});
+    PathfindingAStar pathfindingAStar(navMesh);
+
+    std::vector<PathPoint> floorPathPoints = pathfindingAStar.findPath(Point3<float>(1.0f, 4.0f, 1.0f), Point3<float>(1.5f, 4.0f, 3.5f));
+    std::vector<PathPoint> floorToGroundPathPoints = pathfindingAStar.findPath(Point3<float>(1.0f, 4.0f, 1.0f), Point3<float>(3.0f, 4.0f, 3.0f));
+    std::vector<PathPoint> groundPathPoints = pathfindingAStar.findPath(Point3<float>(1.0f, 1.0f, 1.0f), Point3<float>(3.0f, 1.0f, 3.0f));
+
+    AssertHelper::assertUnsignedInt(floorPathPoints.size(), 2); //start and end points on floor triangles
+    AssertHelper::assertUnsignedInt(floorToGroundPathPoints.size(), 0); //no link between floor and ground
+    AssertHelper::assertUnsignedInt(groundPathPoints.size(), 2); //floor triangles above the points are ignored
+}
+
 std::vector<PathPoint> PathfindingAStarTest::pathWithJump(NavLinkConstraint *navLinkConstraint)
 {
     std::vector<Point3<float>> polygon1Points = {Point3<float>(0.0f, 0.0f, 0.0f), Point3<float>(0.0f, 0.0f, 4.0f), Point3<float>(4.0f, 0.0f, 0.0f)};
@@ -113,9 +204,13 @@ CppUnit::Test *PathfindingAStarTest::suite()
     suite->addTest(new CppUnit::TestCaller<PathfindingAStarTest>("straightPath", &PathfindingAStarTest::straightPath));
 
     suite->addTest(new CppUnit::TestCaller<PathfindingAStarTest>("joinPolygonsPath", &PathfindingAStarTest::joinPolygonsPath));
+    suite->addTest(new CppUnit::TestCaller<PathfindingAStarTest>("hierarchicalPath", &PathfindingAStarTest::hierarchicalPath));
 
     suite->addTest(new CppUnit::TestCaller<PathfindingAStarTest>("jumpWithSmallConstraint", &PathfindingAStarTest::jumpWithSmallConstraint));
     suite->addTest(new CppUnit::TestCaller<PathfindingAStarTest>("jumpWithBigConstraint", &PathfindingAStarTest::jumpWithBigConstraint));
 
+    suite->addTest(new CppUnit::TestCaller<PathfindingAStarTest>("successivePaths", &PathfindingAStarTest::successivePaths));
+    suite->addTest(new CppUnit::TestCaller<PathfindingAStarTest>("pathOnOverlappingFloors", &PathfindingAStarTest::pathOnOverlappingFloors));
+
     return suite;
 }
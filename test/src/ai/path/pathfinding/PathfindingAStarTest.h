@@ -13,10 +13,14 @@ class PathfindingAStarTest : public CppUnit::TestFixture
         void straightPath();
 
         void joinPolygonsPath();
+        void hierarchicalPath();
 
         void jumpWithSmallConstraint();
         void jumpWithBigConstraint();
 
+        void successivePaths();
+        void pathOnOverlappingFloors();
+
     private:
         std::vector<urchin::PathPoint> pathWithJump(urchin::NavLinkConstraint *);
 };
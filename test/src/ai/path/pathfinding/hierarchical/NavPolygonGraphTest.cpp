@@ -0,0 +1,124 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+
+#include "NavPolygonGraphTest.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void NavPolygonGraphTest::portalsBetweenPolygons()
+{
+    auto leftPolygon = buildSquarePolygon(0.0f);
+    auto middlePolygon = buildSquarePolygon(4.0f);
+    auto rightPolygon = buildSquarePolygon(8.0f);
+    linkPolygons(leftPolygon, middlePolygon);
+    linkPolygons(middlePolygon, rightPolygon);
+    NavMesh navMesh;
+    navMesh.copyAllPolygons({leftPolygon, middlePolygon, rightPolygon});
+
+    NavPolygonGraph polygonGraph;
+    polygonGraph.update(navMesh);
+
+    AssertHelper::assertUnsignedInt(polygonGraph.getPortals().size(), 4);
+    AssertHelper::assertUnsignedInt(polygonGraph.getExitPortals(0).size(), 1);
+    AssertHelper::assertUnsignedInt(polygonGraph.getEntryPortals(1).size(), 2);
+    AssertHelper::assertUnsignedInt(polygonGraph.getExitPortals(1).size(), 2);
+    const PolygonPortal &leftToMiddlePortal = polygonGraph.getPortals()[polygonGraph.getExitPortals(0)[0]];
+    AssertHelper::assertUnsignedInt(leftToMiddlePortal.targetPolygonIndex, 1);
+    AssertHelper::assertPoint3FloatEquals(leftToMiddlePortal.exitPoint, Point3<float>(4.0f, 0.0f, 2.0f));
+    AssertHelper::assertFloatEquals(leftToMiddlePortal.crossingCost, 0.0f);
+}
+
+void NavPolygonGraphTest::crossingCost()
+{
+    auto leftPolygon = buildSquarePolygon(0.0f);
+    auto middlePolygon = buildSquarePolygon(4.0f);
+    auto rightPolygon = buildSquarePolygon(8.0f);
+    linkPolygons(leftPolygon, middlePolygon);
+    linkPolygons(middlePolygon, rightPolygon);
+    NavMesh navMesh;
+    navMesh.copyAllPolygons({leftPolygon, middlePolygon, rightPolygon});
+
+    NavPolygonGraph polygonGraph;
+    polygonGraph.update(navMesh);
+
+    for(unsigned int entryPortalIndex : polygonGraph.getEntryPortals(1))
+    {
+        const PolygonPortal &entryPortal = polygonGraph.getPortals()[entryPortalIndex];
+        for(unsigned int exitPortalIndex : polygonGraph.getExitPortals(1))
+        {
+            const PolygonPortal &exitPortal = polygonGraph.getPortals()[exitPortalIndex];
+            float expectedCost = (entryPortal.sourcePolygonIndex == exitPortal.targetPolygonIndex) ? 0.0f : 4.0f; //go back or cross middle polygon
+            AssertHelper::assertFloatEquals(polygonGraph.getCrossingCost(1, entryPortal.entryIndex, exitPortal.exitIndex), expectedCost);
+        }
+    }
+}
+
+void NavPolygonGraphTest::incrementalUpdate()
+{
+    auto leftPolygon = buildSquarePolygon(0.0f);
+    auto middlePolygon = buildSquarePolygon(4.0f);
+    auto rightPolygon = buildSquarePolygon(8.0f);
+    linkPolygons(leftPolygon, middlePolygon);
+    linkPolygons(middlePolygon, rightPolygon);
+    NavMesh navMesh;
+    NavPolygonGraph polygonGraph;
+
+    navMesh.copyAllPolygons({leftPolygon, middlePolygon, rightPolygon});
+    polygonGraph.update(navMesh);
+    unsigned int firstUpdatedPolygons = polygonGraph.getNumberUpdatedPolygons();
+
+    navMesh.copyAllPolygons({leftPolygon, middlePolygon, rightPolygon});
+    polygonGraph.update(navMesh);
+    unsigned int secondUpdatedPolygons = polygonGraph.getNumberUpdatedPolygons();
+
+    auto newRightPolygon = buildSquarePolygon(8.0f); //regenerated polygon
+    middlePolygon->removeLinksTo(rightPolygon);
+    linkPolygons(middlePolygon, newRightPolygon);
+    middlePolygon->changeLinksUpdateId();
+    navMesh.copyAllPolygons({leftPolygon, middlePolygon, newRightPolygon});
+    polygonGraph.update(navMesh);
+    unsigned int thirdUpdatedPolygons = polygonGraph.getNumberUpdatedPolygons();
+
+    AssertHelper::assertUnsignedInt(firstUpdatedPolygons, 3);
+    AssertHelper::assertUnsignedInt(secondUpdatedPolygons, 0);
+    AssertHelper::assertUnsignedInt(thirdUpdatedPolygons, 1); //portals of middle polygon are unchanged
+    AssertHelper::assertUnsignedInt(polygonGraph.getNavMeshUpdateId(), navMesh.getUpdateId());
+    AssertHelper::assertUnsignedInt(polygonGraph.getPortals().size(), 4);
+}
+
+/**
+ * Square polygon of size 4 on XZ plane composed of two triangles
+ */
+std::shared_ptr<NavPolygon> NavPolygonGraphTest::buildSquarePolygon(float originX)
+{
+    std::vector<Point3<float>> polygonPoints = {Point3<float>(originX, 0.0f, 0.0f), Point3<float>(originX, 0.0f, 4.0f),
+            Point3<float>(originX + 4.0f, 0.0f, 4.0f), Point3<float>(originX + 4.0f, 0.0f, 0.0f)};
+    auto navPolygon = std::make_shared<NavPolygon>("polyTestName", std::move(polygonPoints), nullptr);
+    auto navTriangle1 = std::make_shared<NavTriangle>(0, 1, 3);
+    auto navTriangle2 = std::make_shared<NavTriangle>(1, 2, 3);
+    navPolygon->addTriangles({navTriangle1, navTriangle2}, navPolygon);
+    navTriangle1->addStandardLink(1, navTriangle2);
+    navTriangle2->addStandardLink(2, navTriangle1);
+
+    return navPolygon;
+}
+
+/**
+ * Link right edge of left polygon with left edge of right polygon
+ */
+void NavPolygonGraphTest::linkPolygons(const std::shared_ptr<NavPolygon> &leftPolygon, const std::shared_ptr<NavPolygon> &rightPolygon)
+{
+    leftPolygon->getTriangle(1)->addJoinPolygonsLink(1, rightPolygon->getTriangle(0), new NavLinkConstraint(1.0f, 0.0f, 0));
+    rightPolygon->getTriangle(0)->addJoinPolygonsLink(0, leftPolygon->getTriangle(1), new NavLinkConstraint(1.0f, 0.0f, 1));
+}
+
+CppUnit::Test *NavPolygonGraphTest::suite()
+{
+    auto *suite = new CppUnit::TestSuite("NavPolygonGraphTest");
+
+    suite->addTest(new CppUnit::TestCaller<NavPolygonGraphTest>("portalsBetweenPolygons", &NavPolygonGraphTest::portalsBetweenPolygons));
+    suite->addTest(new CppUnit::TestCaller<NavPolygonGraphTest>("crossingCost", &NavPolygonGraphTest::crossingCost));
+    suite->addTest(new CppUnit::TestCaller<NavPolygonGraphTest>("incrementalUpdate", &NavPolygonGraphTest::incrementalUpdate));
+
+    return suite;
+}
@@ -0,0 +1,23 @@
+#ifndef URCHINENGINE_NAVPOLYGONGRAPHTEST_H
+#define URCHINENGINE_NAVPOLYGONGRAPHTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include <memory>
+#include "UrchinAIEngine.h"
+
+class NavPolygonGraphTest : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void portalsBetweenPolygons();
+        void crossingCost();
+        void incrementalUpdate();
+
+    private:
+        std::shared_ptr<urchin::NavPolygon> buildSquarePolygon(float);
+        void linkPolygons(const std::shared_ptr<urchin::NavPolygon> &, const std::shared_ptr<urchin::NavPolygon> &);
+};
+
+#endif
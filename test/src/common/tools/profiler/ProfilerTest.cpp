@@ -0,0 +1,123 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <sstream>
+#include <thread>
+#include "UrchinCommon.h"
+
+#include "common/tools/profiler/ProfilerTest.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+namespace
+{
+	unsigned int countOccurrences(const std::string &text, const std::string &pattern)
+	{
+		unsigned int nbOccurrences = 0;
+		for(std::size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + pattern.size()))
+		{
+			nbOccurrences++;
+		}
+		return nbOccurrences;
+	}
+}
+
+void ProfilerTest::disabledProfiler()
+{
+	std::shared_ptr<Profiler> profiler = Profiler::getInstance("physics");
+	profiler->reset(false);
+	Profiler::clearTrace();
+
+	{
+		ScopeProfiler scopeProfiler("physics", "disabledZone");
+	}
+
+	std::stringstream jsonStream;
+	profiler->writeJson(jsonStream);
+	std::stringstream traceStream;
+	Profiler::writeChromeTrace(traceStream);
+
+	AssertHelper::assertTrue(jsonStream.str().find("disabledZone") == std::string::npos);
+	AssertHelper::assertTrue(traceStream.str().find("disabledZone") == std::string::npos);
+}
+
+void ProfilerTest::hierarchicalProfile()
+{
+	std::shared_ptr<Profiler> profiler = Profiler::getInstance("physics");
+	profiler->reset(true);
+
+	for(unsigned int i=0; i<3; ++i)
+	{
+		ScopeProfiler parentProfiler("physics", "parentZone");
+		for(unsigned int j=0; j<2; ++j)
+		{
+			ScopeProfiler childProfiler("physics", "childZone");
+		}
+	}
+
+	std::stringstream jsonStream;
+	profiler->writeJson(jsonStream);
+	profiler->reset(false);
+	Profiler::clearTrace();
+
+	AssertHelper::assertTrue(jsonStream.str().find(R"({"name":"parentZone","calls":2,)") != std::string::npos); //first call excluded
+	AssertHelper::assertTrue(jsonStream.str().find(R"("children":[{"name":"childZone","calls":5,)") != std::string::npos);
+}
+
+void ProfilerTest::chromeTraceMultiThreads()
+{
+	std::shared_ptr<Profiler> profiler = Profiler::getInstance("physics");
+	profiler->reset(true);
+	Profiler::clearTrace();
+
+	{
+		ScopeProfiler scopeProfiler("physics", "mainZone");
+	}
+	std::thread workerThread([]()
+	{
+		ScopeProfiler scopeProfiler("physics", "workerZone");
+	});
+	workerThread.join();
+
+	std::stringstream traceStream;
+	Profiler::writeChromeTrace(traceStream);
+	profiler->reset(false);
+	Profiler::clearTrace();
+
+	std::string trace = traceStream.str();
+	AssertHelper::assertTrue(trace.find(R"({"traceEvents":[)") == 0);
+	AssertHelper::assertTrue(trace.find(R"({"name":"mainZone","cat":"physics","ph":"X")") != std::string::npos);
+	AssertHelper::assertTrue(trace.find(R"({"name":"workerZone","cat":"physics","ph":"X")") != std::string::npos);
+	AssertHelper::assertUnsignedInt(countOccurrences(trace, R"("name":"thread_name")"), 2);
+}
+
+void ProfilerTest::chromeTraceRingBuffer()
+{
+	std::shared_ptr<Profiler> profiler = Profiler::getInstance("physics");
+	profiler->reset(true);
+	Profiler::clearTrace();
+
+	for(unsigned int i=0; i<20000; ++i)
+	{
+		ScopeProfiler scopeProfiler("physics", "loopZone");
+	}
+
+	std::stringstream traceStream;
+	Profiler::writeChromeTrace(traceStream);
+	profiler->reset(false);
+	Profiler::clearTrace();
+
+	AssertHelper::assertUnsignedInt(countOccurrences(traceStream.str(), R"("ph":"X")"), 16384); //oldest events overwritten
+	AssertHelper::assertTrue(traceStream.str().find(R"("ts":0.000,)") != std::string::npos);
+}
+
+CppUnit::Test *ProfilerTest::suite()
+{
+	auto *suite = new CppUnit::TestSuite("ProfilerTest");
+
+	suite->addTest(new CppUnit::TestCaller<ProfilerTest>("disabledProfiler", &ProfilerTest::disabledProfiler));
+	suite->addTest(new CppUnit::TestCaller<ProfilerTest>("hierarchicalProfile", &ProfilerTest::hierarchicalProfile));
+	suite->addTest(new CppUnit::TestCaller<ProfilerTest>("chromeTraceMultiThreads", &ProfilerTest::chromeTraceMultiThreads));
+	suite->addTest(new CppUnit::TestCaller<ProfilerTest>("chromeTraceRingBuffer", &ProfilerTest::chromeTraceRingBuffer));
+
+	return suite;
+}
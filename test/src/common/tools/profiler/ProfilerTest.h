@@ -0,0 +1,18 @@
+#ifndef URCHINENGINE_PROFILERTEST_H
+#define URCHINENGINE_PROFILERTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class ProfilerTest : public CppUnit::TestFixture
+{
+	public:
+		static CppUnit::Test *suite();
+
+		void disabledProfiler();
+		void hierarchicalProfile();
+		void chromeTraceMultiThreads();
+		void chromeTraceRingBuffer();
+};
+
+#endif
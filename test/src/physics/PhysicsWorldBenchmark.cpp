@@ -0,0 +1,203 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <chrono>
+#include <iostream>
+#include <sstream>
+
+#include "physics/PhysicsWorldBenchmark.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+namespace
+{
+	constexpr float TIME_STEP = 1.0f / 60.0f;
+
+	RigidBody *createGround(float halfSize)
+	{
+		std::shared_ptr<CollisionBoxShape> groundShape = std::make_shared<CollisionBoxShape>(Vector3<float>(halfSize, 0.5f, halfSize));
+		return new RigidBody("ground", Transform<float>(Point3<float>(0.0f, -0.5f, 0.0f), Quaternion<float>(), 1.0f), groundShape);
+	}
+}
+
+/**
+ * Pyramid of 210 boxes (base of 20 boxes) which must stay stable.
+ */
+void PhysicsWorldBenchmark::boxPyramid()
+{
+	constexpr unsigned int PYRAMID_BASE = 20;
+	auto *physicsWorld = new PhysicsWorld();
+	physicsWorld->addBody(createGround(100.0f));
+
+	std::shared_ptr<CollisionBoxShape> boxShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+	for(unsigned int level = 0; level < PYRAMID_BASE; ++level)
+	{
+		unsigned int numBoxes = PYRAMID_BASE - level;
+		for(unsigned int i = 0; i < numBoxes; ++i)
+		{
+			float x = (float)i * 1.05f - (float)numBoxes * 0.525f;
+			auto *boxBody = new RigidBody("box_" + std::to_string(level) + "_" + std::to_string(i), Transform<float>(Point3<float>(x, 0.5f + (float)level, 0.0f), Quaternion<float>(), 1.0f), boxShape);
+			boxBody->setMass(1.0f);
+			physicsWorld->addBody(boxBody);
+		}
+	}
+
+	runScenario("boxPyramid", physicsWorld, 300);
+
+	delete physicsWorld;
+}
+
+/**
+ * 10k small boxes and spheres falling on a ground.
+ */
+void PhysicsWorldBenchmark::debris()
+{
+	constexpr unsigned int DEBRIS_GRID_SIZE = 100;
+	auto *physicsWorld = new PhysicsWorld();
+	physicsWorld->addBody(createGround(200.0f));
+
+	std::shared_ptr<CollisionBoxShape> boxShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.2f, 0.2f, 0.2f));
+	std::shared_ptr<CollisionSphereShape> sphereShape = std::make_shared<CollisionSphereShape>(0.2f);
+	for(unsigned int x = 0; x < DEBRIS_GRID_SIZE; ++x)
+	{
+		for(unsigned int z = 0; z < DEBRIS_GRID_SIZE; ++z)
+		{
+			std::shared_ptr<const CollisionShape3D> debrisShape = (x + z) % 2 == 0 ? std::static_pointer_cast<const CollisionShape3D>(boxShape) : sphereShape;
+			Point3<float> position((float)x - 50.0f, 1.0f + (float)((x * 7 + z * 13) % 10) * 0.5f, (float)z - 50.0f);
+			auto *debrisBody = new RigidBody("debris_" + std::to_string(x) + "_" + std::to_string(z), Transform<float>(position, Quaternion<float>(), 1.0f), debrisShape);
+			debrisBody->setMass(0.5f);
+			physicsWorld->addBody(debrisBody);
+		}
+	}
+
+	runScenario("debris", physicsWorld, 60);
+
+	delete physicsWorld;
+}
+
+/**
+ * 200 boxes and spheres sliding on a sloping heightfield terrain.
+ */
+void PhysicsWorldBenchmark::terrainSlide()
+{
+	constexpr unsigned int TERRAIN_SIZE = 64;
+	auto *physicsWorld = new PhysicsWorld();
+
+	std::vector<Point3<float>> terrainPoints;
+	for(unsigned int z = 0; z < TERRAIN_SIZE; ++z)
+	{
+		for(unsigned int x = 0; x < TERRAIN_SIZE; ++x)
+		{
+			float height = (float)(TERRAIN_SIZE - x) * 0.4f + (float)((x * 3 + z * 5) % 4) * 0.05f;
+			terrainPoints.emplace_back(Point3<float>((float)x - (float)(TERRAIN_SIZE - 1) / 2.0f, height, (float)z - (float)(TERRAIN_SIZE - 1) / 2.0f));
+		}
+	}
+	std::shared_ptr<CollisionHeightfieldShape> terrainShape = std::make_shared<CollisionHeightfieldShape>(terrainPoints, TERRAIN_SIZE, TERRAIN_SIZE);
+	physicsWorld->addBody(new RigidBody("terrain", Transform<float>(Point3<float>(0.0f, 0.0f, 0.0f), Quaternion<float>(), 1.0f), terrainShape));
+
+	std::shared_ptr<CollisionBoxShape> boxShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.4f, 0.4f, 0.4f));
+	std::shared_ptr<CollisionSphereShape> sphereShape = std::make_shared<CollisionSphereShape>(0.4f);
+	for(unsigned int i = 0; i < 200; ++i)
+	{
+		std::shared_ptr<const CollisionShape3D> bodyShape = i % 2 == 0 ? std::static_pointer_cast<const CollisionShape3D>(boxShape) : sphereShape;
+		Point3<float> position((float)(i % 10) * 1.5f - 25.0f, 28.0f + (float)(i / 100) * 2.0f, (float)((i / 10) % 10) * 1.5f - 7.5f);
+		auto *body = new RigidBody("slider_" + std::to_string(i), Transform<float>(position, Quaternion<float>(), 1.0f), bodyShape);
+		body->setMass(1.0f);
+		physicsWorld->addBody(body);
+	}
+
+	runScenario("terrainSlide", physicsWorld, 300);
+
+	delete physicsWorld;
+}
+
+/**
+ * 100 character controllers crossing each other between boxes. Characters are updated after each physics step.
+ */
+void PhysicsWorldBenchmark::characterCrowd()
+{
+	constexpr unsigned int NUM_CHARACTERS = 100;
+	auto *physicsWorld = new PhysicsWorld();
+	physicsWorld->addBody(createGround(100.0f));
+
+	std::shared_ptr<CollisionBoxShape> boxShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.4f, 0.4f, 0.4f));
+	for(unsigned int i = 0; i < 100; ++i)
+	{
+		auto *boxBody = new RigidBody("box_" + std::to_string(i), Transform<float>(Point3<float>((float)(i % 10) * 3.0f - 13.5f, 0.4f, (float)(i / 10) * 3.0f - 13.5f), Quaternion<float>(), 1.0f), boxShape);
+		boxBody->setMass(1.0f);
+		physicsWorld->addBody(boxBody);
+	}
+
+	std::vector<PhysicsCharacterController *> characterControllers;
+	std::shared_ptr<CollisionCapsuleShape> characterShape = std::make_shared<CollisionCapsuleShape>(0.25f, 1.2f, CapsuleShape<float>::CAPSULE_Y);
+	for(unsigned int i = 0; i < NUM_CHARACTERS; ++i)
+	{
+		PhysicsTransform characterTransform(Point3<float>((float)(i % 10) * 3.0f - 12.0f, 1.0f, (float)(i / 10) * 3.0f - 12.0f));
+		auto physicsCharacter = std::make_shared<PhysicsCharacter>("character" + std::to_string(i), 80.0f, characterShape, characterTransform);
+		auto *characterController = new PhysicsCharacterController(physicsCharacter, physicsWorld);
+		characterController->setMomentum(Vector3<float>((i % 2 == 0) ? 80.0f : -80.0f, 0.0f, (i % 3 == 0) ? 40.0f : -40.0f));
+		characterControllers.push_back(characterController);
+	}
+
+	runScenario("characterCrowd", physicsWorld, 300, [&](float dt) {
+		for(auto characterController : characterControllers)
+		{
+			characterController->update(dt);
+		}
+	});
+
+	for(auto characterController : characterControllers)
+	{
+		delete characterController;
+	}
+	delete physicsWorld;
+}
+
+/**
+ * Process the physics steps in the current thread and print the timings of the profiler nodes in JSON format
+ * (one line by scenario).
+ * @param stepCallback Callback executed after each step (e.g. character controllers update)
+ */
+void PhysicsWorldBenchmark::runScenario(const std::string &scenarioName, PhysicsWorld *physicsWorld, unsigned int numSteps, const std::function<void(float)> &stepCallback)
+{
+	std::shared_ptr<Profiler> physicsProfiler = Profiler::getInstance("physics");
+	physicsProfiler->reset(true);
+	physicsWorld->play();
+
+	auto startTime = std::chrono::high_resolution_clock::now();
+	for(unsigned int step = 0; step < numSteps; ++step)
+	{
+		physicsWorld->processSteps(TIME_STEP, 1);
+		if(stepCallback)
+		{
+			stepCallback(TIME_STEP);
+		}
+	}
+	auto endTime = std::chrono::high_resolution_clock::now();
+	double durationMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+	physicsWorld->controlExecution();
+
+	std::stringstream jsonStream;
+	jsonStream << "{\"benchmark\":\"PhysicsWorldBenchmark\",\"scenario\":\"" << scenarioName << "\"";
+	jsonStream << ",\"bodies\":" << physicsWorld->getBodyManager()->getWorkBodies().size();
+	jsonStream << ",\"steps\":" << numSteps;
+	jsonStream << ",\"durationMs\":" << durationMs;
+	jsonStream << ",\"profiler\":";
+	physicsProfiler->writeJson(jsonStream);
+	jsonStream << "}";
+	physicsProfiler->reset(false); //profiling results must not be logged in a file at physics world destruction
+
+	AssertHelper::assertTrue(durationMs > 0.0, "Physics steps must be processed");
+	std::cout << std::endl << jsonStream.str() << std::endl;
+}
+
+CppUnit::Test *PhysicsWorldBenchmark::suite()
+{
+	auto *suite = new CppUnit::TestSuite("PhysicsWorldBenchmark");
+
+	suite->addTest(new CppUnit::TestCaller<PhysicsWorldBenchmark>("boxPyramid", &PhysicsWorldBenchmark::boxPyramid));
+	suite->addTest(new CppUnit::TestCaller<PhysicsWorldBenchmark>("debris", &PhysicsWorldBenchmark::debris));
+	suite->addTest(new CppUnit::TestCaller<PhysicsWorldBenchmark>("terrainSlide", &PhysicsWorldBenchmark::terrainSlide));
+	suite->addTest(new CppUnit::TestCaller<PhysicsWorldBenchmark>("characterCrowd", &PhysicsWorldBenchmark::characterCrowd));
+
+	return suite;
+}
@@ -0,0 +1,25 @@
+#ifndef URCHINENGINE_PHYSICSWORLDBENCHMARK_H
+#define URCHINENGINE_PHYSICSWORLDBENCHMARK_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include <functional>
+#include <string>
+
+#include "UrchinPhysicsEngine.h"
+
+class PhysicsWorldBenchmark : public CppUnit::TestFixture
+{
+	public:
+		static CppUnit::Test *suite();
+
+		void boxPyramid();
+		void debris();
+		void terrainSlide();
+		void characterCrowd();
+
+	private:
+		void runScenario(const std::string &, urchin::PhysicsWorld *, unsigned int, const std::function<void(float)> &stepCallback = nullptr);
+};
+
+#endif
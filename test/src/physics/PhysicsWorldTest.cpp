@@ -0,0 +1,72 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <thread>
+#include <mutex>
+#include "UrchinPhysicsEngine.h"
+
+#include "AssertHelper.h"
+#include "physics/PhysicsWorldTest.h"
+using namespace urchin;
+
+namespace
+{
+    class TimeStepRecorder : public Processable
+    {
+        public:
+            void initialize(PhysicsWorld *) override
+            {
+
+            }
+
+            void setup(float dt, const Vector3<float> &) override
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                timeSteps.push_back(dt);
+            }
+
+            void execute(float, const Vector3<float> &) override
+            {
+
+            }
+
+            std::vector<float> getTimeSteps() const
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                return timeSteps;
+            }
+
+        private:
+            mutable std::mutex mutex;
+            std::vector<float> timeSteps;
+    };
+}
+
+void PhysicsWorldTest::fixedTimeStep()
+{
+    constexpr float TIME_STEP = 1.0f / 100.0f;
+    auto *physicsWorld = new PhysicsWorld();
+    std::shared_ptr<TimeStepRecorder> timeStepRecorder = std::make_shared<TimeStepRecorder>();
+    physicsWorld->addProcessable(timeStepRecorder);
+
+    physicsWorld->start(TIME_STEP);
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    float interpolationFactor = physicsWorld->getInterpolationFactor();
+    delete physicsWorld;
+
+    std::vector<float> timeSteps = timeStepRecorder->getTimeSteps();
+    AssertHelper::assertTrue(timeSteps.size() >= 10, "Physics steps must be processed: " + std::to_string(timeSteps.size()));
+    for(float timeStep : timeSteps)
+    {
+        AssertHelper::assertTrue(timeStep == TIME_STEP, "Physics must be processed with a fixed time step");
+    }
+    AssertHelper::assertTrue(interpolationFactor >= 0.0f && interpolationFactor <= 1.0f);
+}
+
+CppUnit::Test *PhysicsWorldTest::suite()
+{
+    auto *suite = new CppUnit::TestSuite("PhysicsWorldTest");
+
+    suite->addTest(new CppUnit::TestCaller<PhysicsWorldTest>("fixedTimeStep", &PhysicsWorldTest::fixedTimeStep));
+
+    return suite;
+}
@@ -0,0 +1,15 @@
+#ifndef URCHINENGINE_PHYSICSWORLDTEST_H
+#define URCHINENGINE_PHYSICSWORLDTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class PhysicsWorldTest : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void fixedTimeStep();
+};
+
+#endif
@@ -0,0 +1,83 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <memory>
+#include <vector>
+#include "UrchinCommon.h"
+#include "UrchinPhysicsEngine.h"
+
+#include "AssertHelper.h"
+#include "physics/body/BodyStateStoreTest.h"
+using namespace urchin;
+
+void BodyStateStoreTest::workBodyViewOnStore()
+{
+	BodyStateStore bodyStateStore;
+	auto boxShape = std::make_shared<const CollisionBoxShape>(Vector3<float>(1.0f, 1.0f, 1.0f));
+	WorkRigidBody workBody("body", PhysicsTransform(Point3<float>(1.0f, 2.0f, 3.0f)), boxShape, bodyStateStore);
+
+	workBody.setMassProperties(2.0f, Vector3<float>(1.0f, 1.0f, 1.0f));
+	workBody.setLinearVelocity(Vector3<float>(4.0f, 0.0f, 0.0f));
+	workBody.setPosition(Point3<float>(5.0f, 2.0f, 3.0f));
+
+	unsigned int stateIndex = workBody.getStateIndex();
+	AssertHelper::assertUnsignedInt(bodyStateStore.getNumberBodies(), 1);
+	AssertHelper::assertTrue(bodyStateStore.getActiveFlags()[stateIndex] == 1);
+	AssertHelper::assertFloatEquals(bodyStateStore.getInvMasses()[stateIndex], 0.5f);
+	AssertHelper::assertVector3FloatEquals(bodyStateStore.getLinearVelocities()[stateIndex], Vector3<float>(4.0f, 0.0f, 0.0f));
+	AssertHelper::assertPoint3FloatEquals(bodyStateStore.getTransforms()[stateIndex].getPosition(), Point3<float>(5.0f, 2.0f, 3.0f));
+
+	bodyStateStore.getAngularVelocities()[stateIndex] = Vector3<float>(0.0f, 1.0f, 0.0f);
+	AssertHelper::assertVector3FloatEquals(workBody.getAngularVelocity(), Vector3<float>(0.0f, 1.0f, 0.0f));
+}
+
+void BodyStateStoreTest::removeBodyMoveLastBodyState()
+{
+	BodyStateStore bodyStateStore;
+	auto boxShape = std::make_shared<const CollisionBoxShape>(Vector3<float>(1.0f, 1.0f, 1.0f));
+	auto *workBody1 = new WorkRigidBody("body1", PhysicsTransform(Point3<float>(1.0f, 0.0f, 0.0f)), boxShape, bodyStateStore);
+	auto *workBody2 = new WorkRigidBody("body2", PhysicsTransform(Point3<float>(2.0f, 0.0f, 0.0f)), boxShape, bodyStateStore);
+	auto *workBody3 = new WorkRigidBody("body3", PhysicsTransform(Point3<float>(3.0f, 0.0f, 0.0f)), boxShape, bodyStateStore);
+	workBody3->setLinearVelocity(Vector3<float>(0.0f, 3.0f, 0.0f));
+
+	delete workBody1;
+
+	AssertHelper::assertUnsignedInt(bodyStateStore.getNumberBodies(), 2);
+	AssertHelper::assertUnsignedInt(workBody3->getStateIndex(), 0);
+	AssertHelper::assertTrue(bodyStateStore.getBody(0) == workBody3);
+	AssertHelper::assertPoint3FloatEquals(workBody3->getPosition(), Point3<float>(3.0f, 0.0f, 0.0f));
+	AssertHelper::assertVector3FloatEquals(workBody3->getLinearVelocity(), Vector3<float>(0.0f, 3.0f, 0.0f));
+	AssertHelper::assertPoint3FloatEquals(workBody2->getPosition(), Point3<float>(2.0f, 0.0f, 0.0f));
+
+	delete workBody2;
+	delete workBody3;
+	AssertHelper::assertUnsignedInt(bodyStateStore.getNumberBodies(), 0);
+}
+
+void BodyStateStoreTest::growStoreKeepBodiesState()
+{
+	constexpr unsigned int NUM_BODIES = 500;
+	BodyStateStore bodyStateStore;
+	auto boxShape = std::make_shared<const CollisionBoxShape>(Vector3<float>(1.0f, 1.0f, 1.0f));
+
+	std::vector<std::unique_ptr<WorkRigidBody>> workBodies;
+	for(unsigned int i = 0; i < NUM_BODIES; ++i)
+	{
+		workBodies.push_back(std::make_unique<WorkRigidBody>("body", PhysicsTransform(Point3<float>((float)i, 0.0f, 0.0f)), boxShape, bodyStateStore));
+	}
+
+	for(unsigned int i = 0; i < NUM_BODIES; ++i)
+	{
+		AssertHelper::assertPoint3FloatEquals(workBodies[i]->getPosition(), Point3<float>((float)i, 0.0f, 0.0f));
+	}
+}
+
+CppUnit::Test *BodyStateStoreTest::suite()
+{
+	auto *suite = new CppUnit::TestSuite("BodyStateStoreTest");
+
+	suite->addTest(new CppUnit::TestCaller<BodyStateStoreTest>("workBodyViewOnStore", &BodyStateStoreTest::workBodyViewOnStore));
+	suite->addTest(new CppUnit::TestCaller<BodyStateStoreTest>("removeBodyMoveLastBodyState", &BodyStateStoreTest::removeBodyMoveLastBodyState));
+	suite->addTest(new CppUnit::TestCaller<BodyStateStoreTest>("growStoreKeepBodiesState", &BodyStateStoreTest::growStoreKeepBodiesState));
+
+	return suite;
+}
@@ -0,0 +1,17 @@
+#ifndef URCHINENGINE_BODYSTATESTORETEST_H
+#define URCHINENGINE_BODYSTATESTORETEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class BodyStateStoreTest : public CppUnit::TestFixture
+{
+	public:
+		static CppUnit::Test *suite();
+
+		void workBodyViewOnStore();
+		void removeBodyMoveLastBodyState();
+		void growStoreKeepBodiesState();
+};
+
+#endif
@@ -0,0 +1,68 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <thread>
+#include <atomic>
+#include "UrchinCommon.h"
+#include "UrchinPhysicsEngine.h"
+
+#include "AssertHelper.h"
+#include "physics/body/TransformDoubleBufferTest.h"
+using namespace urchin;
+
+void TransformDoubleBufferTest::interpolateTwoLastTransforms()
+{
+	TransformDoubleBuffer transformDoubleBuffer(Transform<float>(Point3<float>(0.0f, 0.0f, 0.0f)));
+	transformDoubleBuffer.publish(Transform<float>(Point3<float>(1.0f, 0.0f, 0.0f)), false);
+	transformDoubleBuffer.publish(Transform<float>(Point3<float>(3.0f, 0.0f, 0.0f), Quaternion<float>(Vector3<float>(0.0f, 1.0f, 0.0f), PI_VALUE / 2.0f)), false);
+
+	Transform<float> interpolatedTransform = transformDoubleBuffer.interpolate(0.5f);
+
+	AssertHelper::assertPoint3FloatEquals(interpolatedTransform.getPosition(), Point3<float>(2.0f, 0.0f, 0.0f));
+	AssertHelper::assertQuaternionFloatEquals(interpolatedTransform.getOrientation(), Quaternion<float>(Vector3<float>(0.0f, 1.0f, 0.0f), PI_VALUE / 4.0f));
+}
+
+void TransformDoubleBufferTest::publishWithResetPrevious()
+{
+	TransformDoubleBuffer transformDoubleBuffer(Transform<float>(Point3<float>(0.0f, 0.0f, 0.0f)));
+	transformDoubleBuffer.publish(Transform<float>(Point3<float>(10.0f, 0.0f, 0.0f)), true);
+
+	AssertHelper::assertPoint3FloatEquals(transformDoubleBuffer.interpolate(0.0f).getPosition(), Point3<float>(10.0f, 0.0f, 0.0f));
+	AssertHelper::assertPoint3FloatEquals(transformDoubleBuffer.interpolate(1.0f).getPosition(), Point3<float>(10.0f, 0.0f, 0.0f));
+}
+
+void TransformDoubleBufferTest::interpolateWhilePublishing()
+{
+	constexpr unsigned int NUM_PUBLICATIONS = 200000;
+	TransformDoubleBuffer transformDoubleBuffer(Transform<float>(Point3<float>(0.0f, 0.0f, 0.0f)));
+	std::atomic_bool publicationsDone(false);
+
+	std::thread publisherThread([&]() {
+		for(unsigned int i = 1; i <= NUM_PUBLICATIONS; ++i)
+		{ //all coordinates of a published position are equals
+			transformDoubleBuffer.publish(Transform<float>(Point3<float>((float)i, (float)i, (float)i)), false);
+		}
+		publicationsDone.store(true, std::memory_order_release);
+	});
+
+	bool tornTransformRead = false;
+	while(!publicationsDone.load(std::memory_order_acquire))
+	{
+		Point3<float> position = transformDoubleBuffer.interpolate(0.5f).getPosition();
+		tornTransformRead |= (position.X != position.Y || position.X != position.Z);
+	}
+	publisherThread.join();
+
+	AssertHelper::assertTrue(!tornTransformRead, "Interpolated transform must not mix published transforms");
+	AssertHelper::assertFloatEquals(transformDoubleBuffer.interpolate(0.5f).getPosition().X, (float)NUM_PUBLICATIONS - 0.5f);
+}
+
+CppUnit::Test *TransformDoubleBufferTest::suite()
+{
+	auto *suite = new CppUnit::TestSuite("TransformDoubleBufferTest");
+
+	suite->addTest(new CppUnit::TestCaller<TransformDoubleBufferTest>("interpolateTwoLastTransforms", &TransformDoubleBufferTest::interpolateTwoLastTransforms));
+	suite->addTest(new CppUnit::TestCaller<TransformDoubleBufferTest>("publishWithResetPrevious", &TransformDoubleBufferTest::publishWithResetPrevious));
+	suite->addTest(new CppUnit::TestCaller<TransformDoubleBufferTest>("interpolateWhilePublishing", &TransformDoubleBufferTest::interpolateWhilePublishing));
+
+	return suite;
+}
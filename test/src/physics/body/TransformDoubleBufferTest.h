@@ -0,0 +1,17 @@
+#ifndef URCHINENGINE_TRANSFORMDOUBLEBUFFERTEST_H
+#define URCHINENGINE_TRANSFORMDOUBLEBUFFERTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class TransformDoubleBufferTest : public CppUnit::TestFixture
+{
+	public:
+		static CppUnit::Test *suite();
+
+		void interpolateTwoLastTransforms();
+		void publishWithResetPrevious();
+		void interpolateWhilePublishing();
+};
+
+#endif
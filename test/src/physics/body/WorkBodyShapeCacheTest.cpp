@@ -0,0 +1,84 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <memory>
+#include "UrchinCommon.h"
+#include "UrchinPhysicsEngine.h"
+
+#include "AssertHelper.h"
+#include "physics/body/WorkBodyShapeCacheTest.h"
+using namespace urchin;
+
+void WorkBodyShapeCacheTest::cachedConvexObjectReused()
+{
+	BodyStateStore bodyStateStore;
+	auto boxShape = std::make_shared<const CollisionBoxShape>(Vector3<float>(1.0f, 1.0f, 1.0f));
+	WorkRigidBody workBody("body", PhysicsTransform(Point3<float>(1.0f, 2.0f, 3.0f)), boxShape, bodyStateStore);
+
+	AssertHelper::assertTrue(workBody.getCachedConvexObject() == nullptr, "Convex object must not be cached before the first refresh");
+
+	workBody.refreshCachedConvexObject();
+	const CollisionConvexObject3D *convexObject = workBody.getCachedConvexObject();
+	workBody.refreshCachedConvexObject();
+
+	AssertHelper::assertTrue(convexObject != nullptr);
+	AssertHelper::assertTrue(workBody.getCachedConvexObject() == convexObject, "Convex object must be reused when body doesn't move");
+	AssertHelper::assertPoint3FloatEquals(convexObject->getSupportPoint(Vector3<float>(1.0f, 1.0f, 1.0f), true), Point3<float>(2.0f, 3.0f, 4.0f));
+}
+
+void WorkBodyShapeCacheTest::cachedConvexObjectInvalidatedByMove()
+{
+	BodyStateStore bodyStateStore;
+	auto boxShape = std::make_shared<const CollisionBoxShape>(Vector3<float>(1.0f, 1.0f, 1.0f));
+	WorkRigidBody workBody("body", PhysicsTransform(Point3<float>(1.0f, 2.0f, 3.0f)), boxShape, bodyStateStore);
+	workBody.refreshCachedConvexObject();
+
+	workBody.setPosition(Point3<float>(5.0f, 2.0f, 3.0f));
+	AssertHelper::assertTrue(workBody.getCachedConvexObject() == nullptr, "Outdated convex object must not be returned");
+
+	workBody.refreshCachedConvexObject();
+	AssertHelper::assertPoint3FloatEquals(workBody.getCachedConvexObject()->getSupportPoint(Vector3<float>(1.0f, 1.0f, 1.0f), true), Point3<float>(6.0f, 3.0f, 4.0f));
+}
+
+void WorkBodyShapeCacheTest::cachedAABBoxFollowsTransform()
+{
+	BodyStateStore bodyStateStore;
+	auto boxShape = std::make_shared<const CollisionBoxShape>(Vector3<float>(1.0f, 1.0f, 1.0f));
+	WorkRigidBody workBody("body", PhysicsTransform(Point3<float>(1.0f, 2.0f, 3.0f)), boxShape, bodyStateStore);
+
+	AssertHelper::assertPoint3FloatEquals(workBody.getAABBox().getMin(), Point3<float>(0.0f, 1.0f, 2.0f));
+
+	workBody.setPosition(Point3<float>(5.0f, 2.0f, 3.0f));
+	AssertHelper::assertPoint3FloatEquals(workBody.getAABBox().getMin(), Point3<float>(4.0f, 1.0f, 2.0f));
+	AssertHelper::assertPoint3FloatEquals(workBody.getAABBox().getMax(), Point3<float>(6.0f, 3.0f, 4.0f));
+}
+
+void WorkBodyShapeCacheTest::noCachedConvexObjectForConcaveShape()
+{
+	std::vector<Point3<float>> heightfieldPoints;
+	for(unsigned int z=0; z<3; ++z)
+	{
+		for(unsigned int x=0; x<3; ++x)
+		{
+			heightfieldPoints.emplace_back(Point3<float>((float)x - 1.0f, 0.0f, (float)z - 1.0f));
+		}
+	}
+	BodyStateStore bodyStateStore;
+	auto heightfieldShape = std::make_shared<const CollisionHeightfieldShape>(heightfieldPoints, 3, 3);
+	WorkRigidBody workBody("heightfield", PhysicsTransform(), heightfieldShape, bodyStateStore);
+
+	workBody.refreshCachedConvexObject();
+
+	AssertHelper::assertTrue(workBody.getCachedConvexObject() == nullptr);
+}
+
+CppUnit::Test *WorkBodyShapeCacheTest::suite()
+{
+	auto *suite = new CppUnit::TestSuite("WorkBodyShapeCacheTest");
+
+	suite->addTest(new CppUnit::TestCaller<WorkBodyShapeCacheTest>("cachedConvexObjectReused", &WorkBodyShapeCacheTest::cachedConvexObjectReused));
+	suite->addTest(new CppUnit::TestCaller<WorkBodyShapeCacheTest>("cachedConvexObjectInvalidatedByMove", &WorkBodyShapeCacheTest::cachedConvexObjectInvalidatedByMove));
+	suite->addTest(new CppUnit::TestCaller<WorkBodyShapeCacheTest>("cachedAABBoxFollowsTransform", &WorkBodyShapeCacheTest::cachedAABBoxFollowsTransform));
+	suite->addTest(new CppUnit::TestCaller<WorkBodyShapeCacheTest>("noCachedConvexObjectForConcaveShape", &WorkBodyShapeCacheTest::noCachedConvexObjectForConcaveShape));
+
+	return suite;
+}
@@ -0,0 +1,18 @@
+#ifndef URCHINENGINE_WORKBODYSHAPECACHETEST_H
+#define URCHINENGINE_WORKBODYSHAPECACHETEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class WorkBodyShapeCacheTest : public CppUnit::TestFixture
+{
+	public:
+		static CppUnit::Test *suite();
+
+		void cachedConvexObjectReused();
+		void cachedConvexObjectInvalidatedByMove();
+		void cachedAABBoxFollowsTransform();
+		void noCachedConvexObjectForConcaveShape();
+};
+
+#endif
@@ -0,0 +1,125 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+#include <atomic>
+
+#include "physics/character/CharacterControllerBenchmark.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+namespace
+{
+    class StepCounter : public Processable
+    {
+        public:
+            StepCounter() : numSteps(0)
+            {
+
+            }
+
+            void initialize(PhysicsWorld *) override
+            {
+
+            }
+
+            void setup(float, const Vector3<float> &) override
+            {
+                numSteps.fetch_add(1, std::memory_order_relaxed);
+            }
+
+            void execute(float, const Vector3<float> &) override
+            {
+
+            }
+
+            unsigned int getNumSteps() const
+            {
+                return numSteps.load(std::memory_order_relaxed);
+            }
+
+        private:
+            std::atomic_uint numSteps;
+    };
+}
+
+/**
+ * Update 50 character controllers, each one in its own thread, while the physics thread simulates 400 boxes around them.
+ */
+void CharacterControllerBenchmark::concurrentCharacterControllers()
+{
+    constexpr unsigned int NUM_CHARACTERS = 50;
+    constexpr unsigned int NUM_UPDATES = 200;
+    constexpr float TIME_STEP = 1.0f / 60.0f;
+    auto *physicsWorld = new PhysicsWorld();
+
+    std::shared_ptr<CollisionBoxShape> groundShape = std::make_shared<CollisionBoxShape>(Vector3<float>(100.0f, 0.5f, 100.0f));
+    physicsWorld->addBody(new RigidBody("ground", Transform<float>(Point3<float>(0.0f, -0.5f, 0.0f), Quaternion<float>(), 1.0f), groundShape));
+    std::shared_ptr<CollisionBoxShape> boxShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.4f, 0.4f, 0.4f));
+    for(unsigned int x = 0; x < 20; ++x)
+    {
+        for(unsigned int z = 0; z < 20; ++z)
+        {
+            std::string bodyId = "box_" + std::to_string(x) + "_" + std::to_string(z);
+            auto *boxBody = new RigidBody(bodyId, Transform<float>(Point3<float>((float)x * 2.0f - 20.0f, 2.0f, (float)z * 2.0f - 20.0f), Quaternion<float>(), 1.0f), boxShape);
+            boxBody->setMass(1.0f);
+            physicsWorld->addBody(boxBody);
+        }
+    }
+
+    std::vector<PhysicsCharacterController *> characterControllers;
+    std::shared_ptr<CollisionCapsuleShape> characterShape = std::make_shared<CollisionCapsuleShape>(0.25f, 1.2f, CapsuleShape<float>::CAPSULE_Y);
+    for(unsigned int i = 0; i < NUM_CHARACTERS; ++i)
+    {
+        PhysicsTransform characterTransform(Point3<float>((float)(i % 10) * 2.0f - 9.0f, 1.0f, (float)(i / 10) * 2.0f - 5.0f));
+        auto physicsCharacter = std::make_shared<PhysicsCharacter>("character" + std::to_string(i), 80.0f, characterShape, characterTransform);
+        auto *characterController = new PhysicsCharacterController(physicsCharacter, physicsWorld);
+        characterController->setMomentum(Vector3<float>((i % 2 == 0) ? 80.0f : -80.0f, 0.0f, 0.0f));
+        characterControllers.push_back(characterController);
+    }
+
+    std::shared_ptr<StepCounter> stepCounter = std::make_shared<StepCounter>();
+    physicsWorld->addProcessable(stepCounter);
+    physicsWorld->start(TIME_STEP);
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    std::vector<std::thread> characterThreads;
+    for(auto characterController : characterControllers)
+    {
+        characterThreads.emplace_back([characterController]() {
+            for(unsigned int update = 0; update < NUM_UPDATES; ++update)
+            {
+                characterController->update(TIME_STEP);
+            }
+        });
+    }
+    for(auto &characterThread : characterThreads)
+    {
+        characterThread.join();
+    }
+    auto endTime = std::chrono::high_resolution_clock::now();
+    double durationMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+    unsigned int numPhysicsSteps = stepCounter->getNumSteps();
+
+    physicsWorld->controlExecution();
+    for(auto characterController : characterControllers)
+    {
+        delete characterController;
+    }
+    delete physicsWorld;
+
+    AssertHelper::assertTrue(numPhysicsSteps > 0, "Physics thread must progress while characters are updated");
+    std::cout << std::fixed << std::setprecision(3) << "CharacterControllerBenchmark - characters: " << NUM_CHARACTERS << ", updates: " << NUM_CHARACTERS * NUM_UPDATES
+              << ", duration: " << durationMs << "ms, update: " << durationMs * 1000.0 / (NUM_CHARACTERS * NUM_UPDATES) << "us, physics steps: " << numPhysicsSteps << std::endl;
+}
+
+CppUnit::Test *CharacterControllerBenchmark::suite()
+{
+    auto *suite = new CppUnit::TestSuite("CharacterControllerBenchmark");
+
+    suite->addTest(new CppUnit::TestCaller<CharacterControllerBenchmark>("concurrentCharacterControllers", &CharacterControllerBenchmark::concurrentCharacterControllers));
+
+    return suite;
+}
@@ -0,0 +1,17 @@
+#ifndef URCHINENGINE_CHARACTERCONTROLLERBENCHMARK_H
+#define URCHINENGINE_CHARACTERCONTROLLERBENCHMARK_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+#include "UrchinPhysicsEngine.h"
+
+class CharacterControllerBenchmark : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void concurrentCharacterControllers();
+};
+
+#endif
@@ -0,0 +1,83 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+
+#include "physics/collision/broadphase/BroadPhaseBenchmark.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+/**
+ * Update broad phase with 1k boxes moving over a ground of 10k static boxes.
+ */
+void BroadPhaseBenchmark::movingBodiesOnStaticBodies()
+{
+    BodyStateStore bodyStateStore;
+    constexpr unsigned int STATIC_GRID_SIZE = 100;
+    constexpr unsigned int MOVING_GRID_SIZE_X = 40;
+    constexpr unsigned int MOVING_GRID_SIZE_Z = 25;
+    constexpr unsigned int NUM_STEPS = 100;
+    constexpr float MOVE_BY_STEP = 0.1f;
+    std::shared_ptr<CollisionBoxShape> boxShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    std::vector<std::unique_ptr<WorkRigidBody>> staticBodies;
+    std::vector<std::unique_ptr<WorkRigidBody>> movingBodies;
+    auto *broadPhaseAlgorithm = new AABBTreeAlgorithm();
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    for(unsigned int x = 0; x < STATIC_GRID_SIZE; ++x)
+    {
+        for(unsigned int z = 0; z < STATIC_GRID_SIZE; ++z)
+        {
+            std::string bodyId = "static_" + std::to_string(x) + "_" + std::to_string(z);
+            auto staticBody = std::make_unique<WorkRigidBody>(bodyId, PhysicsTransform(Point3<float>((float)x * 2.0f, 0.0f, (float)z * 2.0f), Quaternion<float>()), boxShape, bodyStateStore);
+            broadPhaseAlgorithm->addBody(staticBody.get(), nullptr);
+            staticBodies.push_back(std::move(staticBody));
+        }
+    }
+    for(unsigned int x = 0; x < MOVING_GRID_SIZE_X; ++x)
+    {
+        for(unsigned int z = 0; z < MOVING_GRID_SIZE_Z; ++z)
+        {
+            std::string bodyId = "moving_" + std::to_string(x) + "_" + std::to_string(z);
+            auto movingBody = std::make_unique<WorkRigidBody>(bodyId, PhysicsTransform(Point3<float>((float)x * 5.0f, 1.2f, (float)z * 8.0f), Quaternion<float>()), boxShape, bodyStateStore);
+            movingBody->setMassProperties(1.0f, Vector3<float>(1.0f, 1.0f, 1.0f));
+            broadPhaseAlgorithm->addBody(movingBody.get(), nullptr);
+            movingBodies.push_back(std::move(movingBody));
+        }
+    }
+    broadPhaseAlgorithm->updateBodies(); //build static tree
+    auto endTime = std::chrono::high_resolution_clock::now();
+    double addDurationMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+    startTime = std::chrono::high_resolution_clock::now();
+    for(unsigned int step = 0; step < NUM_STEPS; ++step)
+    {
+        for(std::size_t i = 0; i < movingBodies.size(); ++i)
+        {
+            const Point3<float> &position = movingBodies[i]->getPosition();
+            Vector3<float> moveDirection = (i % 2 == 0) ? Vector3<float>(MOVE_BY_STEP, 0.0f, 0.0f) : Vector3<float>(0.0f, 0.0f, MOVE_BY_STEP);
+            movingBodies[i]->setPosition(position.translate(moveDirection));
+        }
+        broadPhaseAlgorithm->updateBodies();
+    }
+    endTime = std::chrono::high_resolution_clock::now();
+    double stepDurationMs = std::chrono::duration<double, std::milli>(endTime - startTime).count() / NUM_STEPS;
+
+    std::size_t numOverlappingPairs = broadPhaseAlgorithm->getOverlappingPairs().size();
+    AssertHelper::assertTrue(numOverlappingPairs >= movingBodies.size());
+
+    std::cout << std::fixed << std::setprecision(3) << "BroadPhaseBenchmark - static bodies: " << staticBodies.size() << ", moving bodies: " << movingBodies.size()
+              << ", pairs: " << numOverlappingPairs << ", add: " << addDurationMs << "ms, step: " << stepDurationMs << "ms" << std::endl;
+
+    delete broadPhaseAlgorithm;
+}
+
+CppUnit::Test *BroadPhaseBenchmark::suite()
+{
+    auto *suite = new CppUnit::TestSuite("BroadPhaseBenchmark");
+
+    suite->addTest(new CppUnit::TestCaller<BroadPhaseBenchmark>("movingBodiesOnStaticBodies", &BroadPhaseBenchmark::movingBodiesOnStaticBodies));
+
+    return suite;
+}
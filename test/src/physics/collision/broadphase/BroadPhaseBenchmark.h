@@ -0,0 +1,17 @@
+#ifndef URCHINENGINE_BROADPHASEBENCHMARK_H
+#define URCHINENGINE_BROADPHASEBENCHMARK_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+#include "UrchinPhysicsEngine.h"
+
+class BroadPhaseBenchmark : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void movingBodiesOnStaticBodies();
+};
+
+#endif
@@ -0,0 +1,119 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include "UrchinPhysicsEngine.h"
+#include "collision/broadphase/HashPairContainer.h"
+
+#include "AssertHelper.h"
+#include "HashPairContainerTest.h"
+using namespace urchin;
+
+void HashPairContainerTest::addDuplicatePair()
+{
+    BodyStateStore bodyStateStore;
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    auto bodyA = std::make_unique<WorkRigidBody>("bodyA", PhysicsTransform(), cubeShape, bodyStateStore);
+    auto bodyB = std::make_unique<WorkRigidBody>("bodyB", PhysicsTransform(), cubeShape, bodyStateStore);
+    HashPairContainer pairContainer(16);
+
+    pairContainer.addOverlappingPair(bodyA.get(), bodyB.get());
+    pairContainer.addOverlappingPair(bodyB.get(), bodyA.get());
+
+    AssertHelper::assertUnsignedInt(pairContainer.getOverlappingPairs().size(), 1);
+    AssertHelper::assertString(pairContainer.getOverlappingPairs()[0]->getBody1()->getId(), "bodyA");
+    AssertHelper::assertString(pairContainer.getOverlappingPairs()[0]->getBody2()->getId(), "bodyB");
+}
+
+void HashPairContainerTest::removePairsOfBody()
+{
+    BodyStateStore bodyStateStore;
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    auto bodyA = std::make_unique<WorkRigidBody>("bodyA", PhysicsTransform(), cubeShape, bodyStateStore);
+    auto bodyB = std::make_unique<WorkRigidBody>("bodyB", PhysicsTransform(), cubeShape, bodyStateStore);
+    auto bodyC = std::make_unique<WorkRigidBody>("bodyC", PhysicsTransform(), cubeShape, bodyStateStore);
+    HashPairContainer pairContainer(16);
+    pairContainer.addOverlappingPair(bodyA.get(), bodyB.get());
+    pairContainer.addOverlappingPair(bodyA.get(), bodyC.get());
+    pairContainer.addOverlappingPair(bodyB.get(), bodyC.get());
+
+    pairContainer.removeOverlappingPairs(bodyA.get());
+
+    AssertHelper::assertUnsignedInt(pairContainer.getOverlappingPairs().size(), 1);
+    AssertHelper::assertString(pairContainer.getOverlappingPairs()[0]->getBody1()->getId(), "bodyB");
+    AssertHelper::assertString(pairContainer.getOverlappingPairs()[0]->getBody2()->getId(), "bodyC");
+}
+
+void HashPairContainerTest::removePairsOfSeveralBodies()
+{
+    BodyStateStore bodyStateStore;
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    auto bodyA = std::make_unique<WorkRigidBody>("bodyA", PhysicsTransform(), cubeShape, bodyStateStore);
+    auto bodyB = std::make_unique<WorkRigidBody>("bodyB", PhysicsTransform(), cubeShape, bodyStateStore);
+    auto bodyC = std::make_unique<WorkRigidBody>("bodyC", PhysicsTransform(), cubeShape, bodyStateStore);
+    auto bodyD = std::make_unique<WorkRigidBody>("bodyD", PhysicsTransform(), cubeShape, bodyStateStore);
+    HashPairContainer pairContainer(16);
+    pairContainer.addOverlappingPair(bodyA.get(), bodyB.get());
+    pairContainer.addOverlappingPair(bodyA.get(), bodyC.get());
+    pairContainer.addOverlappingPair(bodyB.get(), bodyC.get());
+    pairContainer.addOverlappingPair(bodyC.get(), bodyD.get());
+    pairContainer.addOverlappingPair(bodyB.get(), bodyD.get());
+
+    pairContainer.removeOverlappingPair(bodyD.get(), bodyB.get());
+    pairContainer.removeOverlappingPairs(bodyA.get());
+    pairContainer.removeOverlappingPairs(bodyB.get());
+    pairContainer.addOverlappingPair(bodyA.get(), bodyD.get());
+    pairContainer.removeOverlappingPairs(bodyC.get());
+
+    AssertHelper::assertUnsignedInt(pairContainer.getOverlappingPairs().size(), 1);
+    AssertHelper::assertString(pairContainer.getOverlappingPairs()[0]->getBody1()->getId(), "bodyA");
+    AssertHelper::assertString(pairContainer.getOverlappingPairs()[0]->getBody2()->getId(), "bodyD");
+}
+
+/**
+ * Add pairs until the pool and the hash table are full, remove half of them and check remaining pairs are still found.
+ */
+void HashPairContainerTest::addAndRemoveManyPairs()
+{
+    BodyStateStore bodyStateStore;
+    constexpr unsigned int NUM_BODIES = 200;
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    std::vector<std::unique_ptr<WorkRigidBody>> bodies;
+    for(unsigned int i = 0; i < NUM_BODIES; ++i)
+    {
+        bodies.push_back(std::make_unique<WorkRigidBody>("body" + std::to_string(i), PhysicsTransform(), cubeShape, bodyStateStore));
+    }
+    HashPairContainer pairContainer(NUM_BODIES);
+
+    for(unsigned int i = 0; i < NUM_BODIES - 1; ++i)
+    {
+        pairContainer.addOverlappingPair(bodies[i].get(), bodies[i + 1].get());
+    }
+    for(unsigned int i = 0; i < NUM_BODIES - 1; i += 2)
+    {
+        pairContainer.removeOverlappingPair(bodies[i + 1].get(), bodies[i].get());
+    }
+    for(unsigned int i = 0; i < NUM_BODIES - 1; ++i)
+    { //add again existing pairs (odd indexes) and removed pairs (even indexes)
+        pairContainer.addOverlappingPair(bodies[i].get(), bodies[i + 1].get());
+    }
+
+    AssertHelper::assertUnsignedInt(pairContainer.getOverlappingPairs().size(), NUM_BODIES - 1);
+    for(std::size_t i = 0; i < pairContainer.getOverlappingPairs().size(); ++i)
+    {
+        for(std::size_t j = i + 1; j < pairContainer.getOverlappingPairs().size(); ++j)
+        {
+            AssertHelper::assertTrue(pairContainer.getOverlappingPairs()[i]->getBodiesId() != pairContainer.getOverlappingPairs()[j]->getBodiesId());
+        }
+    }
+}
+
+CppUnit::Test *HashPairContainerTest::suite()
+{
+    auto *suite = new CppUnit::TestSuite("HashPairContainerTest");
+
+    suite->addTest(new CppUnit::TestCaller<HashPairContainerTest>("addDuplicatePair", &HashPairContainerTest::addDuplicatePair));
+    suite->addTest(new CppUnit::TestCaller<HashPairContainerTest>("removePairsOfBody", &HashPairContainerTest::removePairsOfBody));
+    suite->addTest(new CppUnit::TestCaller<HashPairContainerTest>("removePairsOfSeveralBodies", &HashPairContainerTest::removePairsOfSeveralBodies));
+    suite->addTest(new CppUnit::TestCaller<HashPairContainerTest>("addAndRemoveManyPairs", &HashPairContainerTest::addAndRemoveManyPairs));
+
+    return suite;
+}
@@ -8,10 +8,13 @@ using namespace urchin;
 
 void BodyAABBTreeTest::twoBodiesPairedAndRemove()
 {
+    BodyStateStore bodyStateStore;
     //add bodies test:
     std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
-    auto bodyA = std::make_unique<WorkRigidBody>("bodyA", PhysicsTransform(Point3<float>(0.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
-    auto bodyB = std::make_unique<WorkRigidBody>("bodyB", PhysicsTransform(Point3<float>(1.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
+    auto bodyA = std::make_unique<WorkRigidBody>("bodyA", PhysicsTransform(Point3<float>(0.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape, bodyStateStore);
+    bodyA->setMassProperties(1.0f, Vector3<float>(1.0f, 1.0f, 1.0f));
+    auto bodyB = std::make_unique<WorkRigidBody>("bodyB", PhysicsTransform(Point3<float>(1.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape, bodyStateStore);
+    bodyB->setMassProperties(1.0f, Vector3<float>(1.0f, 1.0f, 1.0f));
     BodyAABBTree bodyAabbTree;
     bodyAabbTree.addBody(bodyA.get(), nullptr);
     bodyAabbTree.addBody(bodyB.get(), nullptr);
@@ -29,9 +32,10 @@ void BodyAABBTreeTest::twoBodiesPairedAndRemove()
 
 void BodyAABBTreeTest::twoBodiesNotPaired()
 {
+    BodyStateStore bodyStateStore;
     std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
-    auto bodyA = std::make_unique<WorkRigidBody>("bodyA", PhysicsTransform(Point3<float>(0.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
-    auto bodyB = std::make_unique<WorkRigidBody>("bodyB", PhysicsTransform(Point3<float>(10.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
+    auto bodyA = std::make_unique<WorkRigidBody>("bodyA", PhysicsTransform(Point3<float>(0.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape, bodyStateStore);
+    auto bodyB = std::make_unique<WorkRigidBody>("bodyB", PhysicsTransform(Point3<float>(10.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape, bodyStateStore);
     BodyAABBTree bodyAabbTree;
     bodyAabbTree.addBody(bodyA.get(), nullptr);
     bodyAabbTree.addBody(bodyB.get(), nullptr);
@@ -39,6 +43,45 @@ void BodyAABBTreeTest::twoBodiesNotPaired()
     AssertHelper::assertUnsignedInt(bodyAabbTree.getOverlappingPairs().size(), 0);
 }
 
+void BodyAABBTreeTest::twoStaticBodiesNotPaired()
+{
+    BodyStateStore bodyStateStore;
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    auto bodyA = std::make_unique<WorkRigidBody>("bodyA", PhysicsTransform(Point3<float>(0.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape, bodyStateStore);
+    auto bodyB = std::make_unique<WorkRigidBody>("bodyB", PhysicsTransform(Point3<float>(1.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape, bodyStateStore);
+    BodyAABBTree bodyAabbTree;
+    bodyAabbTree.addBody(bodyA.get(), nullptr);
+    bodyAabbTree.addBody(bodyB.get(), nullptr);
+
+    AssertHelper::assertUnsignedInt(bodyAabbTree.getOverlappingPairs().size(), 0);
+}
+
+void BodyAABBTreeTest::dynamicBodyMovedOnStaticBody()
+{
+    BodyStateStore bodyStateStore;
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    std::vector<std::unique_ptr<WorkRigidBody>> staticBodies;
+    BodyAABBTree bodyAabbTree;
+    for(unsigned int i=0; i<10; ++i)
+    {
+        auto staticBody = std::make_unique<WorkRigidBody>("static" + std::to_string(i), PhysicsTransform(Point3<float>((float)i * 2.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape, bodyStateStore);
+        bodyAabbTree.addBody(staticBody.get(), nullptr);
+        staticBodies.push_back(std::move(staticBody));
+    }
+    auto dynamicBody = std::make_unique<WorkRigidBody>("dynamic", PhysicsTransform(Point3<float>(0.0f, 5.0f, 0.0f), Quaternion<float>()), cubeShape, bodyStateStore);
+    dynamicBody->setMassProperties(1.0f, Vector3<float>(1.0f, 1.0f, 1.0f));
+    bodyAabbTree.addBody(dynamicBody.get(), nullptr);
+    bodyAabbTree.updateBodies();
+    AssertHelper::assertUnsignedInt(bodyAabbTree.getOverlappingPairs().size(), 0);
+
+    dynamicBody->setPosition(Point3<float>(14.0f, 1.0f, 0.0f));
+    bodyAabbTree.updateBodies();
+
+    AssertHelper::assertUnsignedInt(bodyAabbTree.getOverlappingPairs().size(), 1);
+    AssertHelper::assertString(bodyAabbTree.getOverlappingPairs()[0]->getBody1()->getId(), "dynamic");
+    AssertHelper::assertString(bodyAabbTree.getOverlappingPairs()[0]->getBody2()->getId(), "static7");
+}
+
 void BodyAABBTreeTest::oneBodyWithAlternativePairAndRemoveIt()
 {
     oneBodyWithAlternativePairAndRemove(true);
@@ -51,9 +94,10 @@ void BodyAABBTreeTest::oneBodyWithAlternativePairAndRemoveOther()
 
 void BodyAABBTreeTest::oneBodyWithAlternativePairAndRemove(bool removeBodyHavingAlternativePair)
 {
+    BodyStateStore bodyStateStore;
     //add bodies test:
     std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
-    auto bodyA = std::make_unique<WorkRigidBody>("bodyA", PhysicsTransform(Point3<float>(0.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
+    auto bodyA = std::make_unique<WorkRigidBody>("bodyA", PhysicsTransform(Point3<float>(0.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape, bodyStateStore);
     auto bodyB = std::make_unique<WorkGhostBody>("bodyB", PhysicsTransform(Point3<float>(1.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
     BodyAABBTree bodyAabbTree;
     bodyAabbTree.addBody(bodyA.get(), nullptr);
@@ -104,9 +148,10 @@ void BodyAABBTreeTest::twoBodiesWithAlternativePair()
 
 void BodyAABBTreeTest::threeBodiesPairedAndRemove()
 {
+    BodyStateStore bodyStateStore;
     //add bodies test:
     std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
-    auto bodyA = std::make_unique<WorkRigidBody>("bodyA", PhysicsTransform(Point3<float>(0.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
+    auto bodyA = std::make_unique<WorkRigidBody>("bodyA", PhysicsTransform(Point3<float>(0.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape, bodyStateStore);
     auto bodyB = std::make_unique<WorkGhostBody>("bodyB", PhysicsTransform(Point3<float>(1.0f, 0.0f, 0.0f), Quaternion<float>()), cubeShape);
     auto bodyC = std::make_unique<WorkGhostBody>("bodyC", PhysicsTransform(Point3<float>(0.0f, 1.0f, 0.0f), Quaternion<float>()), cubeShape);
     BodyAABBTree bodyAabbTree;
@@ -136,6 +181,8 @@ CppUnit::Test *BodyAABBTreeTest::suite()
 
     suite->addTest(new CppUnit::TestCaller<BodyAABBTreeTest>("twoBodiesPairedAndRemove", &BodyAABBTreeTest::twoBodiesPairedAndRemove));
     suite->addTest(new CppUnit::TestCaller<BodyAABBTreeTest>("twoBodiesNotPaired", &BodyAABBTreeTest::twoBodiesNotPaired));
+    suite->addTest(new CppUnit::TestCaller<BodyAABBTreeTest>("twoStaticBodiesNotPaired", &BodyAABBTreeTest::twoStaticBodiesNotPaired));
+    suite->addTest(new CppUnit::TestCaller<BodyAABBTreeTest>("dynamicBodyMovedOnStaticBody", &BodyAABBTreeTest::dynamicBodyMovedOnStaticBody));
 
     suite->addTest(new CppUnit::TestCaller<BodyAABBTreeTest>("oneBodyWithAlternativePairAndRemoveIt", &BodyAABBTreeTest::oneBodyWithAlternativePairAndRemoveIt));
     suite->addTest(new CppUnit::TestCaller<BodyAABBTreeTest>("oneBodyWithAlternativePairAndRemoveOther", &BodyAABBTreeTest::oneBodyWithAlternativePairAndRemoveOther));
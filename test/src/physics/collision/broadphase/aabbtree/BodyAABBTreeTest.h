@@ -11,6 +11,8 @@ class BodyAABBTreeTest : public CppUnit::TestFixture
 
          void twoBodiesPairedAndRemove();
          void twoBodiesNotPaired();
+         void twoStaticBodiesNotPaired();
+         void dynamicBodyMovedOnStaticBody();
 
          void oneBodyWithAlternativePairAndRemoveIt();
          void oneBodyWithAlternativePairAndRemoveOther();
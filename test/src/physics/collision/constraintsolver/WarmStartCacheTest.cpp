@@ -0,0 +1,67 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <memory>
+#include "UrchinCommon.h"
+#include "UrchinPhysicsEngine.h"
+
+#include "AssertHelper.h"
+#include "physics/collision/constraintsolver/WarmStartCacheTest.h"
+using namespace urchin;
+
+void WarmStartCacheTest::retrieveImpulsesOfSameFeature()
+{
+	BodyStateStore bodyStateStore;
+	auto boxShape = std::make_shared<const CollisionBoxShape>(Vector3<float>(1.0f, 1.0f, 1.0f));
+	WorkRigidBody workBody1("body1", PhysicsTransform(Point3<float>(0.0f, 2.0f, 0.0f)), boxShape, bodyStateStore);
+	WorkRigidBody workBody2("body2", PhysicsTransform(Point3<float>(0.0f, 0.0f, 0.0f)), boxShape, bodyStateStore);
+	ManifoldResult manifoldResult(&workBody1, &workBody2);
+	manifoldResult.addContactPoint(Vector3<float>(0.0f, 1.0f, 0.0f), Point3<float>(1.0f, 1.0f, 1.0f), -0.01f, 5, false);
+	manifoldResult.getManifoldContactPoint(0).getAccumulatedSolvingData().accNormalImpulse = -2.0f;
+	manifoldResult.getManifoldContactPoint(0).getAccumulatedSolvingData().accTangentImpulse = 0.5f;
+
+	WarmStartCache warmStartCache;
+	warmStartCache.storeAccumulatedData(manifoldResult, manifoldResult.getManifoldContactPoint(0));
+	warmStartCache.removeUnusedEntries();
+
+	ManifoldResult nextManifoldResult(&workBody1, &workBody2);
+	nextManifoldResult.addContactPoint(Vector3<float>(0.0f, 1.0f, 0.0f), Point3<float>(1.0f, 1.0f, 1.0f), -0.01f, 5, false);
+	nextManifoldResult.addContactPoint(Vector3<float>(0.0f, 1.0f, 0.0f), Point3<float>(-1.0f, 1.0f, -1.0f), -0.01f, 6, false);
+	bool sameFeatureFound = warmStartCache.retrieveAccumulatedData(nextManifoldResult, nextManifoldResult.getManifoldContactPoint(0));
+	bool otherFeatureFound = warmStartCache.retrieveAccumulatedData(nextManifoldResult, nextManifoldResult.getManifoldContactPoint(1));
+
+	AssertHelper::assertTrue(sameFeatureFound);
+	AssertHelper::assertFloatEquals(nextManifoldResult.getManifoldContactPoint(0).getAccumulatedSolvingData().accNormalImpulse, -2.0f);
+	AssertHelper::assertFloatEquals(nextManifoldResult.getManifoldContactPoint(0).getAccumulatedSolvingData().accTangentImpulse, 0.5f);
+	AssertHelper::assertTrue(!otherFeatureFound);
+	AssertHelper::assertFloatEquals(nextManifoldResult.getManifoldContactPoint(1).getAccumulatedSolvingData().accNormalImpulse, 0.0f);
+}
+
+void WarmStartCacheTest::removeEntriesOfLostContacts()
+{
+	BodyStateStore bodyStateStore;
+	auto boxShape = std::make_shared<const CollisionBoxShape>(Vector3<float>(1.0f, 1.0f, 1.0f));
+	WorkRigidBody workBody1("body1", PhysicsTransform(Point3<float>(0.0f, 2.0f, 0.0f)), boxShape, bodyStateStore);
+	WorkRigidBody workBody2("body2", PhysicsTransform(Point3<float>(0.0f, 0.0f, 0.0f)), boxShape, bodyStateStore);
+	ManifoldResult manifoldResult(&workBody1, &workBody2);
+	manifoldResult.addContactPoint(Vector3<float>(0.0f, 1.0f, 0.0f), Point3<float>(1.0f, 1.0f, 1.0f), -0.01f, 5, false);
+	manifoldResult.addContactPoint(Vector3<float>(0.0f, 1.0f, 0.0f), Point3<float>(0.0f, 1.0f, 0.0f), -0.01f, NO_FEATURE_ID, false);
+
+	WarmStartCache warmStartCache;
+	warmStartCache.storeAccumulatedData(manifoldResult, manifoldResult.getManifoldContactPoint(0));
+	warmStartCache.storeAccumulatedData(manifoldResult, manifoldResult.getManifoldContactPoint(1)); //unknown features are not cached
+	warmStartCache.removeUnusedEntries();
+	AssertHelper::assertUnsignedInt(warmStartCache.getSize(), 1);
+
+	warmStartCache.removeUnusedEntries(); //contact not stored anymore
+	AssertHelper::assertUnsignedInt(warmStartCache.getSize(), 0);
+}
+
+CppUnit::Test *WarmStartCacheTest::suite()
+{
+	auto *suite = new CppUnit::TestSuite("WarmStartCacheTest");
+
+	suite->addTest(new CppUnit::TestCaller<WarmStartCacheTest>("retrieveImpulsesOfSameFeature", &WarmStartCacheTest::retrieveImpulsesOfSameFeature));
+	suite->addTest(new CppUnit::TestCaller<WarmStartCacheTest>("removeEntriesOfLostContacts", &WarmStartCacheTest::removeEntriesOfLostContacts));
+
+	return suite;
+}
@@ -0,0 +1,16 @@
+#ifndef URCHINENGINE_WARMSTARTCACHETEST_H
+#define URCHINENGINE_WARMSTARTCACHETEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class WarmStartCacheTest : public CppUnit::TestFixture
+{
+	public:
+		static CppUnit::Test *suite();
+
+		void retrieveImpulsesOfSameFeature();
+		void removeEntriesOfLostContacts();
+};
+
+#endif
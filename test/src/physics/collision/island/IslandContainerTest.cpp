@@ -1,5 +1,6 @@
 #include <cppunit/TestSuite.h>
 #include <cppunit/TestCaller.h>
+#include <algorithm>
 
 #include "AssertHelper.h"
 #include "physics/collision/island/IslandContainerTest.h"
@@ -80,6 +81,96 @@ void IslandContainerTest::createTwoSeparateIslands()
 	delete bodies[0]; delete bodies[1]; delete bodies[2]; delete bodies[3];
 }
 
+/**
+ * Add 3 bodies one by one (persistent container) and merge body 0 with body 2.
+ * Island of body 0 should contain body 0 and body 2.
+ */
+void IslandContainerTest::addElementsAndMergeIslands()
+{
+	TestBody* bodies[] = {new TestBody(), new TestBody(), new TestBody()};
+
+	IslandContainer islandContainer;
+	for(auto body : bodies)
+	{
+		islandContainer.addElement(body);
+	}
+	islandContainer.mergeIsland(bodies[0], bodies[2]); //body 0 is in contact with body 2
+
+	std::vector<IslandElement *> islandElements;
+	islandContainer.retrieveIslandElements(islandContainer.findIslandId(bodies[0]), islandElements);
+
+	AssertHelper::assertUnsignedInt(islandElements.size(), 2);
+	AssertHelper::assertTrue(std::find(islandElements.begin(), islandElements.end(), bodies[0]) != islandElements.end());
+	AssertHelper::assertTrue(std::find(islandElements.begin(), islandElements.end(), bodies[2]) != islandElements.end());
+	AssertHelper::assertTrue(islandContainer.findIslandId(bodies[1]) != islandContainer.findIslandId(bodies[0]));
+
+	delete bodies[0]; delete bodies[1]; delete bodies[2];
+}
+
+/**
+ * Create an island of 4 bodies, split it and merge again body 1 with body 2 only.
+ * We should have three distinct islands.
+ */
+void IslandContainerTest::splitIslandAndMergeAgain()
+{
+	TestBody* bodies[] = {new TestBody(), new TestBody(), new TestBody(), new TestBody()};
+
+	IslandContainer islandContainer;
+	for(auto body : bodies)
+	{
+		islandContainer.addElement(body);
+	}
+	islandContainer.mergeIsland(bodies[0], bodies[1]);
+	islandContainer.mergeIsland(bodies[1], bodies[2]);
+	islandContainer.mergeIsland(bodies[2], bodies[3]);
+	islandContainer.linkToStaticElement(bodies[3]);
+
+	islandContainer.splitIsland(islandContainer.findIslandId(bodies[0]));
+	islandContainer.mergeIsland(bodies[1], bodies[2]); //only contact still existing
+
+	AssertHelper::assertUnsignedInt(islandContainer.findIslandId(bodies[1]), islandContainer.findIslandId(bodies[2]));
+	AssertHelper::assertTrue(islandContainer.findIslandId(bodies[0]) != islandContainer.findIslandId(bodies[1]));
+	AssertHelper::assertTrue(islandContainer.findIslandId(bodies[3]) != islandContainer.findIslandId(bodies[1]));
+	AssertHelper::assertTrue(islandContainer.findIslandId(bodies[0]) != islandContainer.findIslandId(bodies[3]));
+	AssertHelper::assertTrue(!islandContainer.isLinkedToStaticElement(islandContainer.findIslandId(bodies[3])));
+
+	std::vector<IslandElement *> islandElements;
+	islandContainer.retrieveIslandElements(islandContainer.findIslandId(bodies[2]), islandElements);
+	AssertHelper::assertUnsignedInt(islandElements.size(), 2);
+
+	delete bodies[0]; delete bodies[1]; delete bodies[2]; delete bodies[3];
+}
+
+/**
+ * Remove body 1 from an island of 3 bodies and add a new body.
+ * Others bodies should be in their own island and new body should reuse the ID of the removed body.
+ */
+void IslandContainerTest::removeElementAndReuseId()
+{
+	TestBody* bodies[] = {new TestBody(), new TestBody(), new TestBody()};
+
+	IslandContainer islandContainer;
+	for(auto body : bodies)
+	{
+		islandContainer.addElement(body);
+	}
+	islandContainer.mergeIsland(bodies[0], bodies[1]);
+	islandContainer.mergeIsland(bodies[1], bodies[2]);
+	unsigned int removedElementId = bodies[1]->getIslandElementId();
+
+	islandContainer.removeElement(bodies[1]);
+	AssertHelper::assertTrue(!islandContainer.hasElement(bodies[1]));
+	AssertHelper::assertTrue(islandContainer.findIslandId(bodies[0]) != islandContainer.findIslandId(bodies[2]));
+
+	auto *newBody = new TestBody();
+	islandContainer.addElement(newBody);
+	AssertHelper::assertUnsignedInt(newBody->getIslandElementId(), removedElementId);
+	AssertHelper::assertUnsignedInt(islandContainer.getSize(), 3);
+	AssertHelper::assertTrue(islandContainer.hasElement(newBody));
+
+	delete bodies[0]; delete bodies[1]; delete bodies[2]; delete newBody;
+}
+
 CppUnit::Test *IslandContainerTest::suite()
 {
     auto *suite = new CppUnit::TestSuite("IslandContainerTest");
@@ -88,5 +179,9 @@ CppUnit::Test *IslandContainerTest::suite()
 	suite->addTest(new CppUnit::TestCaller<IslandContainerTest>("mergeAllIslands", &IslandContainerTest::mergeAllIslands));
 	suite->addTest(new CppUnit::TestCaller<IslandContainerTest>("createTwoSeparateIslands", &IslandContainerTest::createTwoSeparateIslands));
 
+	suite->addTest(new CppUnit::TestCaller<IslandContainerTest>("addElementsAndMergeIslands", &IslandContainerTest::addElementsAndMergeIslands));
+	suite->addTest(new CppUnit::TestCaller<IslandContainerTest>("splitIslandAndMergeAgain", &IslandContainerTest::splitIslandAndMergeAgain));
+	suite->addTest(new CppUnit::TestCaller<IslandContainerTest>("removeElementAndReuseId", &IslandContainerTest::removeElementAndReuseId));
+
 	return suite;
 }
@@ -15,6 +15,10 @@ class IslandContainerTest : public CppUnit::TestFixture
 		void cascadeMergeIslands();
 		void mergeAllIslands();
 		void createTwoSeparateIslands();
+
+		void addElementsAndMergeIslands();
+		void splitIslandAndMergeAgain();
+		void removeElementAndReuseId();
 };
 
 class TestBody : public urchin::IslandElement
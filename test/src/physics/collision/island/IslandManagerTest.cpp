@@ -0,0 +1,101 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include "collision/island/IslandManager.h"
+
+#include "AssertHelper.h"
+#include "physics/collision/island/IslandManagerTest.h"
+using namespace urchin;
+
+/**
+ * Create 3 bodies in contact: body 0 with body 1 and body 1 with body 2. Contact between body 1 and body 2 is lost in the
+ * next step: body 2 must be in its own island.
+ */
+void IslandManagerTest::contactLossSplitIsland()
+{
+	BodyManager bodyManager;
+	IslandManager islandManager(&bodyManager);
+	std::vector<RigidBody *> bodies = addActiveBodies(bodyManager, 3);
+
+	islandManager.refreshIslands({buildContact(bodies[0], bodies[1]), buildContact(bodies[1], bodies[2])});
+	AssertHelper::assertUnsignedInt(islandManager.getIslandId(bodies[2]->getWorkBody()), islandManager.getIslandId(bodies[0]->getWorkBody()));
+	islandManager.refreshIslands({buildContact(bodies[0], bodies[1])});
+
+	AssertHelper::assertUnsignedInt(islandManager.getIslandId(bodies[1]->getWorkBody()), islandManager.getIslandId(bodies[0]->getWorkBody()));
+	AssertHelper::assertTrue(islandManager.getIslandId(bodies[2]->getWorkBody()) != islandManager.getIslandId(bodies[0]->getWorkBody()));
+}
+
+/**
+ * Create 4 bodies in contact: body n with body n+1. Body 1 is removed: body 0 must be in its own island while body 2 and
+ * body 3 stay in the same island.
+ */
+void IslandManagerTest::bodyRemovalSplitIsland()
+{
+	BodyManager bodyManager;
+	IslandManager islandManager(&bodyManager);
+	std::vector<RigidBody *> bodies = addActiveBodies(bodyManager, 4);
+	islandManager.refreshIslands({buildContact(bodies[0], bodies[1]), buildContact(bodies[1], bodies[2]), buildContact(bodies[2], bodies[3])});
+
+	bodyManager.removeBody(bodies[1]);
+	bodyManager.setupWorkBodies();
+	islandManager.refreshIslands({buildContact(bodies[2], bodies[3])});
+
+	AssertHelper::assertUnsignedInt(islandManager.getIslandId(bodies[2]->getWorkBody()), islandManager.getIslandId(bodies[3]->getWorkBody()));
+	AssertHelper::assertTrue(islandManager.getIslandId(bodies[0]->getWorkBody()) != islandManager.getIslandId(bodies[2]->getWorkBody()));
+}
+
+/**
+ * Create 2 bodies in contact and a ghost body in contact with body 0: ghost body must be ignored by the islands.
+ */
+void IslandManagerTest::ghostBodyContactIgnored()
+{
+	BodyManager bodyManager;
+	IslandManager islandManager(&bodyManager);
+	std::vector<RigidBody *> bodies = addActiveBodies(bodyManager, 2);
+	auto boxShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+	WorkGhostBody ghostBody("ghost", PhysicsTransform(Point3<float>(-1.0f, 0.0f, 0.0f)), boxShape);
+	ManifoldResult ghostContact(bodies[0]->getWorkBody(), &ghostBody);
+	ghostContact.addContactPoint(Vector3<float>(1.0f, 0.0f, 0.0f), Point3<float>(0.0f, 0.0f, 0.0f), -0.01f, NO_FEATURE_ID, false);
+
+	islandManager.refreshIslands({buildContact(bodies[0], bodies[1]), ghostContact});
+	islandManager.refreshBodyActiveState();
+
+	AssertHelper::assertUnsignedInt(islandManager.getIslandId(bodies[1]->getWorkBody()), islandManager.getIslandId(bodies[0]->getWorkBody()));
+}
+
+std::vector<RigidBody *> IslandManagerTest::addActiveBodies(BodyManager &bodyManager, unsigned int numberBodies) const
+{
+	std::shared_ptr<CollisionBoxShape> boxShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+	std::vector<RigidBody *> bodies;
+	for(unsigned int i = 0; i < numberBodies; ++i)
+	{
+		auto *body = new RigidBody("body" + std::to_string(i), Transform<float>(Point3<float>((float)i, 0.0f, 0.0f), Quaternion<float>(), 1.0f), boxShape);
+		body->setMass(1.0f);
+		bodyManager.addBody(body);
+		bodies.push_back(body);
+	}
+	bodyManager.setupWorkBodies();
+
+	for(auto body : bodies)
+	{
+		body->getWorkBody()->setIsActive(true);
+	}
+	return bodies;
+}
+
+ManifoldResult IslandManagerTest::buildContact(RigidBody *body1, RigidBody *body2) const
+{
+	ManifoldResult manifoldResult(body1->getWorkBody(), body2->getWorkBody());
+	manifoldResult.addContactPoint(Vector3<float>(1.0f, 0.0f, 0.0f), Point3<float>(0.0f, 0.0f, 0.0f), -0.01f, NO_FEATURE_ID, false);
+	return manifoldResult;
+}
+
+CppUnit::Test *IslandManagerTest::suite()
+{
+	auto *suite = new CppUnit::TestSuite("IslandManagerTest");
+
+	suite->addTest(new CppUnit::TestCaller<IslandManagerTest>("contactLossSplitIsland", &IslandManagerTest::contactLossSplitIsland));
+	suite->addTest(new CppUnit::TestCaller<IslandManagerTest>("bodyRemovalSplitIsland", &IslandManagerTest::bodyRemovalSplitIsland));
+	suite->addTest(new CppUnit::TestCaller<IslandManagerTest>("ghostBodyContactIgnored", &IslandManagerTest::ghostBodyContactIgnored));
+
+	return suite;
+}
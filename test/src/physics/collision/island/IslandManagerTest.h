@@ -0,0 +1,24 @@
+#ifndef URCHINENGINE_ISLANDMANAGERTEST_H
+#define URCHINENGINE_ISLANDMANAGERTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+#include <vector>
+
+#include "UrchinPhysicsEngine.h"
+
+class IslandManagerTest : public CppUnit::TestFixture
+{
+	public:
+		static CppUnit::Test *suite();
+
+		void contactLossSplitIsland();
+		void bodyRemovalSplitIsland();
+		void ghostBodyContactIgnored();
+
+	private:
+		std::vector<urchin::RigidBody *> addActiveBodies(urchin::BodyManager &, unsigned int) const;
+		urchin::ManifoldResult buildContact(urchin::RigidBody *, urchin::RigidBody *) const;
+};
+
+#endif
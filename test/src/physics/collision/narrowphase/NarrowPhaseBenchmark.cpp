@@ -0,0 +1,174 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <thread>
+
+#include "physics/collision/narrowphase/NarrowPhaseBenchmark.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+/**
+ * Process narrow phase on a grid of overlapping boxes with an increasing number of threads (from 1 to the number of hardware threads).
+ */
+void NarrowPhaseBenchmark::overlappingPairsThreadsScaling()
+{
+    constexpr unsigned int NUM_STEPS = 20;
+    BodyManager *bodyManager = buildBoxesGrid(8, 5, 8);
+    auto *broadPhaseManager = new BroadPhaseManager(bodyManager);
+    auto *narrowPhaseManager = new NarrowPhaseManager(bodyManager, broadPhaseManager);
+
+    bodyManager->setupWorkBodies();
+    const std::vector<OverlappingPair *> &overlappingPairs = broadPhaseManager->computeOverlappingPairs();
+    std::vector<ManifoldResult> manifoldResults;
+
+    unsigned int maxThreads = std::max(2u, std::thread::hardware_concurrency());
+    double singleThreadDurationMs = 0.0;
+    std::size_t singleThreadNumManifolds = 0;
+    for(unsigned int numThreads = 1; numThreads <= maxThreads; ++numThreads)
+    {
+        narrowPhaseManager->setNumThreads(numThreads);
+        manifoldResults.clear();
+        narrowPhaseManager->process(1.0f / 60.0f, overlappingPairs, manifoldResults); //warm up: create collision algorithms
+
+        auto startTime = std::chrono::high_resolution_clock::now();
+        for(unsigned int step = 0; step < NUM_STEPS; ++step)
+        {
+            manifoldResults.clear();
+            narrowPhaseManager->process(1.0f / 60.0f, overlappingPairs, manifoldResults);
+        }
+        auto endTime = std::chrono::high_resolution_clock::now();
+        double durationMs = std::chrono::duration<double, std::milli>(endTime - startTime).count() / NUM_STEPS;
+
+        if(numThreads == 1)
+        {
+            singleThreadDurationMs = durationMs;
+            singleThreadNumManifolds = manifoldResults.size();
+        }
+        AssertHelper::assertUnsignedInt(manifoldResults.size(), singleThreadNumManifolds);
+
+        std::cout << std::fixed << std::setprecision(3) << "NarrowPhaseBenchmark - pairs: " << overlappingPairs.size() << ", threads: " << numThreads
+                  << ", step: " << durationMs << "ms, speedup: " << singleThreadDurationMs / durationMs << std::endl;
+    }
+
+    delete broadPhaseManager;
+    delete narrowPhaseManager;
+    delete bodyManager;
+}
+
+/**
+ * Process narrow phase on two compound shapes of 200 boxes laying on each other (prefab-like): only the children pairs
+ * culled by the children hierarchy are tested and they are processed in parallel by the narrow phase threads.
+ */
+void NarrowPhaseBenchmark::compoundChildPairsThreadsScaling()
+{
+    constexpr unsigned int NUM_STEPS = 20;
+    auto *bodyManager = new BodyManager();
+    std::shared_ptr<CollisionCompoundShape> plateShape = buildBoxesPlate(10, 10);
+    auto *bottomPlateBody = new RigidBody("bottomPlate", Transform<float>(Point3<float>(0.0f, 0.0f, 0.0f), Quaternion<float>(), 1.0f), plateShape);
+    bottomPlateBody->setMass(1.0f);
+    bodyManager->addBody(bottomPlateBody);
+    auto *topPlateBody = new RigidBody("topPlate", Transform<float>(Point3<float>(0.25f, 0.98f, 0.25f), Quaternion<float>(), 1.0f), plateShape);
+    topPlateBody->setMass(1.0f);
+    bodyManager->addBody(topPlateBody);
+
+    auto *broadPhaseManager = new BroadPhaseManager(bodyManager);
+    auto *narrowPhaseManager = new NarrowPhaseManager(bodyManager, broadPhaseManager);
+
+    bodyManager->setupWorkBodies();
+    const std::vector<OverlappingPair *> &overlappingPairs = broadPhaseManager->computeOverlappingPairs();
+    std::vector<ManifoldResult> manifoldResults;
+
+    unsigned int maxThreads = std::max(2u, std::thread::hardware_concurrency());
+    double singleThreadDurationMs = 0.0;
+    unsigned int singleThreadNumContactPoints = 0;
+    for(unsigned int numThreads = 1; numThreads <= maxThreads; ++numThreads)
+    {
+        narrowPhaseManager->setNumThreads(numThreads);
+        manifoldResults.clear();
+        narrowPhaseManager->process(1.0f / 60.0f, overlappingPairs, manifoldResults); //warm up: create collision algorithms
+
+        auto startTime = std::chrono::high_resolution_clock::now();
+        for(unsigned int step = 0; step < NUM_STEPS; ++step)
+        {
+            manifoldResults.clear();
+            narrowPhaseManager->process(1.0f / 60.0f, overlappingPairs, manifoldResults);
+        }
+        auto endTime = std::chrono::high_resolution_clock::now();
+        double durationMs = std::chrono::duration<double, std::milli>(endTime - startTime).count() / NUM_STEPS;
+
+        AssertHelper::assertUnsignedInt(manifoldResults.size(), 1);
+        unsigned int numContactPoints = manifoldResults[0].getNumContactPoints();
+        if(numThreads == 1)
+        {
+            singleThreadDurationMs = durationMs;
+            singleThreadNumContactPoints = numContactPoints;
+        }
+        AssertHelper::assertTrue(numContactPoints > 0, "Plates must be in contact");
+        AssertHelper::assertUnsignedInt(numContactPoints, singleThreadNumContactPoints);
+
+        std::cout << std::fixed << std::setprecision(3) << "NarrowPhaseBenchmark - compound children: " << plateShape->getLocalizedShapes().size()
+                  << ", threads: " << numThreads << ", step: " << durationMs << "ms, speedup: " << singleThreadDurationMs / durationMs << std::endl;
+    }
+
+    delete broadPhaseManager;
+    delete narrowPhaseManager;
+    delete bodyManager;
+}
+
+BodyManager *NarrowPhaseBenchmark::buildBoxesGrid(unsigned int sizeX, unsigned int sizeY, unsigned int sizeZ) const
+{
+    auto *bodyManager = new BodyManager();
+    std::shared_ptr<CollisionBoxShape> boxShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+
+    for(unsigned int x = 0; x < sizeX; ++x)
+    {
+        for(unsigned int y = 0; y < sizeY; ++y)
+        {
+            for(unsigned int z = 0; z < sizeZ; ++z)
+            { //boxes slightly penetrate their neighbors
+                Point3<float> position((float)x * 0.98f, (float)y * 0.98f, (float)z * 0.98f);
+                std::string bodyId = "box_" + std::to_string(x) + "_" + std::to_string(y) + "_" + std::to_string(z);
+                auto *boxBody = new RigidBody(bodyId, Transform<float>(position, Quaternion<float>(), 1.0f), boxShape);
+                boxBody->setMass(1.0f);
+                bodyManager->addBody(boxBody);
+            }
+        }
+    }
+
+    return bodyManager;
+}
+
+std::shared_ptr<CollisionCompoundShape> NarrowPhaseBenchmark::buildBoxesPlate(unsigned int sizeX, unsigned int sizeZ) const
+{
+    std::shared_ptr<CollisionBoxShape> boxShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.25f, 0.25f, 0.25f));
+    std::vector<std::shared_ptr<const LocalizedCollisionShape>> localizedShapes;
+
+    for(unsigned int y = 0; y < 2; ++y)
+    {
+        for(unsigned int x = 0; x < sizeX; ++x)
+        {
+            for(unsigned int z = 0; z < sizeZ; ++z)
+            {
+                auto localizedShape = std::make_shared<LocalizedCollisionShape>();
+                localizedShape->position = localizedShapes.size();
+                localizedShape->shape = boxShape;
+                localizedShape->transform = PhysicsTransform(Point3<float>((float)x * 0.5f, (float)y * 0.5f, (float)z * 0.5f));
+                localizedShapes.push_back(localizedShape);
+            }
+        }
+    }
+
+    return std::make_shared<CollisionCompoundShape>(localizedShapes);
+}
+
+CppUnit::Test *NarrowPhaseBenchmark::suite()
+{
+    auto *suite = new CppUnit::TestSuite("NarrowPhaseBenchmark");
+
+    suite->addTest(new CppUnit::TestCaller<NarrowPhaseBenchmark>("overlappingPairsThreadsScaling", &NarrowPhaseBenchmark::overlappingPairsThreadsScaling));
+    suite->addTest(new CppUnit::TestCaller<NarrowPhaseBenchmark>("compoundChildPairsThreadsScaling", &NarrowPhaseBenchmark::compoundChildPairsThreadsScaling));
+
+    return suite;
+}
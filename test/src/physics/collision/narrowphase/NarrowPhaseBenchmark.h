@@ -0,0 +1,22 @@
+#ifndef URCHINENGINE_NARROWPHASEBENCHMARK_H
+#define URCHINENGINE_NARROWPHASEBENCHMARK_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+#include "UrchinPhysicsEngine.h"
+
+class NarrowPhaseBenchmark : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void overlappingPairsThreadsScaling();
+        void compoundChildPairsThreadsScaling();
+
+    private:
+        urchin::BodyManager *buildBoxesGrid(unsigned int, unsigned int, unsigned int) const;
+        std::shared_ptr<urchin::CollisionCompoundShape> buildBoxesPlate(unsigned int, unsigned int) const;
+};
+
+#endif
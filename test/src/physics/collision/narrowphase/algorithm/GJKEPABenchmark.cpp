@@ -0,0 +1,107 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <cmath>
+
+#include "physics/collision/narrowphase/algorithm/GJKEPABenchmark.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void GJKEPABenchmark::boxPairs()
+{
+    Quaternion<float> orientation(Vector3<float>(0.2f, 1.0f, 0.3f).normalize(), 0.6f);
+    CollisionBoxObject box(0.04f, Vector3<float>(0.5f, 0.5f, 0.5f), Point3<float>(0.0f, 0.0f, 0.0f), Quaternion<float>());
+    CollisionBoxObject separatedBox(0.04f, Vector3<float>(0.5f, 0.5f, 0.5f), Point3<float>(1.5f, 0.3f, 0.2f), orientation);
+    CollisionBoxObject overlappingBox(0.04f, Vector3<float>(0.5f, 0.5f, 0.5f), Point3<float>(0.9f, 0.3f, 0.2f), orientation);
+
+    benchmarkPair("box/box", box, separatedBox, overlappingBox);
+}
+
+void GJKEPABenchmark::convexHullPairs()
+{
+    constexpr unsigned int NUM_POINTS = 64;
+    CollisionConvexHullObject convexHull(0.0f, buildSpherePoints(NUM_POINTS, 0.5f, Point3<float>(0.0f, 0.0f, 0.0f)),
+            buildSpherePoints(NUM_POINTS, 0.5f, Point3<float>(0.0f, 0.0f, 0.0f)));
+    CollisionConvexHullObject separatedConvexHull(0.0f, buildSpherePoints(NUM_POINTS, 0.5f, Point3<float>(1.2f, 0.3f, 0.2f)),
+            buildSpherePoints(NUM_POINTS, 0.5f, Point3<float>(1.2f, 0.3f, 0.2f)));
+    CollisionConvexHullObject overlappingConvexHull(0.0f, buildSpherePoints(NUM_POINTS, 0.5f, Point3<float>(0.8f, 0.3f, 0.2f)),
+            buildSpherePoints(NUM_POINTS, 0.5f, Point3<float>(0.8f, 0.3f, 0.2f)));
+
+    benchmarkPair("hull/hull", convexHull, separatedConvexHull, overlappingConvexHull);
+}
+
+void GJKEPABenchmark::spherePairs()
+{
+    CollisionSphereObject sphere(0.5f, Point3<float>(0.0f, 0.0f, 0.0f));
+    CollisionSphereObject separatedSphere(0.5f, Point3<float>(1.2f, 0.3f, 0.2f));
+    CollisionSphereObject overlappingSphere(0.5f, Point3<float>(0.8f, 0.3f, 0.2f));
+
+    benchmarkPair("sphere/sphere", sphere, separatedSphere, overlappingSphere);
+}
+
+/**
+ * Measure GJK on a separated pair and GJK followed by EPA on an overlapping pair.
+ */
+void GJKEPABenchmark::benchmarkPair(const std::string &pairName, const CollisionConvexObject3D &object,
+        const CollisionConvexObject3D &separatedObject, const CollisionConvexObject3D &overlappingObject) const
+{
+    constexpr unsigned int NUM_ITERATIONS = 20000;
+    GJKAlgorithm<float> gjk;
+    EPAAlgorithm<float> epa;
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    unsigned int numSeparated = 0;
+    for(unsigned int i = 0; i < NUM_ITERATIONS; ++i)
+    {
+        numSeparated += gjk.processGJK(object, separatedObject, true)->isCollide() ? 0 : 1;
+    }
+    auto gjkEndTime = std::chrono::high_resolution_clock::now();
+    unsigned int numPenetrations = 0;
+    for(unsigned int i = 0; i < NUM_ITERATIONS; ++i)
+    {
+        auto gjkResult = gjk.processGJK(object, overlappingObject, true);
+        numPenetrations += epa.processEPA(object, overlappingObject, *gjkResult)->isCollide() ? 1 : 0;
+    }
+    auto epaEndTime = std::chrono::high_resolution_clock::now();
+
+    AssertHelper::assertUnsignedInt(numSeparated, NUM_ITERATIONS);
+    AssertHelper::assertUnsignedInt(numPenetrations, NUM_ITERATIONS);
+
+    double gjkDurationUs = std::chrono::duration<double, std::micro>(gjkEndTime - startTime).count() / NUM_ITERATIONS;
+    double gjkEpaDurationUs = std::chrono::duration<double, std::micro>(epaEndTime - gjkEndTime).count() / NUM_ITERATIONS;
+    std::cout << std::fixed << std::setprecision(3) << "GJKEPABenchmark - " << pairName << ", GJK: " << gjkDurationUs
+              << "us, GJK+EPA: " << gjkEpaDurationUs << "us" << std::endl;
+}
+
+/**
+ * @return Points uniformly distributed on a sphere (Fibonacci sphere)
+ */
+std::vector<Point3<float>> GJKEPABenchmark::buildSpherePoints(unsigned int numPoints, float radius, const Point3<float> &center) const
+{
+    std::vector<Point3<float>> points;
+    points.reserve(numPoints);
+
+    const float goldenAngle = PI_VALUE * (3.0f - std::sqrt(5.0f));
+    for(unsigned int i = 0; i < numPoints; ++i)
+    {
+        float y = 1.0f - (2.0f * ((float)i + 0.5f) / (float)numPoints);
+        float ringRadius = std::sqrt(1.0f - y * y);
+        float angle = goldenAngle * (float)i;
+        points.emplace_back(Point3<float>(center.X + radius * ringRadius * std::cos(angle), center.Y + radius * y, center.Z + radius * ringRadius * std::sin(angle)));
+    }
+
+    return points;
+}
+
+CppUnit::Test *GJKEPABenchmark::suite()
+{
+    auto *suite = new CppUnit::TestSuite("GJKEPABenchmark");
+
+    suite->addTest(new CppUnit::TestCaller<GJKEPABenchmark>("boxPairs", &GJKEPABenchmark::boxPairs));
+    suite->addTest(new CppUnit::TestCaller<GJKEPABenchmark>("convexHullPairs", &GJKEPABenchmark::convexHullPairs));
+    suite->addTest(new CppUnit::TestCaller<GJKEPABenchmark>("spherePairs", &GJKEPABenchmark::spherePairs));
+
+    return suite;
+}
@@ -0,0 +1,24 @@
+#ifndef URCHINENGINE_GJKEPABENCHMARK_H
+#define URCHINENGINE_GJKEPABENCHMARK_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+#include "UrchinPhysicsEngine.h"
+
+class GJKEPABenchmark : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void boxPairs();
+        void convexHullPairs();
+        void spherePairs();
+
+    private:
+        void benchmarkPair(const std::string &, const urchin::CollisionConvexObject3D &, const urchin::CollisionConvexObject3D &,
+                const urchin::CollisionConvexObject3D &) const;
+        std::vector<urchin::Point3<float>> buildSpherePoints(unsigned int, float, const urchin::Point3<float> &) const;
+};
+
+#endif
@@ -34,6 +34,40 @@ void FallingObjectIT::fallOnPlane()
     delete bodyManager;
 }
 
+void FallingObjectIT::fallOnHeightfield()
+{
+    std::vector<Point3<float>> heightfieldPoints;
+    for(unsigned int z=0; z<21; ++z)
+    {
+        for(unsigned int x=0; x<21; ++x)
+        {
+            heightfieldPoints.emplace_back(Point3<float>((float)x - 10.0f, 0.0f, (float)z - 10.0f));
+        }
+    }
+    std::shared_ptr<CollisionHeightfieldShape> heightfieldShape = std::make_shared<CollisionHeightfieldShape>(heightfieldPoints, 21, 21);
+    auto *heightfieldBody = new RigidBody("heightfield", Transform<float>(Point3<float>(0.0f, 0.0f, 0.0f), Quaternion<float>(), 1.0f), heightfieldShape);
+
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    auto *cubeBody = new RigidBody("cube", Transform<float>(Point3<float>(0.3f, 5.0f, 0.3f), Quaternion<float>(), 1.0f), cubeShape);
+    cubeBody->setMass(10.0f);
+
+    auto *bodyManager = new BodyManager();
+    bodyManager->addBody(heightfieldBody);
+    bodyManager->addBody(cubeBody);
+    auto *collisionWorld = new CollisionWorld(bodyManager);
+
+    for(std::size_t i=0; i<150; ++i)
+    {
+        collisionWorld->process(1.0f / 60.0f, Vector3<float>(0.0f, -9.81f, 0.0f));
+    }
+
+    AssertHelper::assertFloatEquals(cubeBody->getTransform().getPosition().Y, 0.5f, 0.1f);
+    AssertHelper::assertTrue(!cubeBody->isActive(), "Body must become inactive when it doesn't move");
+
+    delete collisionWorld;
+    delete bodyManager;
+}
+
 void FallingObjectIT::fallForever()
 {
     if(!Logger::logger().retrieveContent(std::numeric_limits<unsigned long>::max()).empty())
@@ -68,12 +102,86 @@ void FallingObjectIT::fallForever()
     delete bodyManager;
 }
 
+/**
+ * Stack of boxes must stay stable: contact impulses of previous steps are applied through the warm start cache.
+ */
+void FallingObjectIT::stackOfBoxes()
+{
+    std::shared_ptr<CollisionBoxShape> planeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(1000.0f, 0.5f, 1000.0f));
+    auto *planeBody = new RigidBody("plane", Transform<float>(Point3<float>(0.0f, -0.5f, 0.0f), Quaternion<float>(), 1.0f), planeShape);
+
+    auto *bodyManager = new BodyManager();
+    bodyManager->addBody(planeBody);
+
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    std::vector<RigidBody *> cubeBodies;
+    for(unsigned int i=0; i<10; ++i)
+    {
+        auto *cubeBody = new RigidBody("cube" + std::to_string(i), Transform<float>(Point3<float>(0.0f, 0.5f + (float)i, 0.0f), Quaternion<float>(), 1.0f), cubeShape);
+        cubeBody->setMass(1.0f);
+        bodyManager->addBody(cubeBody);
+        cubeBodies.push_back(cubeBody);
+    }
+    auto *collisionWorld = new CollisionWorld(bodyManager);
+
+    for(std::size_t i=0; i<300; ++i)
+    {
+        collisionWorld->process(1.0f / 60.0f, Vector3<float>(0.0f, -9.81f, 0.0f));
+    }
+
+    for(unsigned int i=0; i<cubeBodies.size(); ++i)
+    {
+        const Point3<float> &position = cubeBodies[i]->getTransform().getPosition();
+        AssertHelper::assertFloatEquals(position.X, 0.0f, 0.1f);
+        AssertHelper::assertFloatEquals(position.Y, 0.5f + (float)i, 0.15f);
+        AssertHelper::assertFloatEquals(position.Z, 0.0f, 0.1f);
+        AssertHelper::assertTrue(!cubeBodies[i]->isActive(), "Body must become inactive when the stack is stable");
+    }
+
+    delete collisionWorld;
+    delete bodyManager;
+}
+
+/**
+ * Fast cube must not go through a thin plane: speculative contacts are added by the narrow phase.
+ */
+void FallingObjectIT::fastFallWithSpeculativeContacts()
+{
+    std::shared_ptr<CollisionBoxShape> planeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(1000.0f, 0.2f, 1000.0f));
+    auto *planeBody = new RigidBody("plane", Transform<float>(Point3<float>(0.0f, -0.2f, 0.0f), Quaternion<float>(), 1.0f), planeShape);
+
+    std::shared_ptr<CollisionBoxShape> cubeShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.1f, 0.1f, 0.1f));
+    auto *cubeBody = new RigidBody("cube", Transform<float>(Point3<float>(0.0f, 5.0f, 0.0f), Quaternion<float>(), 1.0f), cubeShape);
+    cubeBody->setMass(1.0f);
+    cubeBody->setCcdMode(AbstractWorkBody::SPECULATIVE_CCD);
+    cubeBody->applyCentralMomentum(Vector3<float>(0.0f, -200.0f, 0.0f)); //move of 3.3 units in one step
+
+    auto *bodyManager = new BodyManager();
+    bodyManager->addBody(planeBody);
+    bodyManager->addBody(cubeBody);
+    auto *collisionWorld = new CollisionWorld(bodyManager);
+
+    for(std::size_t i=0; i<150; ++i)
+    {
+        collisionWorld->process(1.0f / 60.0f, Vector3<float>(0.0f, -9.81f, 0.0f));
+    }
+
+    AssertHelper::assertFloatEquals(cubeBody->getTransform().getPosition().Y, 0.1f, 0.05f);
+    AssertHelper::assertTrue(!cubeBody->isActive(), "Body must become inactive when it doesn't move");
+
+    delete collisionWorld;
+    delete bodyManager;
+}
+
 CppUnit::Test *FallingObjectIT::suite()
 {
     auto *suite = new CppUnit::TestSuite("FallingObjectIT");
 
     suite->addTest(new CppUnit::TestCaller<FallingObjectIT>("fallOnPlane", &FallingObjectIT::fallOnPlane));
+    suite->addTest(new CppUnit::TestCaller<FallingObjectIT>("fallOnHeightfield", &FallingObjectIT::fallOnHeightfield));
     suite->addTest(new CppUnit::TestCaller<FallingObjectIT>("fallForever", &FallingObjectIT::fallForever));
+    suite->addTest(new CppUnit::TestCaller<FallingObjectIT>("stackOfBoxes", &FallingObjectIT::stackOfBoxes));
+    suite->addTest(new CppUnit::TestCaller<FallingObjectIT>("fastFallWithSpeculativeContacts", &FallingObjectIT::fastFallWithSpeculativeContacts));
 
     return suite;
 }
@@ -10,7 +10,10 @@ class FallingObjectIT : public CppUnit::TestFixture
         static CppUnit::Test *suite();
 
         void fallOnPlane();
+        void fallOnHeightfield();
         void fallForever();
+        void stackOfBoxes();
+        void fastFallWithSpeculativeContacts();
 };
 
 #endif
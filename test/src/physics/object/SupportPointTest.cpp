@@ -90,6 +90,23 @@ void SupportPointTest::convexHullSupportPoint()
 	AssertHelper::assertPoint3FloatEquals(convexHullObject.getSupportPoint(Vector3<float>(1.0, 0.0, 0.1), true), Point3<float>(0.24, 0.0, 0.04));
 }
 
+void SupportPointTest::manyPointsConvexHullSupportPoint()
+{ //number of points not multiple of SIMD registers size to check the remaining points
+	std::vector<Point3<float>> spherePoints;
+	for(unsigned int i=0; i<101; ++i)
+	{
+		float y = 1.0f - (2.0f * ((float)i + 0.5f) / 101.0f);
+		float angle = 2.39996323f * (float)i;
+		spherePoints.emplace_back(Point3<float>(std::sqrt(1.0f - y*y) * std::cos(angle), y, std::sqrt(1.0f - y*y) * std::sin(angle)));
+	}
+	CollisionConvexHullObject convexHullObject(0.0f, spherePoints, spherePoints);
+
+	for(unsigned int i=0; i<101; ++i)
+	{ //direction toward each point: the point itself is the support point
+		AssertHelper::assertPoint3FloatEquals(convexHullObject.getSupportPoint(spherePoints[i].toVector(), false), spherePoints[i]);
+	}
+}
+
 CppUnit::Test *SupportPointTest::suite()
 {
     auto *suite = new CppUnit::TestSuite("SupportPointTest");
@@ -100,6 +117,7 @@ CppUnit::Test *SupportPointTest::suite()
 	suite->addTest(new CppUnit::TestCaller<SupportPointTest>("cylinderSupportPoint", &SupportPointTest::cylinderSupportPoint));
 	suite->addTest(new CppUnit::TestCaller<SupportPointTest>("coneSupportPoint", &SupportPointTest::coneSupportPoint));
 	suite->addTest(new CppUnit::TestCaller<SupportPointTest>("convexHullSupportPoint", &SupportPointTest::convexHullSupportPoint));
+	suite->addTest(new CppUnit::TestCaller<SupportPointTest>("manyPointsConvexHullSupportPoint", &SupportPointTest::manyPointsConvexHullSupportPoint));
 
 	return suite;
 }
@@ -15,6 +15,7 @@ class SupportPointTest : public CppUnit::TestFixture
 		void cylinderSupportPoint();
 		void coneSupportPoint();
 		void convexHullSupportPoint();
+		void manyPointsConvexHullSupportPoint();
 };
 
 #endif
@@ -0,0 +1,88 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <random>
+
+#include "physics/processable/raytest/RayBatchTesterBenchmark.h"
+#include "processable/raytest/RayTester.h"
+#include "processable/raytest/RayBatchTester.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+/**
+ * Test 10k rays on a scene of 10k boxes: one ray tester by ray versus one ray batch tester for all the rays.
+ */
+void RayBatchTesterBenchmark::raysOnDenseScene()
+{
+    constexpr unsigned int GRID_SIZE = 100;
+    constexpr unsigned int NUM_RAYS = 10000;
+    auto *physicsWorld = new PhysicsWorld();
+    std::shared_ptr<CollisionBoxShape> boxShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    for(unsigned int x = 0; x < GRID_SIZE; ++x)
+    {
+        for(unsigned int z = 0; z < GRID_SIZE; ++z)
+        {
+            std::string bodyId = "box_" + std::to_string(x) + "_" + std::to_string(z);
+            Point3<float> position((float)x * 1.5f, (float)((x + z) % 4) * 0.5f, (float)z * 1.5f);
+            physicsWorld->addBody(new RigidBody(bodyId, Transform<float>(position, Quaternion<float>(), 1.0f), boxShape));
+        }
+    }
+    physicsWorld->getBodyManager()->setupWorkBodies();
+    physicsWorld->getCollisionWorld()->getBroadPhaseManager()->computeOverlappingPairs();
+
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> positionDistribution(0.0f, (float)GRID_SIZE * 1.5f);
+    std::uniform_real_distribution<float> offsetDistribution(-3.0f, 3.0f);
+    std::vector<Ray<float>> rays;
+    rays.reserve(NUM_RAYS);
+    for(unsigned int i = 0; i < NUM_RAYS; ++i)
+    { //line of sight rays above the boxes
+        Point3<float> from(positionDistribution(generator), 3.0f, positionDistribution(generator));
+        Point3<float> to(from.X + offsetDistribution(generator), 0.0f, from.Z + offsetDistribution(generator));
+        rays.emplace_back(Ray<float>(from, to));
+    }
+
+    auto startTime = std::chrono::high_resolution_clock::now();
+    std::size_t singleRayHits = 0;
+    for(const auto &ray : rays)
+    {
+        RayTester rayTester(ray);
+        rayTester.initialize(physicsWorld);
+        rayTester.execute(1.0f / 60.0f, physicsWorld->getGravity());
+        singleRayHits += rayTester.getRayTestResult()->hasHit() ? 1 : 0;
+    }
+    auto endTime = std::chrono::high_resolution_clock::now();
+    double singleRayDurationMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+    startTime = std::chrono::high_resolution_clock::now();
+    RayBatchTester rayBatchTester(rays);
+    rayBatchTester.initialize(physicsWorld);
+    rayBatchTester.execute(1.0f / 60.0f, physicsWorld->getGravity());
+    endTime = std::chrono::high_resolution_clock::now();
+    double batchDurationMs = std::chrono::duration<double, std::milli>(endTime - startTime).count();
+
+    std::size_t batchHits = 0;
+    std::shared_ptr<const RayBatchTestResult> rayBatchTestResult = rayBatchTester.getRayBatchTestResult();
+    for(std::size_t i = 0; i < rayBatchTestResult->getNumberRays(); ++i)
+    {
+        batchHits += rayBatchTestResult->hasHit(i) ? 1 : 0;
+    }
+    AssertHelper::assertUnsignedInt(batchHits, singleRayHits);
+
+    std::cout << std::fixed << std::setprecision(3) << "RayBatchTesterBenchmark - bodies: " << GRID_SIZE * GRID_SIZE << ", rays: " << NUM_RAYS
+              << ", hits: " << batchHits << ", single rays: " << singleRayDurationMs << "ms, batch: " << batchDurationMs
+              << "ms, speedup: " << singleRayDurationMs / batchDurationMs << std::endl;
+
+    delete physicsWorld;
+}
+
+CppUnit::Test *RayBatchTesterBenchmark::suite()
+{
+    auto *suite = new CppUnit::TestSuite("RayBatchTesterBenchmark");
+
+    suite->addTest(new CppUnit::TestCaller<RayBatchTesterBenchmark>("raysOnDenseScene", &RayBatchTesterBenchmark::raysOnDenseScene));
+
+    return suite;
+}
@@ -0,0 +1,17 @@
+#ifndef URCHINENGINE_RAYBATCHTESTERBENCHMARK_H
+#define URCHINENGINE_RAYBATCHTESTERBENCHMARK_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+#include "UrchinPhysicsEngine.h"
+
+class RayBatchTesterBenchmark : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void raysOnDenseScene();
+};
+
+#endif
@@ -0,0 +1,111 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+
+#include "physics/processable/raytest/RayBatchTesterTest.h"
+#include "processable/raytest/RayTester.h"
+#include "processable/raytest/RayBatchTester.h"
+#include "AssertHelper.h"
+using namespace urchin;
+
+void RayBatchTesterTest::batchRaysMatchSingleRays()
+{
+    PhysicsWorld *physicsWorld = buildPhysicsWorld();
+    std::vector<Ray<float>> rays;
+    for(unsigned int i = 0; i < 40; ++i)
+    { //vertical rays on heightfield and boxes, horizontal rays through the boxes
+        rays.emplace_back(Ray<float>(Point3<float>((float)i * 0.5f - 10.0f, 10.0f, 0.2f), Point3<float>((float)i * 0.5f - 10.0f, -10.0f, 0.2f)));
+        rays.emplace_back(Ray<float>(Point3<float>(-10.0f, 1.0f, (float)i * 0.5f - 10.0f), Point3<float>(10.0f, 1.0f, (float)i * 0.5f - 10.0f)));
+    }
+
+    RayBatchTester rayBatchTester(rays);
+    rayBatchTester.initialize(physicsWorld);
+    rayBatchTester.execute(1.0f / 60.0f, physicsWorld->getGravity());
+    std::shared_ptr<const RayBatchTestResult> rayBatchTestResult = rayBatchTester.getRayBatchTestResult();
+
+    AssertHelper::assertTrue(rayBatchTestResult->isResultReady());
+    AssertHelper::assertUnsignedInt(rayBatchTestResult->getNumberRays(), rays.size());
+    unsigned int numberHits = 0;
+    for(std::size_t i = 0; i < rays.size(); ++i)
+    {
+        RayTester rayTester(rays[i]);
+        rayTester.initialize(physicsWorld);
+        rayTester.execute(1.0f / 60.0f, physicsWorld->getGravity());
+        std::shared_ptr<const RayTestResult> rayTestResult = rayTester.getRayTestResult();
+
+        AssertHelper::assertTrue(rayTestResult->hasHit() == rayBatchTestResult->hasHit(i));
+        if(rayTestResult->hasHit())
+        {
+            const ContinuousCollisionResult<float> &nearestResult = rayBatchTestResult->getNearestResult(i);
+            AssertHelper::assertString(nearestResult.getBody2()->getId(), rayTestResult->getNearestResult()->getBody2()->getId());
+            AssertHelper::assertFloatEquals(nearestResult.getTimeToHit(), rayTestResult->getNearestResult()->getTimeToHit());
+            numberHits++;
+        }
+    }
+    AssertHelper::assertTrue(numberHits > 40);
+
+    delete physicsWorld;
+}
+
+void RayBatchTesterTest::batchRaysWithoutBody()
+{
+    PhysicsWorld *physicsWorld = buildPhysicsWorld();
+    std::vector<Ray<float>> rays;
+    rays.emplace_back(Ray<float>(Point3<float>(0.0f, 20.0f, 0.0f), Point3<float>(0.0f, 30.0f, 0.0f)));
+    rays.emplace_back(Ray<float>(Point3<float>(50.0f, 10.0f, 0.0f), Point3<float>(50.0f, -10.0f, 0.0f)));
+
+    RayBatchTester rayBatchTester(rays);
+    rayBatchTester.initialize(physicsWorld);
+    rayBatchTester.execute(1.0f / 60.0f, physicsWorld->getGravity());
+    std::shared_ptr<const RayBatchTestResult> rayBatchTestResult = rayBatchTester.getRayBatchTestResult();
+
+    AssertHelper::assertUnsignedInt(rayBatchTestResult->getNumberRays(), 2);
+    AssertHelper::assertTrue(!rayBatchTestResult->hasHit(0));
+    AssertHelper::assertTrue(!rayBatchTestResult->hasHit(1));
+
+    delete physicsWorld;
+}
+
+PhysicsWorld *RayBatchTesterTest::buildPhysicsWorld() const
+{
+    auto *physicsWorld = new PhysicsWorld();
+
+    std::vector<Point3<float>> heightfieldPoints;
+    for(unsigned int z = 0; z < 21; ++z)
+    {
+        for(unsigned int x = 0; x < 21; ++x)
+        {
+            heightfieldPoints.emplace_back(Point3<float>((float)x - 10.0f, (float)(x % 3) * 0.2f, (float)z - 10.0f));
+        }
+    }
+    std::shared_ptr<CollisionHeightfieldShape> heightfieldShape = std::make_shared<CollisionHeightfieldShape>(heightfieldPoints, 21, 21);
+    physicsWorld->addBody(new RigidBody("heightfield", Transform<float>(Point3<float>(0.0f, 0.0f, 0.0f), Quaternion<float>(), 1.0f), heightfieldShape));
+
+    std::shared_ptr<CollisionBoxShape> boxShape = std::make_shared<CollisionBoxShape>(Vector3<float>(0.5f, 0.5f, 0.5f));
+    std::shared_ptr<CollisionSphereShape> sphereShape = std::make_shared<CollisionSphereShape>(0.5f);
+    for(unsigned int i = 0; i < 10; ++i)
+    {
+        Transform<float> transform(Point3<float>((float)i * 2.0f - 9.0f, 1.0f, (float)i * 1.5f - 7.0f), Quaternion<float>(), 1.0f);
+        if(i % 2 == 0)
+        {
+            physicsWorld->addBody(new RigidBody("box" + std::to_string(i), transform, boxShape));
+        }else
+        {
+            physicsWorld->addBody(new RigidBody("sphere" + std::to_string(i), transform, sphereShape));
+        }
+    }
+
+    physicsWorld->getBodyManager()->setupWorkBodies();
+    physicsWorld->getCollisionWorld()->getBroadPhaseManager()->computeOverlappingPairs();
+
+    return physicsWorld;
+}
+
+CppUnit::Test *RayBatchTesterTest::suite()
+{
+    auto *suite = new CppUnit::TestSuite("RayBatchTesterTest");
+
+    suite->addTest(new CppUnit::TestCaller<RayBatchTesterTest>("batchRaysMatchSingleRays", &RayBatchTesterTest::batchRaysMatchSingleRays));
+    suite->addTest(new CppUnit::TestCaller<RayBatchTesterTest>("batchRaysWithoutBody", &RayBatchTesterTest::batchRaysWithoutBody));
+
+    return suite;
+}
@@ -0,0 +1,21 @@
+#ifndef URCHINENGINE_RAYBATCHTESTERTEST_H
+#define URCHINENGINE_RAYBATCHTESTERTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+#include "UrchinPhysicsEngine.h"
+
+class RayBatchTesterTest : public CppUnit::TestFixture
+{
+    public:
+        static CppUnit::Test *suite();
+
+        void batchRaysMatchSingleRays();
+        void batchRaysWithoutBody();
+
+    private:
+        urchin::PhysicsWorld *buildPhysicsWorld() const;
+};
+
+#endif
@@ -0,0 +1,84 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include "UrchinCommon.h"
+#include "UrchinPhysicsEngine.h"
+
+#include "AssertHelper.h"
+#include "physics/shape/CompoundChildrenBVHTest.h"
+using namespace urchin;
+
+void CompoundChildrenBVHTest::queryGridChildren()
+{
+	std::vector<AABBox<float>> childrenAABBox;
+	for(unsigned int z = 0; z < 10; ++z)
+	{
+		for(unsigned int x = 0; x < 10; ++x)
+		{
+			childrenAABBox.emplace_back(Point3<float>((float)x, 0.0f, (float)z), Point3<float>((float)x + 0.9f, 1.0f, (float)z + 0.9f));
+		}
+	}
+	CompoundChildrenBVH childrenBVH(childrenAABBox);
+
+	std::vector<std::size_t> childIndices;
+	childrenBVH.aabboxQuery(AABBox<float>(Point3<float>(2.5f, 0.5f, 3.5f), Point3<float>(3.5f, 0.6f, 3.6f)), childIndices);
+
+	AssertHelper::assertUnsignedInt(childIndices.size(), 2);
+	AssertHelper::assertUnsignedInt(childIndices[0], 32); //cell x=2, z=3
+	AssertHelper::assertUnsignedInt(childIndices[1], 33);
+}
+
+void CompoundChildrenBVHTest::queryMatchesBruteForce()
+{
+	std::vector<AABBox<float>> childrenAABBox;
+	for(unsigned int i = 0; i < 150; ++i)
+	{ //deterministic pseudo-random boxes
+		Point3<float> min((float)((i * 37) % 101) / 10.0f, (float)((i * 53) % 97) / 10.0f, (float)((i * 71) % 89) / 10.0f);
+		childrenAABBox.emplace_back(min, min + Point3<float>(0.5f + (float)(i % 7) / 5.0f, 0.5f, 0.5f + (float)(i % 3) / 5.0f));
+	}
+	CompoundChildrenBVH childrenBVH(childrenAABBox);
+
+	for(unsigned int q = 0; q < 20; ++q)
+	{
+		Point3<float> queryMin((float)q * 0.5f, (float)(q % 5) * 2.0f, (float)(q % 7) * 1.5f);
+		AABBox<float> queryAABBox(queryMin, queryMin + Point3<float>(1.5f, 2.0f, 1.0f));
+
+		std::vector<std::size_t> expectedChildIndices;
+		for(std::size_t i = 0; i < childrenAABBox.size(); ++i)
+		{
+			if(childrenAABBox[i].collideWithAABBox(queryAABBox))
+			{
+				expectedChildIndices.push_back(i);
+			}
+		}
+
+		std::vector<std::size_t> childIndices;
+		childrenBVH.aabboxQuery(queryAABBox, childIndices);
+
+		AssertHelper::assertTrue(childIndices == expectedChildIndices, "Children of query " + std::to_string(q) + " differ from brute force");
+	}
+}
+
+void CompoundChildrenBVHTest::queryOutsideChildren()
+{
+	std::vector<AABBox<float>> childrenAABBox;
+	childrenAABBox.emplace_back(Point3<float>(0.0f, 0.0f, 0.0f), Point3<float>(1.0f, 1.0f, 1.0f));
+	childrenAABBox.emplace_back(Point3<float>(2.0f, 0.0f, 0.0f), Point3<float>(3.0f, 1.0f, 1.0f));
+	childrenAABBox.emplace_back(Point3<float>(4.0f, 0.0f, 0.0f), Point3<float>(5.0f, 1.0f, 1.0f));
+	CompoundChildrenBVH childrenBVH(childrenAABBox);
+
+	std::vector<std::size_t> childIndices;
+	childrenBVH.aabboxQuery(AABBox<float>(Point3<float>(0.0f, 2.0f, 0.0f), Point3<float>(5.0f, 3.0f, 1.0f)), childIndices);
+
+	AssertHelper::assertUnsignedInt(childIndices.size(), 0);
+}
+
+CppUnit::Test *CompoundChildrenBVHTest::suite()
+{
+	auto *suite = new CppUnit::TestSuite("CompoundChildrenBVHTest");
+
+	suite->addTest(new CppUnit::TestCaller<CompoundChildrenBVHTest>("queryGridChildren", &CompoundChildrenBVHTest::queryGridChildren));
+	suite->addTest(new CppUnit::TestCaller<CompoundChildrenBVHTest>("queryMatchesBruteForce", &CompoundChildrenBVHTest::queryMatchesBruteForce));
+	suite->addTest(new CppUnit::TestCaller<CompoundChildrenBVHTest>("queryOutsideChildren", &CompoundChildrenBVHTest::queryOutsideChildren));
+
+	return suite;
+}
@@ -0,0 +1,17 @@
+#ifndef URCHINENGINE_COMPOUNDCHILDRENBVHTEST_H
+#define URCHINENGINE_COMPOUNDCHILDRENBVHTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class CompoundChildrenBVHTest : public CppUnit::TestFixture
+{
+	public:
+		static CppUnit::Test *suite();
+
+		void queryGridChildren();
+		void queryMatchesBruteForce();
+		void queryOutsideChildren();
+};
+
+#endif
@@ -0,0 +1,97 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include "UrchinCommon.h"
+#include "UrchinPhysicsEngine.h"
+
+#include "AssertHelper.h"
+#include "physics/shape/HeightfieldShapeQueryTest.h"
+using namespace urchin;
+
+void HeightfieldShapeQueryTest::trianglesInAABBox()
+{
+	std::unique_ptr<CollisionHeightfieldShape> heightfieldShape = buildFlatHeightfield();
+
+	std::vector<unsigned int> triangleIndices;
+	FunctionTriangleVisitor triangleVisitor([&](const CollisionTriangleShape &triangle) {
+		triangleIndices.push_back(triangle.getTriangleIndex());
+	});
+	heightfieldShape->findTrianglesInAABBox(AABBox<float>(Point3<float>(-0.1f, -0.1f, -0.1f), Point3<float>(0.1f, 0.1f, 0.1f)), triangleVisitor);
+
+	AssertHelper::assertUnsignedInt(triangleIndices.size(), 2);
+	AssertHelper::assertUnsignedInt(triangleIndices[0], 10); //cell x=1, z=1
+	AssertHelper::assertUnsignedInt(triangleIndices[1], 11);
+}
+
+void HeightfieldShapeQueryTest::trianglesHitByDescendingRay()
+{
+	std::unique_ptr<CollisionHeightfieldShape> heightfieldShape = buildFlatHeightfield();
+
+	std::vector<unsigned int> triangleIndices = findTriangleIndicesHitByRay(*heightfieldShape,
+			LineSegment3D<float>(Point3<float>(-1.4f, 1.0f, -1.2f), Point3<float>(1.4f, -1.0f, -1.2f)));
+
+	AssertHelper::assertUnsignedInt(triangleIndices.size(), 2); //only the cell where the ray crosses the ground
+	AssertHelper::assertUnsignedInt(triangleIndices[0], 2); //cell x=1, z=0
+	AssertHelper::assertUnsignedInt(triangleIndices[1], 3);
+}
+
+void HeightfieldShapeQueryTest::trianglesHitByVerticalRay()
+{
+	std::unique_ptr<CollisionHeightfieldShape> heightfieldShape = buildFlatHeightfield();
+
+	std::vector<unsigned int> triangleIndices = findTriangleIndicesHitByRay(*heightfieldShape,
+			LineSegment3D<float>(Point3<float>(1.0f, 1.0f, 1.0f), Point3<float>(1.0f, -1.0f, 1.0f)));
+
+	AssertHelper::assertUnsignedInt(triangleIndices.size(), 2);
+	AssertHelper::assertUnsignedInt(triangleIndices[0], 20); //cell x=2, z=2
+	AssertHelper::assertUnsignedInt(triangleIndices[1], 21);
+}
+
+void HeightfieldShapeQueryTest::rayOutsideHeightfield()
+{
+	std::unique_ptr<CollisionHeightfieldShape> heightfieldShape = buildFlatHeightfield();
+
+	std::vector<unsigned int> triangleIndices = findTriangleIndicesHitByRay(*heightfieldShape,
+			LineSegment3D<float>(Point3<float>(-3.0f, 1.0f, 2.0f), Point3<float>(3.0f, -1.0f, 2.0f)));
+
+	AssertHelper::assertUnsignedInt(triangleIndices.size(), 0);
+}
+
+/**
+ * @return Flat heightfield of 3x3 cells centered on origin
+ */
+std::unique_ptr<CollisionHeightfieldShape> HeightfieldShapeQueryTest::buildFlatHeightfield() const
+{
+	std::vector<Point3<float>> vertices;
+	for(unsigned int z=0; z<4; ++z)
+	{
+		for(unsigned int x=0; x<4; ++x)
+		{
+			vertices.emplace_back(Point3<float>((float)x - 1.5f, 0.0f, (float)z - 1.5f));
+		}
+	}
+
+	return std::make_unique<CollisionHeightfieldShape>(vertices, 4, 4);
+}
+
+std::vector<unsigned int> HeightfieldShapeQueryTest::findTriangleIndicesHitByRay(const CollisionHeightfieldShape &heightfieldShape, const LineSegment3D<float> &ray) const
+{
+	std::vector<unsigned int> triangleIndices;
+	FunctionTriangleVisitor triangleVisitor([&](const CollisionTriangleShape &triangle) {
+		triangleIndices.push_back(triangle.getTriangleIndex());
+	});
+	heightfieldShape.findTrianglesHitByRay(ray, triangleVisitor);
+
+	return triangleIndices;
+}
+
+CppUnit::Test *HeightfieldShapeQueryTest::suite()
+{
+	auto *suite = new CppUnit::TestSuite("HeightfieldShapeQueryTest");
+
+	suite->addTest(new CppUnit::TestCaller<HeightfieldShapeQueryTest>("trianglesInAABBox", &HeightfieldShapeQueryTest::trianglesInAABBox));
+	suite->addTest(new CppUnit::TestCaller<HeightfieldShapeQueryTest>("trianglesHitByDescendingRay", &HeightfieldShapeQueryTest::trianglesHitByDescendingRay));
+	suite->addTest(new CppUnit::TestCaller<HeightfieldShapeQueryTest>("trianglesHitByVerticalRay", &HeightfieldShapeQueryTest::trianglesHitByVerticalRay));
+	suite->addTest(new CppUnit::TestCaller<HeightfieldShapeQueryTest>("rayOutsideHeightfield", &HeightfieldShapeQueryTest::rayOutsideHeightfield));
+
+	return suite;
+}
@@ -0,0 +1,25 @@
+#ifndef URCHINENGINE_HEIGHTFIELDSHAPEQUERYTEST_H
+#define URCHINENGINE_HEIGHTFIELDSHAPEQUERYTEST_H
+
+#include <memory>
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+#include "UrchinPhysicsEngine.h"
+
+class HeightfieldShapeQueryTest : public CppUnit::TestFixture
+{
+	public:
+		static CppUnit::Test *suite();
+
+		void trianglesInAABBox();
+		void trianglesHitByDescendingRay();
+		void trianglesHitByVerticalRay();
+		void rayOutsideHeightfield();
+
+	private:
+		std::unique_ptr<urchin::CollisionHeightfieldShape> buildFlatHeightfield() const;
+		std::vector<unsigned int> findTriangleIndicesHitByRay(const urchin::CollisionHeightfieldShape &, const urchin::LineSegment3D<float> &) const;
+};
+
+#endif
@@ -0,0 +1,128 @@
+#include <cppunit/TestSuite.h>
+#include <cppunit/TestCaller.h>
+#include <thread>
+#include <vector>
+#include <limits>
+#include "UrchinCommon.h"
+#include "utils/pool/ThreadLocalFixedSizePool.h"
+
+#include "AssertHelper.h"
+#include "physics/utils/pool/ThreadLocalFixedSizePoolTest.h"
+using namespace urchin;
+
+struct PoolElement
+{
+	explicit PoolElement(unsigned int value) :
+		value(value)
+	{
+
+	}
+
+	unsigned int value;
+	unsigned int padding[3];
+};
+
+void ThreadLocalFixedSizePoolTest::allocateUntilOverflow()
+{
+	ThreadLocalFixedSizePool<PoolElement> pool("testPool", sizeof(PoolElement), 4);
+
+	std::vector<PoolElement *> elements;
+	for(unsigned int i=0; i<5; ++i)
+	{
+		elements.push_back(new (pool.allocate(sizeof(PoolElement))) PoolElement(i));
+	}
+	AssertHelper::assertUnsignedInt(pool.getNumberThreadChunks(), 1);
+	AssertHelper::assertUnsignedInt(pool.getThreadUsage(0), 4);
+	AssertHelper::assertUnsignedInt(pool.getHighWaterMark(), 4);
+	AssertHelper::assertUnsignedInt(pool.getOverflowCount(), 1);
+	std::string logValue = Logger::logger().retrieveContent(std::numeric_limits<unsigned long>::max());
+	AssertHelper::assertTrue(logValue.find("(WW) Thread local pool is full of elements.") != std::string::npos);
+	Logger::logger().purge();
+
+	for(auto element : elements)
+	{
+		pool.free(element);
+	}
+	AssertHelper::assertUnsignedInt(pool.getThreadUsage(0), 0);
+	AssertHelper::assertUnsignedInt(pool.getHighWaterMark(), 4);
+}
+
+void ThreadLocalFixedSizePoolTest::freeFromAnotherThread()
+{
+	ThreadLocalFixedSizePool<PoolElement> pool("testPool", sizeof(PoolElement), 4);
+	std::vector<PoolElement *> elements;
+
+	std::thread allocatorThread([&]() {
+		for(unsigned int i=0; i<4; ++i)
+		{
+			elements.push_back(new (pool.allocate(sizeof(PoolElement))) PoolElement(i));
+		}
+	});
+	allocatorThread.join();
+	AssertHelper::assertUnsignedInt(pool.getNumberThreadChunks(), 1);
+	AssertHelper::assertUnsignedInt(pool.getThreadUsage(0), 4);
+
+	for(auto element : elements)
+	{ //elements are given back to the remote free list of the allocator thread chunk
+		pool.free(element);
+	}
+	AssertHelper::assertUnsignedInt(pool.getThreadUsage(0), 0);
+	AssertHelper::assertUnsignedInt(pool.getRemoteFreeCount(), 4);
+
+	elements.clear();
+	for(unsigned int i=0; i<4; ++i)
+	{ //current thread reuses the chunk released by the exited allocator thread
+		elements.push_back(new (pool.allocate(sizeof(PoolElement))) PoolElement(i));
+	}
+	AssertHelper::assertUnsignedInt(pool.getNumberThreadChunks(), 1);
+	AssertHelper::assertUnsignedInt(pool.getThreadUsage(0), 4);
+	AssertHelper::assertUnsignedInt(pool.getOverflowCount(), 0);
+
+	for(auto element : elements)
+	{
+		pool.free(element);
+	}
+}
+
+/**
+ * Allocate from more successive threads than the maximum of chunks: chunks of the exited threads are reused.
+ */
+void ThreadLocalFixedSizePoolTest::allocateFromMoreThreadsThanChunks()
+{
+	ThreadLocalFixedSizePool<PoolElement> pool("testPool", sizeof(PoolElement), 4);
+	std::vector<PoolElement *> elements;
+
+	for(unsigned int i=0; i<MAX_POOL_THREADS + 16; ++i)
+	{
+		std::thread allocatorThread([&]() {
+			elements.push_back(new (pool.allocate(sizeof(PoolElement))) PoolElement(i));
+			pool.free(new (pool.allocate(sizeof(PoolElement))) PoolElement(i));
+		});
+		allocatorThread.join();
+
+		if(elements.size() == 2)
+		{ //elements allocated by exited threads are freed by current thread
+			pool.free(elements[0]);
+			pool.free(elements[1]);
+			elements.clear();
+		}
+	}
+	AssertHelper::assertUnsignedInt(pool.getOverflowCount(), 0);
+	AssertHelper::assertUnsignedInt(pool.getNumberThreadChunks(), 1);
+
+	for(auto element : elements)
+	{
+		pool.free(element);
+	}
+}
+
+CppUnit::Test *ThreadLocalFixedSizePoolTest::suite()
+{
+	auto *suite = new CppUnit::TestSuite("ThreadLocalFixedSizePoolTest");
+
+	suite->addTest(new CppUnit::TestCaller<ThreadLocalFixedSizePoolTest>("allocateUntilOverflow", &ThreadLocalFixedSizePoolTest::allocateUntilOverflow));
+	suite->addTest(new CppUnit::TestCaller<ThreadLocalFixedSizePoolTest>("freeFromAnotherThread", &ThreadLocalFixedSizePoolTest::freeFromAnotherThread));
+	suite->addTest(new CppUnit::TestCaller<ThreadLocalFixedSizePoolTest>("allocateFromMoreThreadsThanChunks", &ThreadLocalFixedSizePoolTest::allocateFromMoreThreadsThanChunks));
+
+	return suite;
+}
@@ -0,0 +1,17 @@
+#ifndef URCHINENGINE_THREADLOCALFIXEDSIZEPOOLTEST_H
+#define URCHINENGINE_THREADLOCALFIXEDSIZEPOOLTEST_H
+
+#include <cppunit/TestFixture.h>
+#include <cppunit/Test.h>
+
+class ThreadLocalFixedSizePoolTest : public CppUnit::TestFixture
+{
+	public:
+		static CppUnit::Test *suite();
+
+		void allocateUntilOverflow();
+		void freeFromAnotherThread();
+		void allocateFromMoreThreadsThanChunks();
+};
+
+#endif